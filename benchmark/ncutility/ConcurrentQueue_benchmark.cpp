@@ -0,0 +1,158 @@
+/**
+ * Run-time benchmark for nc::SpscQueue and nc::MpmcQueue.
+ *
+ * Measures throughput of moving integers from producer threads to consumer threads through each queue,
+ * with single and batched operations, and compares against a std::mutex guarded std::deque. Results
+ * depend heavily on core count and topology. Build with optimizations enabled, e.g.
+ * CMAKE_BUILD_TYPE=Release.
+ */
+#include "ncutility/ConcurrentQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr auto g_itemCount = uint64_t{1u << 21};
+constexpr auto g_iterationCount = 5;
+constexpr auto g_capacity = size_t{1024};
+constexpr auto g_batchSize = size_t{32};
+
+// Keeps results observable so loops aren't optimized away.
+volatile uint64_t g_sink = 0;
+
+// Bounded queue with the same Try* interface as the lock-free queues, used as a baseline.
+class MutexQueue
+{
+    public:
+        explicit MutexQueue(size_t capacity)
+            : m_capacity{capacity}
+        {
+        }
+
+        auto TryPush(uint64_t value) -> bool
+        {
+            auto lock = std::lock_guard{m_mutex};
+            if (m_values.size() == m_capacity)
+                return false;
+
+            m_values.push_back(value);
+            return true;
+        }
+
+        auto TryPop(uint64_t& out) -> bool
+        {
+            auto lock = std::lock_guard{m_mutex};
+            if (m_values.empty())
+                return false;
+
+            out = m_values.front();
+            m_values.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::deque<uint64_t> m_values;
+        size_t m_capacity;
+};
+
+// Pushes producers * perProducer values and returns once consumers have popped them all.
+template<class Queue, bool Batched>
+void RunTransfer(Queue& queue, unsigned producers, unsigned consumers)
+{
+    const auto perProducer = g_itemCount / producers;
+    const auto total = perProducer * producers;
+    auto consumed = std::atomic<uint64_t>{0};
+    auto threads = std::vector<std::thread>{};
+
+    for (auto p = 0u; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, perProducer]()
+        {
+            auto batch = std::vector<uint64_t>(g_batchSize, 1);
+            for (auto sent = uint64_t{0}; sent < perProducer;)
+            {
+                auto pushed = size_t{0};
+                if constexpr (Batched)
+                    pushed = queue.TryPushBatch(batch.begin(), static_cast<size_t>(std::min<uint64_t>(g_batchSize, perProducer - sent)));
+                else
+                    pushed = queue.TryPush(uint64_t{1}) ? 1 : 0;
+
+                sent += pushed;
+                if (pushed == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (auto c = 0u; c < consumers; ++c)
+    {
+        threads.emplace_back([&queue, &consumed, total]()
+        {
+            auto batch = std::vector<uint64_t>(g_batchSize);
+            auto sum = uint64_t{0};
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                auto popped = size_t{0};
+                if constexpr (Batched)
+                    popped = queue.TryPopBatch(batch.begin(), g_batchSize);
+                else
+                    popped = queue.TryPop(batch[0]) ? 1 : 0;
+
+                for (auto i = size_t{0}; i < popped; ++i)
+                    sum += batch[i];
+
+                consumed.fetch_add(popped, std::memory_order_relaxed);
+                if (popped == 0)
+                    std::this_thread::yield();
+            }
+
+            g_sink = g_sink + sum;
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+template<class Queue, bool Batched>
+auto Measure(unsigned producers, unsigned consumers) -> double
+{
+    auto best = std::chrono::duration<double, std::nano>::max();
+    for (auto i = 0; i < g_iterationCount; ++i)
+    {
+        auto queue = Queue{g_capacity};
+        const auto start = std::chrono::steady_clock::now();
+        RunTransfer<Queue, Batched>(queue, producers, consumers);
+        best = std::min(best, std::chrono::duration<double, std::nano>{std::chrono::steady_clock::now() - start});
+    }
+
+    return best.count() / static_cast<double>(g_itemCount);
+}
+
+void Report(const char* name, double queueNs, double mutexNs)
+{
+    std::printf("%-24s Queue: %7.3f ns/item   Mutex+deque: %7.3f ns/item   Ratio: %5.2f\n",
+                name, queueNs, mutexNs, queueNs / mutexNs);
+}
+} // anonymous namespace
+
+int main()
+{
+    const auto mutexSpsc = Measure<MutexQueue, false>(1, 1);
+    Report("SpscQueue single", Measure<nc::SpscQueue<uint64_t>, false>(1, 1), mutexSpsc);
+    Report("SpscQueue batch", Measure<nc::SpscQueue<uint64_t>, true>(1, 1), mutexSpsc);
+
+    const auto threads = std::max(2u, std::thread::hardware_concurrency() / 2);
+    const auto mutexMpmc = Measure<MutexQueue, false>(threads, threads);
+    Report("MpmcQueue single", Measure<nc::MpmcQueue<uint64_t>, false>(threads, threads), mutexMpmc);
+    Report("MpmcQueue batch", Measure<nc::MpmcQueue<uint64_t>, true>(threads, threads), mutexMpmc);
+}
@@ -0,0 +1,406 @@
+#pragma once
+
+#include "Quaternion.h"
+#include "ncutility/NcError.h"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+// AVX2 does not imply F16C under GCC and Clang, but MSVC has no separate F16C switch and enables it with /arch:AVX2.
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#include <immintrin.h>
+#define NC_PACKING_F16C
+#endif
+
+/**
+ * Compact encodings for vectors and rotations, for use in serialized data and GPU buffers. Each packed
+ * type is a trivially copyable aggregate, so it may be used directly as a member of a serialized type
+ * or copied into a vertex/instance buffer. Batch functions operate on spans and are written as simple
+ * branchless loops so they vectorize, with a hardware path for half floats when F16C is available.
+ */
+namespace nc
+{
+/** @brief A Vector3 stored as three IEEE 754 half precision floats. */
+struct HalfVector3
+{
+    uint16_t x, y, z;
+};
+
+/** @brief A unit vector stored as an octahedral projection with 16 bit signed normalized coordinates. */
+struct OctahedralNormal
+{
+    int16_t u, v;
+};
+
+/**
+ * @brief A unit quaternion stored with the smallest three components method in 32 bits.
+ *
+ * The index of the largest component uses 2 bits, and the remaining components use 10 bits each.
+ */
+struct CompactQuaternion32
+{
+    uint32_t bits;
+};
+
+/**
+ * @brief A unit quaternion stored with the smallest three components method in 48 bits.
+ *
+ * The index of the largest component uses 2 bits, and the remaining components use 15 bits each.
+ */
+struct CompactQuaternion48
+{
+    std::array<uint16_t, 3> bits;
+};
+
+/** @brief A Vector3 within [Min, Max] on each axis stored as 16 bit fixed-point values. */
+template<float Min, float Max>
+    requires (Min < Max)
+struct FixedPointVector3
+{
+    uint16_t x, y, z;
+
+    /** @brief The largest difference between a value in range and its decoded value. */
+    static constexpr auto Precision = (Max - Min) / 65535.0f * 0.5f;
+};
+
+/** @brief Convert a float to a half float, rounding to nearest even. Out of range values become infinity. */
+constexpr auto PackHalf(float value) noexcept -> uint16_t;
+
+/** @brief Convert a half float to a float. */
+constexpr auto UnpackHalf(uint16_t value) noexcept -> float;
+
+constexpr auto PackHalf(const Vector3& vec) noexcept -> HalfVector3;
+constexpr auto Unpack(const HalfVector3& packed) noexcept -> Vector3;
+
+/** @brief Pack a unit vector. Non-unit vectors are projected onto the unit sphere. vec may not be zero. */
+constexpr auto PackNormal(const Vector3& vec) noexcept -> OctahedralNormal;
+inline    auto Unpack(const OctahedralNormal& packed) noexcept -> Vector3;
+
+/** @brief Pack a unit quaternion. The decoded quaternion may be the negation of quat, which is the same rotation. */
+inline    auto PackQuaternion32(const Quaternion& quat) noexcept -> CompactQuaternion32;
+inline    auto Unpack(const CompactQuaternion32& packed) -> Quaternion;
+inline    auto PackQuaternion48(const Quaternion& quat) noexcept -> CompactQuaternion48;
+inline    auto Unpack(const CompactQuaternion48& packed) -> Quaternion;
+
+/** @brief Pack a Vector3, clamping each component to [Min, Max]. NaN components become Min. */
+template<float Min, float Max>
+constexpr auto PackFixedPoint(const Vector3& vec) noexcept -> FixedPointVector3<Min, Max>;
+template<float Min, float Max>
+constexpr auto Unpack(const FixedPointVector3<Min, Max>& packed) noexcept -> Vector3;
+
+/** @brief Batch versions of the above. Input and output spans must have the same size. */
+inline void PackHalf(std::span<const float> in, std::span<uint16_t> out);
+inline void UnpackHalf(std::span<const uint16_t> in, std::span<float> out);
+inline void PackHalf(std::span<const Vector3> in, std::span<HalfVector3> out);
+inline void Unpack(std::span<const HalfVector3> in, std::span<Vector3> out);
+inline void PackNormal(std::span<const Vector3> in, std::span<OctahedralNormal> out);
+inline void Unpack(std::span<const OctahedralNormal> in, std::span<Vector3> out);
+inline void PackQuaternion32(std::span<const Quaternion> in, std::span<CompactQuaternion32> out);
+inline void Unpack(std::span<const CompactQuaternion32> in, std::span<Quaternion> out);
+inline void PackQuaternion48(std::span<const Quaternion> in, std::span<CompactQuaternion48> out);
+inline void Unpack(std::span<const CompactQuaternion48> in, std::span<Quaternion> out);
+template<float Min, float Max>
+void PackFixedPoint(std::span<const Vector3> in, std::span<FixedPointVector3<Min, Max>> out);
+template<float Min, float Max>
+void Unpack(std::span<const FixedPointVector3<Min, Max>> in, std::span<Vector3> out);
+
+/** @cond internal */
+namespace detail
+{
+// Clamp to [0, maxValue] and round to the nearest integer. NaN maps to 0.
+constexpr auto Quantize(float value, uint32_t maxValue) noexcept -> uint32_t
+{
+    if (std::isnan(value))
+        return 0u;
+
+    return static_cast<uint32_t>(std::llround(Clamp(value, 0.0f, static_cast<float>(maxValue))));
+}
+
+constexpr auto SignNotZero(float value) noexcept -> float
+{
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+// Quantize the three smallest components of a unit quaternion to Bits bits each, preceded by the 2 bit
+// index of the largest. The largest component is made positive, as q and -q are the same rotation.
+template<uint32_t Bits>
+auto PackSmallestThree(const Quaternion& quat) noexcept -> uint64_t
+{
+    const auto components = std::array<float, 4>{quat.x, quat.y, quat.z, quat.w};
+    auto largest = 0u;
+    for (auto i = 1u; i < 4u; ++i)
+    {
+        if (std::fabs(components[i]) > std::fabs(components[largest]))
+            largest = i;
+    }
+
+    // Use an even number of steps so zero is exactly representable.
+    constexpr auto maxValue = (1u << Bits) - 2u;
+    const auto sign = SignNotZero(components[largest]);
+    auto packed = static_cast<uint64_t>(largest);
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        if (i == largest)
+            continue;
+
+        const auto normalized = (components[i] * sign * std::numbers::sqrt2_v<float> + 1.0f) * 0.5f;
+        packed = (packed << Bits) | Quantize(normalized * static_cast<float>(maxValue), maxValue);
+    }
+
+    return packed;
+}
+
+template<uint32_t Bits>
+auto UnpackSmallestThree(uint64_t packed) -> Quaternion
+{
+    constexpr auto mask = (1u << Bits) - 1u;
+    constexpr auto maxValue = mask - 1u;
+    const auto largest = static_cast<uint32_t>(packed >> (3u * Bits)) & 3u;
+    auto components = std::array<float, 4>{};
+    auto sumOfSquares = 0.0f;
+    for (auto i = 4u; i-- > 0u;)
+    {
+        if (i == largest)
+            continue;
+
+        const auto quantized = static_cast<float>(Min(static_cast<uint32_t>(packed & mask), maxValue));
+        components[i] = (quantized / static_cast<float>(maxValue) * 2.0f - 1.0f) / std::numbers::sqrt2_v<float>;
+        sumOfSquares += components[i] * components[i];
+        packed >>= Bits;
+    }
+
+    components[largest] = std::sqrt(Max(1.0f - sumOfSquares, 0.0f));
+    return Quaternion{components[0], components[1], components[2], components[3]};
+}
+} // namespace detail
+/** @endcond internal */
+
+constexpr auto PackHalf(float value) noexcept -> uint16_t
+{
+    auto bits = std::bit_cast<uint32_t>(value);
+    const auto sign = static_cast<uint16_t>((bits >> 16u) & 0x8000u);
+    bits &= 0x7FFFFFFFu;
+
+    if (bits >= 0x47800000u) // too large for a half: infinity, or a quiet nan
+        return static_cast<uint16_t>(sign | (bits > 0x7F800000u ? 0x7E00u : 0x7C00u));
+
+    if (bits < 0x38800000u) // subnormal or zero: let float addition do the rounding
+    {
+        const auto rounded = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) + 0.5f);
+        return static_cast<uint16_t>(sign | (rounded - 0x3F000000u));
+    }
+
+    const auto mantissaOdd = (bits >> 13u) & 1u;
+    bits += 0xC8000FFFu + mantissaOdd; // rebias the exponent and round to nearest even
+    return static_cast<uint16_t>(sign | (bits >> 13u));
+}
+
+constexpr auto UnpackHalf(uint16_t value) noexcept -> float
+{
+    constexpr auto shiftedExponent = 0x7C00u << 13u;
+    auto bits = (static_cast<uint32_t>(value) & 0x7FFFu) << 13u;
+    const auto exponent = bits & shiftedExponent;
+    bits += (127u - 15u) << 23u;
+
+    if (exponent == shiftedExponent) // infinity or nan
+    {
+        bits += (128u - 16u) << 23u;
+    }
+    else if (exponent == 0u) // subnormal or zero: renormalize
+    {
+        bits += 1u << 23u;
+        bits = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) - std::bit_cast<float>(113u << 23u));
+    }
+
+    return std::bit_cast<float>(bits | (static_cast<uint32_t>(value & 0x8000u) << 16u));
+}
+
+constexpr auto PackHalf(const Vector3& vec) noexcept -> HalfVector3
+{
+    return HalfVector3{PackHalf(vec.x), PackHalf(vec.y), PackHalf(vec.z)};
+}
+
+constexpr auto Unpack(const HalfVector3& packed) noexcept -> Vector3
+{
+    return Vector3{UnpackHalf(packed.x), UnpackHalf(packed.y), UnpackHalf(packed.z)};
+}
+
+constexpr auto PackNormal(const Vector3& vec) noexcept -> OctahedralNormal
+{
+    const auto l1 = std::fabs(vec.x) + std::fabs(vec.y) + std::fabs(vec.z);
+    auto u = vec.x / l1;
+    auto v = vec.y / l1;
+    if (vec.z < 0.0f)
+    {
+        const auto foldedU = (1.0f - std::fabs(v)) * detail::SignNotZero(u);
+        v = (1.0f - std::fabs(u)) * detail::SignNotZero(v);
+        u = foldedU;
+    }
+
+    constexpr auto scale = 32767.0f;
+    return OctahedralNormal
+    {
+        static_cast<int16_t>(static_cast<int32_t>(detail::Quantize((u + 1.0f) * scale, 65534u)) - 32767),
+        static_cast<int16_t>(static_cast<int32_t>(detail::Quantize((v + 1.0f) * scale, 65534u)) - 32767)
+    };
+}
+
+inline auto Unpack(const OctahedralNormal& packed) noexcept -> Vector3
+{
+    auto x = static_cast<float>(packed.u) / 32767.0f;
+    auto y = static_cast<float>(packed.v) / 32767.0f;
+    const auto z = 1.0f - std::fabs(x) - std::fabs(y);
+    const auto fold = Max(-z, 0.0f);
+    x -= fold * detail::SignNotZero(x);
+    y -= fold * detail::SignNotZero(y);
+    return Normalize(Vector3{x, y, z});
+}
+
+inline auto PackQuaternion32(const Quaternion& quat) noexcept -> CompactQuaternion32
+{
+    return CompactQuaternion32{static_cast<uint32_t>(detail::PackSmallestThree<10u>(quat))};
+}
+
+inline auto Unpack(const CompactQuaternion32& packed) -> Quaternion
+{
+    return detail::UnpackSmallestThree<10u>(packed.bits);
+}
+
+inline auto PackQuaternion48(const Quaternion& quat) noexcept -> CompactQuaternion48
+{
+    const auto packed = detail::PackSmallestThree<15u>(quat);
+    return CompactQuaternion48
+    {
+        static_cast<uint16_t>(packed),
+        static_cast<uint16_t>(packed >> 16u),
+        static_cast<uint16_t>(packed >> 32u)
+    };
+}
+
+inline auto Unpack(const CompactQuaternion48& packed) -> Quaternion
+{
+    return detail::UnpackSmallestThree<15u>(static_cast<uint64_t>(packed.bits[0]) |
+                                           (static_cast<uint64_t>(packed.bits[1]) << 16u) |
+                                           (static_cast<uint64_t>(packed.bits[2]) << 32u));
+}
+
+template<float Min, float Max>
+constexpr auto PackFixedPoint(const Vector3& vec) noexcept -> FixedPointVector3<Min, Max>
+{
+    constexpr auto scale = 65535.0f / (Max - Min);
+    return FixedPointVector3<Min, Max>
+    {
+        static_cast<uint16_t>(detail::Quantize((vec.x - Min) * scale, 65535u)),
+        static_cast<uint16_t>(detail::Quantize((vec.y - Min) * scale, 65535u)),
+        static_cast<uint16_t>(detail::Quantize((vec.z - Min) * scale, 65535u))
+    };
+}
+
+template<float Min, float Max>
+constexpr auto Unpack(const FixedPointVector3<Min, Max>& packed) noexcept -> Vector3
+{
+    constexpr auto scale = (Max - Min) / 65535.0f;
+    return Vector3
+    {
+        Min + static_cast<float>(packed.x) * scale,
+        Min + static_cast<float>(packed.y) * scale,
+        Min + static_cast<float>(packed.z) * scale
+    };
+}
+
+inline void PackHalf(std::span<const float> in, std::span<uint16_t> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    auto i = size_t{0};
+#ifdef NC_PACKING_F16C
+    for (; i + 8u <= in.size(); i += 8u)
+    {
+        const auto half = _mm256_cvtps_ph(_mm256_loadu_ps(in.data() + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), half);
+    }
+#endif
+    for (; i < in.size(); ++i) out[i] = PackHalf(in[i]);
+}
+
+inline void UnpackHalf(std::span<const uint16_t> in, std::span<float> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    auto i = size_t{0};
+#ifdef NC_PACKING_F16C
+    for (; i + 8u <= in.size(); i += 8u)
+    {
+        const auto half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.data() + i));
+        _mm256_storeu_ps(out.data() + i, _mm256_cvtph_ps(half));
+    }
+#endif
+    for (; i < in.size(); ++i) out[i] = UnpackHalf(in[i]);
+}
+
+inline void PackHalf(std::span<const Vector3> in, std::span<HalfVector3> out)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float) && sizeof(HalfVector3) == 3 * sizeof(uint16_t));
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    PackHalf(std::span<const float>{&in.data()->x, in.size() * 3u},
+             std::span<uint16_t>{&out.data()->x, out.size() * 3u});
+}
+
+inline void Unpack(std::span<const HalfVector3> in, std::span<Vector3> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    UnpackHalf(std::span<const uint16_t>{&in.data()->x, in.size() * 3u},
+               std::span<float>{&out.data()->x, out.size() * 3u});
+}
+
+inline void PackNormal(std::span<const Vector3> in, std::span<OctahedralNormal> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = PackNormal(in[i]);
+}
+
+inline void Unpack(std::span<const OctahedralNormal> in, std::span<Vector3> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = Unpack(in[i]);
+}
+
+inline void PackQuaternion32(std::span<const Quaternion> in, std::span<CompactQuaternion32> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = PackQuaternion32(in[i]);
+}
+
+inline void Unpack(std::span<const CompactQuaternion32> in, std::span<Quaternion> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = Unpack(in[i]);
+}
+
+inline void PackQuaternion48(std::span<const Quaternion> in, std::span<CompactQuaternion48> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = PackQuaternion48(in[i]);
+}
+
+inline void Unpack(std::span<const CompactQuaternion48> in, std::span<Quaternion> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = Unpack(in[i]);
+}
+
+template<float Min, float Max>
+void PackFixedPoint(std::span<const Vector3> in, std::span<FixedPointVector3<Min, Max>> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = PackFixedPoint<Min, Max>(in[i]);
+}
+
+template<float Min, float Max>
+void Unpack(std::span<const FixedPointVector3<Min, Max>> in, std::span<Vector3> out)
+{
+    NC_ASSERT(in.size() == out.size(), "Packing span sizes do not match");
+    for (auto i = size_t{0}; i < in.size(); ++i) out[i] = Unpack(in[i]);
+}
+} // namespace nc
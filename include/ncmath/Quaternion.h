@@ -49,3 +49,8 @@ inline bool operator!=(const Quaternion& lhs, const Quaternion& rhs)
     return !(lhs == rhs);
 }
 } // namespace nc
+
+/** @cond internal */
+template<> struct nc::serialize::UniformScalarLayout<nc::Quaternion> { static constexpr size_t ScalarSize = sizeof(float); };
+/** @endcond internal */
+
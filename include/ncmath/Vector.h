@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Math.h"
+#include "ncutility/ByteOrder.h"
 
 namespace nc
 {
@@ -437,3 +438,10 @@ constexpr Vector3 ToVector3(const Vector4& vec) noexcept
     return Vector3{vec.x, vec.y, vec.z};
 }
 } // namespace nc
+
+/** @cond internal */
+template<> struct nc::serialize::UniformScalarLayout<nc::Vector2> { static constexpr size_t ScalarSize = sizeof(float); };
+template<> struct nc::serialize::UniformScalarLayout<nc::Vector3> { static constexpr size_t ScalarSize = sizeof(float); };
+template<> struct nc::serialize::UniformScalarLayout<nc::Vector4> { static constexpr size_t ScalarSize = sizeof(float); };
+/** @endcond internal */
+
@@ -1,24 +1,385 @@
 #pragma once
 
+#include "NcError.h"
+#include "TaskScheduler.h"
+#include "detail/AdjacentDetail.h"
+#include "detail/ChunkDetail.h"
 #include "detail/EnumerateDetail.h"
+#include "detail/RadixSortDetail.h"
+#include "detail/ScanDetail.h"
+#include "detail/StrideDetail.h"
+#include "detail/ZipDetail.h"
 
 #include <algorithm>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <ranges>
 #include <type_traits>
 #include <vector>
 
 namespace nc::algo
 {
+/** @brief Execution policy running an algorithm on the calling thread. */
+struct SequentialPolicy
+{
+};
+
+/** @brief Execution policy splitting an algorithm across the threads of nc::TaskScheduler::Default(). */
+struct ParallelPolicy
+{
+    /** @brief The smallest number of elements processed together. Inputs this small run on the calling thread. */
+    size_t minChunkSize = 2048;
+
+    /** @brief The maximum number of threads to use, or 0 for no limit. */
+    size_t maxConcurrency = 0;
+};
+
+/** @brief Run an algorithm sequentially. */
+inline constexpr SequentialPolicy Sequential{};
+
+/** @brief Run an algorithm in parallel with default settings. Construct a ParallelPolicy to tune chunking. */
+inline constexpr ParallelPolicy Parallel{};
+
+/** @brief Satisfied by the execution policies accepted by nc::algo functions. */
+template<class P>
+concept ExecutionPolicy = std::same_as<std::remove_cvref_t<P>, SequentialPolicy> ||
+                          std::same_as<std::remove_cvref_t<P>, ParallelPolicy>;
+
+/** @cond internal */
+namespace detail
+{
+template<class R, class Op>
+using transform_result_t = std::remove_cvref_t<std::invoke_result_t<Op&, std::ranges::range_reference_t<R>>>;
+
+template<class In, class Out, class Op>
+void TransformInto(SequentialPolicy, In& input, Out& output, Op& op)
+{
+    std::ranges::transform(input, std::ranges::begin(output), std::ref(op));
+}
+
+template<class In, class Out, class Op>
+void TransformInto(const ParallelPolicy& policy, In& input, Out& output, Op& op)
+{
+    if constexpr (std::ranges::random_access_range<In> && std::ranges::random_access_range<Out>)
+    {
+        const auto inFirst = std::ranges::begin(input);
+        const auto outFirst = std::ranges::begin(output);
+        TaskScheduler::Default().ParallelFor(static_cast<size_t>(std::ranges::size(input)), [&](size_t begin, size_t end)
+        {
+            using in_difference_t = std::ranges::range_difference_t<In>;
+            using out_difference_t = std::ranges::range_difference_t<Out>;
+            std::ranges::transform(inFirst + static_cast<in_difference_t>(begin),
+                                   inFirst + static_cast<in_difference_t>(end),
+                                   outFirst + static_cast<out_difference_t>(begin),
+                                   std::ref(op));
+        }, policy.minChunkSize, policy.maxConcurrency);
+    }
+    else
+    {
+        TransformInto(Sequential, input, output, op);
+    }
+}
+} // namespace detail
+/** @endcond internal */
+
 /** @brief Wrapper around std::transform that returns transformed data in a new vector. */
-template<class T, std::invocable<const T&> UnaryOperation>
-auto Transform(const std::vector<T>& container, UnaryOperation op)
+template<std::ranges::sized_range R, std::invocable<std::ranges::range_reference_t<const R>> UnaryOperation>
+auto Transform(const R& range, UnaryOperation op)
 {
-    using transformed_t = std::remove_cvref_t<std::invoke_result_t<UnaryOperation, const T&>>;
+    using transformed_t = detail::transform_result_t<const R, UnaryOperation>;
     auto out = std::vector<transformed_t>{};
-    out.reserve(container.size());
-    std::transform(std::cbegin(container), std::cend(container), std::back_inserter(out), op);
+    out.reserve(std::ranges::size(range));
+    std::ranges::transform(range, std::back_inserter(out), std::ref(op));
     return out;
 }
 
+/**
+ * @brief Transform a range into a new vector using an execution policy.
+ * @note Parallel execution requires the transformed type to be default constructible.
+ */
+template<ExecutionPolicy Policy, std::ranges::sized_range R, std::invocable<std::ranges::range_reference_t<const R>> UnaryOperation>
+auto Transform(const Policy& policy, const R& range, UnaryOperation op)
+{
+    using transformed_t = detail::transform_result_t<const R, UnaryOperation>;
+    if constexpr (std::same_as<Policy, ParallelPolicy>)
+    {
+        static_assert(std::default_initializable<transformed_t>, "Parallel Transform requires a default constructible result type");
+        auto out = std::vector<transformed_t>(std::ranges::size(range));
+        detail::TransformInto(policy, range, out, op);
+        return out;
+    }
+    else
+    {
+        return Transform(range, std::move(op));
+    }
+}
+
+/**
+ * @brief Transform a range into caller-provided output without allocating.
+ *
+ * Output may be a span, a preallocated container, or the input range itself to transform in place.
+ * Only the first size(input) elements of output are written.
+ */
+template<std::ranges::sized_range In,
+         std::ranges::sized_range Out,
+         std::invocable<std::ranges::range_reference_t<In>> UnaryOperation>
+    requires std::ranges::output_range<Out, std::invoke_result_t<UnaryOperation&, std::ranges::range_reference_t<In>>>
+void Transform(In&& input, Out&& output, UnaryOperation op)
+{
+    NC_ASSERT(std::ranges::size(output) >= std::ranges::size(input), "Transform output is smaller than input");
+    detail::TransformInto(Sequential, input, output, op);
+}
+
+/** @brief Transform a range into caller-provided output without allocating, using an execution policy. */
+template<ExecutionPolicy Policy,
+         std::ranges::sized_range In,
+         std::ranges::sized_range Out,
+         std::invocable<std::ranges::range_reference_t<In>> UnaryOperation>
+    requires std::ranges::output_range<Out, std::invoke_result_t<UnaryOperation&, std::ranges::range_reference_t<In>>>
+void Transform(const Policy& policy, In&& input, Out&& output, UnaryOperation op)
+{
+    NC_ASSERT(std::ranges::size(output) >= std::ranges::size(input), "Transform output is smaller than input");
+    detail::TransformInto(policy, input, output, op);
+}
+
+/** @brief Satisfied by key types accepted by RadixSort(): integers other than bool, float and double. */
+template<class K>
+concept RadixSortKey = (std::integral<K> && !std::same_as<K, bool>) ||
+                       std::same_as<K, float> ||
+                       std::same_as<K, double>;
+
+/** @cond internal */
+namespace detail
+{
+template<class R, class Proj>
+concept radix_sortable = std::ranges::contiguous_range<R> &&
+                         std::ranges::sized_range<R> &&
+                         std::permutable<std::ranges::iterator_t<R>> &&
+                         RadixSortKey<radix_key_t<std::ranges::range_value_t<R>, Proj>>;
+} // namespace detail
+/** @endcond internal */
+
+/** @brief Working memory for RadixSort(). Reusing one across calls avoids allocating once it has grown to fit. */
+template<class T>
+struct RadixSortScratch
+{
+    std::vector<T> items;
+    std::vector<size_t> counts;
+};
+
+/**
+ * @brief Stable LSD radix sort of a contiguous range in ascending order of a key.
+ *
+ * Keys are obtained from each element through proj, which is invoked several times per element and
+ * should be cheap, e.g. a pointer to a data member. Negative zero sorts before positive zero, and NaNs
+ * sort by their bit patterns at the ends of the range. Passes where all keys share a digit are skipped.
+ *
+ * @param scratch Working memory, which is only allocated when it is smaller than the range.
+ * @note Elements which aren't default constructible are copied into the scratch buffer on each call.
+ */
+template<class R, class Proj = std::identity>
+    requires detail::radix_sortable<R, Proj>
+void RadixSort(R&& items, RadixSortScratch<std::ranges::range_value_t<R>>& scratch, Proj proj = {})
+{
+    detail::RadixSortSequential(std::span<std::ranges::range_value_t<R>>{items}, scratch.items, proj);
+}
+
+/**
+ * @brief Stable LSD radix sort using an execution policy.
+ *
+ * The parallel policy splits the histogram and scatter passes of each digit across blocks of at least
+ * ParallelPolicy::minChunkSize elements.
+ */
+template<ExecutionPolicy Policy, class R, class Proj = std::identity>
+    requires detail::radix_sortable<R, Proj>
+void RadixSort(const Policy& policy, R&& items, RadixSortScratch<std::ranges::range_value_t<R>>& scratch, Proj proj = {})
+{
+    if constexpr (std::same_as<Policy, ParallelPolicy>)
+        detail::RadixSortParallel(std::span<std::ranges::range_value_t<R>>{items}, scratch.items, scratch.counts, proj, policy.minChunkSize, policy.maxConcurrency);
+    else
+        detail::RadixSortSequential(std::span<std::ranges::range_value_t<R>>{items}, scratch.items, proj);
+}
+
+/** @brief Stable LSD radix sort with temporary working memory. Prefer passing a scratch buffer in hot code. */
+template<class R, class Proj = std::identity>
+    requires detail::radix_sortable<R, Proj>
+void RadixSort(R&& items, Proj proj = {})
+{
+    auto scratch = RadixSortScratch<std::ranges::range_value_t<R>>{};
+    RadixSort(items, scratch, std::move(proj));
+}
+
+/** @brief Stable LSD radix sort using an execution policy, with temporary working memory. */
+template<ExecutionPolicy Policy, class R, class Proj = std::identity>
+    requires detail::radix_sortable<R, Proj>
+void RadixSort(const Policy& policy, R&& items, Proj proj = {})
+{
+    auto scratch = RadixSortScratch<std::ranges::range_value_t<R>>{};
+    RadixSort(policy, items, scratch, std::move(proj));
+}
+
+/** @cond internal */
+namespace detail
+{
+template<class R>
+concept scannable_range = std::ranges::random_access_range<R> && std::ranges::sized_range<R>;
+} // namespace detail
+/** @endcond internal */
+
+/**
+ * @brief Combine the elements of a range with init using op, which defaults to addition.
+ *
+ * Elements are combined out of order across several independent accumulators, which lets simple
+ * arithmetic reductions vectorize. op must be associative and commutative, so floating point results may
+ * differ slightly from a left-to-right sum.
+ */
+template<detail::scannable_range R, class T, class BinaryOperation = std::plus<>>
+    requires std::invocable<BinaryOperation&, T, std::ranges::range_reference_t<const R>>
+auto Reduce(const R& range, T init, BinaryOperation op = {}) -> T
+{
+    return detail::Reduce(range, std::move(init), op, 1, 1);
+}
+
+/** @brief Reduce a range using an execution policy. Each block is reduced in parallel, then the results are combined. */
+template<ExecutionPolicy Policy, detail::scannable_range R, class T, class BinaryOperation = std::plus<>>
+    requires std::invocable<BinaryOperation&, T, std::ranges::range_reference_t<const R>>
+auto Reduce(const Policy& policy, const R& range, T init, BinaryOperation op = {}) -> T
+{
+    if constexpr (std::same_as<Policy, ParallelPolicy>)
+        return detail::Reduce(range, std::move(init), op, policy.minChunkSize, policy.maxConcurrency);
+    else
+        return Reduce(range, std::move(init), std::move(op));
+}
+
+/**
+ * @brief Write the running totals of input to output, including each element in its own total.
+ * @note Output may be the input range itself to scan in place.
+ */
+template<detail::scannable_range In, detail::scannable_range Out, class BinaryOperation = std::plus<>>
+    requires std::ranges::output_range<Out, std::ranges::range_value_t<In>>
+void InclusiveScan(In&& input, Out&& output, BinaryOperation op = {})
+{
+    NC_ASSERT(std::ranges::size(output) >= std::ranges::size(input), "InclusiveScan output is smaller than input");
+    using value_t = std::ranges::range_value_t<In>;
+    detail::Scan<true, value_t>(input, output, std::optional<value_t>{}, op, 1, 1);
+}
+
+/**
+ * @brief Inclusive scan using an execution policy.
+ *
+ * The parallel policy reduces each block, combines the block totals, then scans each block from its
+ * starting total. op must be associative and commutative, and is invoked about twice per element.
+ */
+template<ExecutionPolicy Policy, detail::scannable_range In, detail::scannable_range Out, class BinaryOperation = std::plus<>>
+    requires std::ranges::output_range<Out, std::ranges::range_value_t<In>>
+void InclusiveScan(const Policy& policy, In&& input, Out&& output, BinaryOperation op = {})
+{
+    if constexpr (std::same_as<Policy, ParallelPolicy>)
+    {
+        NC_ASSERT(std::ranges::size(output) >= std::ranges::size(input), "InclusiveScan output is smaller than input");
+        using value_t = std::ranges::range_value_t<In>;
+        detail::Scan<true, value_t>(input, output, std::optional<value_t>{}, op, policy.minChunkSize, policy.maxConcurrency);
+    }
+    else
+    {
+        InclusiveScan(input, output, std::move(op));
+    }
+}
+
+/**
+ * @brief Write the running totals of input to output, starting from init and excluding each element from
+ *        its own total. Useful for turning per-item counts into offsets.
+ * @return The total of init and all elements, e.g. the size needed to hold every item an offset table refers to.
+ * @note Output may be the input range itself to scan in place.
+ */
+template<detail::scannable_range In, detail::scannable_range Out, class T, class BinaryOperation = std::plus<>>
+    requires std::ranges::output_range<Out, T> && std::invocable<BinaryOperation&, T, std::ranges::range_reference_t<In>>
+auto ExclusiveScan(In&& input, Out&& output, T init, BinaryOperation op = {}) -> T
+{
+    NC_ASSERT(std::ranges::size(output) >= std::ranges::size(input), "ExclusiveScan output is smaller than input");
+    return *detail::Scan<false, T>(input, output, std::optional<T>{std::move(init)}, op, 1, 1);
+}
+
+/**
+ * @brief Exclusive scan using an execution policy.
+ *
+ * The parallel policy works as for InclusiveScan(). op must be associative and commutative.
+ * @return The total of init and all elements.
+ */
+template<ExecutionPolicy Policy, detail::scannable_range In, detail::scannable_range Out, class T, class BinaryOperation = std::plus<>>
+    requires std::ranges::output_range<Out, T> && std::invocable<BinaryOperation&, T, std::ranges::range_reference_t<In>>
+auto ExclusiveScan(const Policy& policy, In&& input, Out&& output, T init, BinaryOperation op = {}) -> T
+{
+    if constexpr (std::same_as<Policy, ParallelPolicy>)
+    {
+        NC_ASSERT(std::ranges::size(output) >= std::ranges::size(input), "ExclusiveScan output is smaller than input");
+        return *detail::Scan<false, T>(input, output, std::optional<T>{std::move(init)}, op, policy.minChunkSize, policy.maxConcurrency);
+    }
+    else
+    {
+        return ExclusiveScan(input, output, std::move(init), std::move(op));
+    }
+}
+
+/**
+ * @brief Stream compaction. Copy the elements of input satisfying pred to the front of output, preserving order.
+ *
+ * Output must have room for every selected element; size(input) is always enough. Output may be the input
+ * range itself to compact in place.
+ * @return The number of elements written.
+ */
+template<detail::scannable_range In, detail::scannable_range Out, std::predicate<std::ranges::range_reference_t<In>> Pred>
+    requires std::ranges::output_range<Out, std::ranges::range_reference_t<In>>
+auto CopyIf(In&& input, Out&& output, Pred pred) -> size_t
+{
+    return detail::CopyIfSequential(input, output, pred);
+}
+
+/**
+ * @brief Stream compaction using an execution policy.
+ *
+ * The parallel policy counts selected elements per block, scans the counts into write offsets, then
+ * copies each block into its own region of output. pred is invoked twice per element and output must
+ * not overlap input.
+ * @return The number of elements written.
+ */
+template<ExecutionPolicy Policy, detail::scannable_range In, detail::scannable_range Out, std::predicate<std::ranges::range_reference_t<In>> Pred>
+    requires std::ranges::output_range<Out, std::ranges::range_reference_t<In>>
+auto CopyIf(const Policy& policy, In&& input, Out&& output, Pred pred) -> size_t
+{
+    if constexpr (std::same_as<Policy, ParallelPolicy>)
+        return detail::CopyIfParallel(input, output, pred, policy.minChunkSize, policy.maxConcurrency);
+    else
+        return detail::CopyIfSequential(input, output, pred);
+}
+
 /** @brief Implementation of std::enumerate. Obtain a view of [index, value] pairs from a range. */
 inline detail::enumerate_view_fn Enumerate;
+
+/**
+ * @brief Implementation of std::views::chunk. Obtain a view of consecutive subranges of n elements from a
+ *        forward range, with a shorter final chunk if needed. Use as Chunk(range, n) or range | Chunk(n).
+ * @note Chunks of contiguous ranges are contiguous, so loops over each chunk remain vectorizable.
+ */
+inline detail::chunk_view_fn Chunk;
+
+/**
+ * @brief Implementation of std::views::stride. Obtain a view of every nth element of a forward range,
+ *        starting with the first. Use as Stride(range, n) or range | Stride(n).
+ */
+inline detail::stride_view_fn Stride;
+
+/**
+ * @brief Implementation of std::views::zip. Obtain a view of tuples of references to corresponding
+ *        elements of each range, ending with the shortest range. Useful for walking SoA columns together.
+ */
+inline detail::zip_view_fn Zip;
+
+/**
+ * @brief Implementation of std::views::adjacent. Obtain a view of tuples of references to each window of
+ *        N consecutive elements of a forward range. Use as Adjacent<N>(range) or range | Adjacent<N>.
+ */
+template<size_t N>
+inline detail::adjacent_view_fn<N> Adjacent;
 } // namespace nc::algo
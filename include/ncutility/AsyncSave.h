@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ncutility/Compression.h"
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iosfwd>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nc
+{
+/**
+ * @brief Saves snapshots to disk on a background thread.
+ *
+ * Save() runs the provided write function on the calling thread to snapshot data into one of two
+ * reusable buffers, then returns. A worker thread compresses the snapshot with nc::Compress() and
+ * writes it to a temporary file which replaces the destination once complete, so a partially written
+ * save never overwrites a good one. With two buffers, a new snapshot can be taken while the previous
+ * one is still being flushed. Save() only blocks if both buffers are in flight.
+ *
+ * Files are read back with nc::LoadSaveFile().
+ *
+ * @note Saves are written in the order they were submitted. The destructor waits for pending saves.
+ */
+class AsyncSaver
+{
+    public:
+        /** @brief The number of snapshot buffers, bounding the number of saves in flight. */
+        static constexpr size_t BufferCount = 2ull;
+
+        explicit AsyncSaver(CompressionLevel level = CompressionLevel::Fast);
+        ~AsyncSaver() noexcept;
+
+        AsyncSaver(AsyncSaver&&) = delete;
+        AsyncSaver(const AsyncSaver&) = delete;
+        void operator=(const AsyncSaver&) = delete;
+        void operator=(AsyncSaver&&) = delete;
+
+        /**
+         * @brief Snapshot data with write, then compress and write it to path in the background.
+         * @param path The destination file.
+         * @param write Writes the data to save to the provided stream, e.g. with nc::serialize::Serialize().
+         * @return A future which becomes ready once the file is written, holding any NcError raised in
+         *         the background. Exceptions thrown by write propagate from Save() directly.
+         */
+        auto Save(const std::filesystem::path& path, const std::function<void(std::ostream&)>& write) -> std::future<void>;
+
+        /** @brief Block until all submitted saves are complete. */
+        void Wait();
+
+    private:
+        struct Job
+        {
+            std::filesystem::path path;
+            size_t buffer;
+            std::promise<void> promise;
+        };
+
+        std::array<std::vector<char>, BufferCount> m_buffers;
+        std::array<bool, BufferCount> m_busy;
+        std::deque<Job> m_jobs;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        CompressionLevel m_level;
+        bool m_stopping;
+        std::thread m_worker;
+
+        void Run();
+        void Write(const Job& job) const;
+};
+
+/**
+ * @brief Read and decompress a file written by nc::AsyncSaver.
+ * @return The data written by the save's write function.
+ * @throw NcError if the file can't be read or isn't a valid save.
+ */
+auto LoadSaveFile(const std::filesystem::path& path) -> std::vector<char>;
+} // namespace nc
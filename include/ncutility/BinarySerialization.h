@@ -10,6 +10,9 @@
     #error "BinarySerialization.h is currently unsupported on macOS."
 #endif
 
+#include "ncutility/detail/ChunkedSerializationDetail.h"
+#include "ncutility/detail/ColumnarSerializationDetail.h"
+#include "ncutility/detail/DeltaSerializationDetail.h"
 #include "ncutility/detail/SerializeCpo.h"
 
 namespace nc::serialize
@@ -34,9 +37,29 @@ namespace nc::serialize
  * 
  * The following are supported by the overloads from number 3:
  *   - Trivially copyable types
- *   - Stl types: string, array, vector, unordered_map, pair, and optional
- *   - Aggregates with <= 16 members, each satisfying at least one
+ *   - Stl types: string, array, vector, deque, map, set, unordered_map, unordered_set,
+ *     pair, tuple, optional, and variant
+ *   - nc::Blob, encoded identically to std::vector<char>
+ *   - Aggregates with <= 64 members, each satisfying at least one
  *     of the above requirements
+ *
+ * Containers with custom allocators, hashers, and comparators (e.g. std::pmr) are supported. Input
+ * from untrusted sources can be bounded by attaching a nc::serialize::DeserializationContext to the
+ * stream.
+ *
+ * Multi-byte values are written in the stream's byte order, which is the host's unless set with
+ * SetByteOrder() or WriteFormatHeader(). Data read with ReadFormatHeader() is converted only when it
+ * was written with a byte order other than the host's.
+ *
+ * Deserialize assigns into the existing object rather than appending to it. Existing container
+ * elements, string capacity, and map nodes are reused where possible, so repeatedly deserializing
+ * into the same long-lived object avoids reallocating once it has reached a steady-state size.
+ *
+ * Both also accept a nc::serialize::BitWriter or BitReader in place of the stream, resolving in the
+ * same order to functions taking `BitWriter&`/`BitReader&`. The internal bit encoding supports bools,
+ * arithmetic types and enums at full width, Ranged and Quantized values using their declared bit
+ * budgets, std::array, std::optional, std::vector, std::string, and aggregates of these. Aggregates
+ * declare per-member budgets by using Ranged and Quantized members.
  */
 inline constexpr nc::serialize::cpo::SerializeFn Serialize;
 
@@ -46,6 +69,206 @@ inline constexpr nc::serialize::cpo::SerializeFn Serialize;
  */
 inline constexpr nc::serialize::cpo::DeserializeFn Deserialize;
 
+/**
+ * @brief Get the number of bytes Serialize() will write for an object.
+ *
+ * SerializedSize is a function object with call signature:
+ *     `size_t SerializedSize(const T&)`
+ *
+ * Resolution mirrors Serialize, with the first valid expression among:
+ *   1. A non-static member function with the signature:
+ *        `size_t T::SerializedSize() const`
+ *   2. A non-member function found via adl with the signature:
+ *        `size_t SerializedSize(const T&)`
+ *   3. The internal implementation, only when Serialize also resolves to the internal implementation.
+ *
+ * Types providing their own Serialize must provide a matching SerializedSize to be sized. Containers
+ * of fixed size elements are sized in constant time, allowing an output buffer to be allocated
+ * exactly once before serializing.
+ */
+inline constexpr nc::serialize::cpo::SerializedSizeFn SerializedSize;
+
+/**
+ * @brief Get the number of bytes Serialize() will write for any object of type T.
+ * @note Only available for types whose encoding doesn't depend on their value, such as trivially
+ *       copyable types, std::array and std::pair of such types, and aggregates composed of them.
+ */
+template<class T>
+    requires nc::serialize::binary::FixedSize<T>
+consteval auto FixedSerializedSize() -> size_t
+{
+    return nc::serialize::binary::FixedSerializedSize<T>();
+}
+
+/**
+ * @brief Get the number of bits Serialize() will write to a BitWriter for any object of type T.
+ * @note Only available for types whose bit encoding doesn't depend on their value.
+ */
+template<class T>
+    requires (nc::serialize::bits::FixedBitCount<T>() != nc::serialize::bits::g_variableBitCount)
+consteval auto FixedBitCount() -> size_t
+{
+    return nc::serialize::bits::FixedBitCount<T>();
+}
+
+/**
+ * @brief Serialize a range of aggregates in columnar (struct of arrays) order.
+ *
+ * Each member is written as a contiguous column, encoded identically to a `std::vector` of that
+ * member's type. Columns of trivially copyable members are written in bulk, and grouping like data
+ * together typically improves the ratio achieved by nc::Compress(). Because each column is a valid
+ * vector encoding, readers with struct of arrays storage may deserialize columns directly, e.g.
+ * `binary::DeserializeMultiple(stream, positions, velocities)`.
+ *
+ * @note Supports aggregates with 1 to g_aggregateMaxMemberCount members, whether or not they are
+ *       trivially copyable. Members are written using the default encoding for their type.
+ */
+template<std::ranges::sized_range R>
+    requires nc::serialize::binary::ColumnarAggregate<std::ranges::range_value_t<R>>
+void SerializeColumnar(std::ostream& stream, const R& objects)
+{
+    nc::serialize::binary::SerializeColumnar(stream, objects);
+}
+
+/**
+ * @brief Deserialize aggregates written with SerializeColumnar().
+ * @note Existing elements of `objects` are reused, as with Deserialize().
+ */
+template<nc::serialize::binary::ColumnarAggregate T>
+void DeserializeColumnar(std::istream& stream, std::vector<T>& objects)
+{
+    nc::serialize::binary::DeserializeColumnar(stream, objects);
+}
+
+/**
+ * @brief Serialize a vector as independently decodable chunks, encoding chunks in parallel.
+ *
+ * Elements are split into fixed size chunks, each written with the element type's default encoding,
+ * and preceded by a table of chunk offsets. Output is identical for any thread count. This is a
+ * separate encoding from Serialize(), intended for very large containers of non-trivial elements where
+ * per-element serialization dominates.
+ *
+ * @param threadCount The maximum number of threads to use, or 0 to use all threads of TaskScheduler::Default().
+ * @param scratch The resource for temporary chunk buffers, e.g. an nc::ArenaResource. Access is
+ *        serialized internally, so it needn't be thread safe.
+ */
+template<class T, class Alloc>
+void SerializeChunked(std::ostream& stream,
+                      const std::vector<T, Alloc>& in,
+                      size_t threadCount = 0,
+                      std::pmr::memory_resource* scratch = std::pmr::get_default_resource())
+{
+    nc::serialize::binary::SerializeChunked(stream, in, threadCount, scratch);
+}
+
+/**
+ * @brief Deserialize a vector written with SerializeChunked(), decoding chunks in parallel.
+ * @param threadCount The maximum number of threads to use, or 0 to use all threads of TaskScheduler::Default().
+ * @param scratch The resource for the temporary chunk table and payload copy, e.g. an nc::ArenaResource.
+ *        Only used from the calling thread.
+ * @throw NcError if the offset table or any chunk does not match the stream contents.
+ * @note Limits from an attached DeserializationContext apply to the chunk table and payload as a whole,
+ *       and each chunk is checked against the remaining allocation budget.
+ */
+template<class T, class Alloc>
+void DeserializeChunked(std::istream& stream,
+                        std::vector<T, Alloc>& out,
+                        size_t threadCount = 0,
+                        std::pmr::memory_resource* scratch = std::pmr::get_default_resource())
+{
+    nc::serialize::binary::DeserializeChunked(stream, out, threadCount, scratch);
+}
+
+/**
+ * @brief Serialize the members of an aggregate which differ from a baseline.
+ *
+ * Writes a mask with one bit per member, set for each member of `current` which differs from
+ * `baseline`, followed by only those members in declaration order. Members are compared with
+ * operator== where available, and are written with Serialize(), so members may use custom overloads.
+ * The mask occupies one bit per member with a BitWriter and one byte per 8 members with a byte stream.
+ *
+ * @return True if any member changed. An unchanged object is encoded as just the empty mask.
+ * @note Supports aggregates with 1 to 64 members. The reader must hold the same baseline.
+ */
+template<class T>
+    requires nc::serialize::binary::DeltaAggregate<T>
+auto SerializeDelta(std::ostream& stream, const T& baseline, const T& current) -> bool
+{
+    return nc::serialize::binary::SerializeDelta(stream, baseline, current);
+}
+
+/** @copydoc SerializeDelta(std::ostream&, const T&, const T&) */
+template<class T>
+    requires nc::serialize::binary::DeltaAggregate<T>
+auto SerializeDelta(BitWriter& writer, const T& baseline, const T& current) -> bool
+{
+    return nc::serialize::binary::SerializeDelta(writer, baseline, current);
+}
+
+/**
+ * @brief Apply a delta written with SerializeDelta() to an object holding the baseline.
+ * @throw NcError if the mask sets bits beyond the aggregate's member count.
+ */
+template<class T>
+    requires nc::serialize::binary::DeltaAggregate<T>
+void DeserializeDelta(std::istream& stream, T& object)
+{
+    nc::serialize::binary::DeserializeDelta(stream, object);
+}
+
+/** @copydoc DeserializeDelta(std::istream&, T&) */
+template<class T>
+    requires nc::serialize::binary::DeltaAggregate<T>
+void DeserializeDelta(BitReader& reader, T& object)
+{
+    nc::serialize::binary::DeserializeDelta(reader, object);
+}
+
+/** @brief Identifies the header written by WriteFormatHeader(). */
+inline constexpr std::array<char, 4> g_formatHeaderMagic{'N', 'C', 'S', 'B'};
+
+/** @brief The version of the header written by WriteFormatHeader(). */
+inline constexpr uint8_t g_formatHeaderVersion = 1u;
+
+/**
+ * @brief Write a header recording the byte order of the data that follows, and set the stream to use it.
+ *
+ * The header is 6 bytes: g_formatHeaderMagic, g_formatHeaderVersion, and the ByteOrder. The default
+ * portable byte order is little-endian, so writing portable data is free on little-endian hosts.
+ */
+inline void WriteFormatHeader(std::ostream& stream, ByteOrder order = g_portableByteOrder)
+{
+    stream.write(g_formatHeaderMagic.data(), static_cast<std::streamsize>(g_formatHeaderMagic.size()));
+    const char info[] = {static_cast<char>(g_formatHeaderVersion), static_cast<char>(order)};
+    stream.write(info, sizeof(info));
+    SetByteOrder(stream, order);
+}
+
+/**
+ * @brief Read a header written with WriteFormatHeader() and set the stream to the recorded byte order.
+ *
+ * Data whose byte order matches the host's is read without conversion.
+ *
+ * @return The byte order of the data following the header.
+ * @throw NcError if the header is missing or has an unknown version or byte order.
+ */
+inline auto ReadFormatHeader(std::istream& stream) -> ByteOrder
+{
+    auto magic = std::array<char, 4>{};
+    unsigned char info[2] = {};
+    stream.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    stream.read(reinterpret_cast<char*>(info), sizeof(info));
+    if (!stream || magic != g_formatHeaderMagic)
+        throw NcError("Stream does not begin with a serialization header.");
+
+    const auto order = static_cast<ByteOrder>(info[1]);
+    if (info[0] != g_formatHeaderVersion || (order != ByteOrder::Little && order != ByteOrder::Big))
+        throw NcError("Unsupported serialization header.", fmt::format("version: {}, byte order: {}", info[0], info[1]));
+
+    SetByteOrder(stream, order);
+    return order;
+}
+
 /** @brief The maximum number of members an aggregate may have for default serialization. */
-inline constexpr size_t g_aggregateMaxMemberCount = 16ull;
+inline constexpr size_t g_aggregateMaxMemberCount = 64ull;
 } // namespace nc::seriazlize
@@ -0,0 +1,361 @@
+#pragma once
+
+#include "ncutility/ByteOrder.h"
+#include "ncutility/NcError.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace nc::serialize
+{
+/** @cond internal */
+namespace detail
+{
+template<class T>
+concept RangedValue = std::integral<T> || std::is_enum_v<T>;
+
+// Get the offset of value from min as an unsigned integer, without signed overflow.
+template<RangedValue T>
+constexpr auto RangeOffset(T value, T min) -> uint64_t
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        return RangeOffset(static_cast<std::underlying_type_t<T>>(value), static_cast<std::underlying_type_t<T>>(min));
+    }
+    else
+    {
+        using unsigned_t = std::make_unsigned_t<T>;
+        return static_cast<uint64_t>(static_cast<unsigned_t>(static_cast<unsigned_t>(value) - static_cast<unsigned_t>(min)));
+    }
+}
+
+// Inverse of RangeOffset().
+template<RangedValue T>
+constexpr auto FromRangeOffset(uint64_t offset, T min) -> T
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        return static_cast<T>(FromRangeOffset(offset, static_cast<std::underlying_type_t<T>>(min)));
+    }
+    else
+    {
+        using unsigned_t = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<unsigned_t>(static_cast<unsigned_t>(min) + static_cast<unsigned_t>(offset)));
+    }
+}
+
+template<RangedValue T>
+constexpr auto ToUnderlying(T value)
+{
+    if constexpr (std::is_enum_v<T>)
+        return static_cast<std::underlying_type_t<T>>(value);
+    else
+        return value;
+}
+
+constexpr auto LowBitMask(uint32_t bitCount) -> uint64_t
+{
+    return bitCount >= 64u ? ~uint64_t{0} : (uint64_t{1} << bitCount) - 1u;
+}
+} // namespace detail
+/** @endcond internal */
+
+/** @brief Get the number of bits needed to encode any value in [min, max]. */
+template<detail::RangedValue T>
+constexpr auto RangeBitCount(T min, T max) -> uint32_t
+{
+    return static_cast<uint32_t>(std::bit_width(detail::RangeOffset(max, min)));
+}
+
+/**
+ * @brief Writes values to a buffer with bit granularity.
+ *
+ * Bits are accumulated in a 64 bit scratch word and appended to the buffer 32 bits at a time, least
+ * significant bit first. The output is independent of host endianness.
+ */
+class BitWriter
+{
+    public:
+        /** @brief Write the low bitCount bits of value. bitCount must be in [0, 64]. */
+        void WriteBits(uint64_t value, uint32_t bitCount)
+        {
+            NC_ASSERT(bitCount <= 64u, "BitWriter bit count out of range");
+            if (bitCount > 32u)
+            {
+                WriteBitsImpl(value & 0xFFFFFFFFull, 32u);
+                WriteBitsImpl((value >> 32u) & detail::LowBitMask(bitCount - 32u), bitCount - 32u);
+            }
+            else
+            {
+                WriteBitsImpl(value & detail::LowBitMask(bitCount), bitCount);
+            }
+        }
+
+        /** @brief Write a bool as a single bit. */
+        void WriteBool(bool value)
+        {
+            WriteBitsImpl(value ? 1u : 0u, 1u);
+        }
+
+        /** @brief Write a value known to be in [min, max] using RangeBitCount(min, max) bits. */
+        template<detail::RangedValue T>
+        void WriteRanged(T value, T min, T max)
+        {
+            NC_ASSERT(detail::RangeOffset(value, min) <= detail::RangeOffset(max, min), "BitWriter value out of range");
+            WriteBits(detail::RangeOffset(value, min), RangeBitCount(min, max));
+        }
+
+        /**
+         * @brief Write a float clamped to [min, max] and quantized to bitCount bits. bitCount must be in [1, 32].
+         * @note NaN is written as min.
+         */
+        void WriteQuantized(float value, float min, float max, uint32_t bitCount)
+        {
+            NC_ASSERT(bitCount > 0u && bitCount <= 32u && min < max, "Invalid BitWriter quantization");
+            const auto steps = static_cast<double>(detail::LowBitMask(bitCount));
+            const auto clamped = std::isnan(value) ? min : std::clamp(value, min, max);
+            const auto normalized = (static_cast<double>(clamped) - min) / (static_cast<double>(max) - min);
+
+            // llround rather than lround, as long is 32 bits on some platforms and 32 bit steps overflow it.
+            WriteBitsImpl(static_cast<uint64_t>(std::llround(normalized * steps)), bitCount);
+        }
+
+        /** @brief Write an unsigned integer in groups of 7 bits, each followed by a continuation bit. */
+        void WriteVarUint(uint64_t value)
+        {
+            while (value >= 0x80u)
+            {
+                WriteBitsImpl((value & 0x7Fu) | 0x80u, 8u);
+                value >>= 7u;
+            }
+
+            WriteBitsImpl(value, 8u);
+        }
+
+        /** @brief Get the number of bits written. */
+        auto BitCount() const noexcept -> size_t
+        {
+            return m_bytes.size() * 8u + m_scratchBits;
+        }
+
+        /** @brief Pad to a whole byte, then return the written bytes and reset the writer. */
+        auto Finish() -> std::vector<uint8_t>
+        {
+            while (m_scratchBits > 0u)
+            {
+                m_bytes.push_back(static_cast<uint8_t>(m_scratch));
+                m_scratch >>= 8u;
+                m_scratchBits = m_scratchBits > 8u ? m_scratchBits - 8u : 0u;
+            }
+
+            m_scratch = 0u;
+            return std::exchange(m_bytes, std::vector<uint8_t>{});
+        }
+
+    private:
+        std::vector<uint8_t> m_bytes;
+        uint64_t m_scratch = 0u;
+        uint32_t m_scratchBits = 0u;
+
+        // Requires bitCount <= 32 and no bits set above bitCount.
+        void WriteBitsImpl(uint64_t value, uint32_t bitCount)
+        {
+            m_scratch |= value << m_scratchBits;
+            m_scratchBits += bitCount;
+            if (m_scratchBits >= 32u)
+            {
+                const auto word = static_cast<uint32_t>(m_scratch);
+                const auto offset = m_bytes.size();
+                m_bytes.resize(offset + sizeof(word));
+                if constexpr (std::endian::native == std::endian::little)
+                {
+                    std::memcpy(m_bytes.data() + offset, &word, sizeof(word));
+                }
+                else
+                {
+                    for (auto i = 0u; i < sizeof(word); ++i)
+                        m_bytes[offset + i] = static_cast<uint8_t>(word >> (8u * i));
+                }
+
+                m_scratch >>= 32u;
+                m_scratchBits -= 32u;
+            }
+        }
+};
+
+/**
+ * @brief Reads values written by a BitWriter.
+ * @note Reading past the end of the data throws an NcError, as does reading a ranged value outside of
+ *       its range, so corrupt or malicious input is detected rather than producing unbounded values.
+ */
+class BitReader
+{
+    public:
+        explicit BitReader(std::span<const uint8_t> data) noexcept
+            : m_data{data}
+        {
+        }
+
+        /** @brief Read bitCount bits. bitCount must be in [0, 64]. */
+        auto ReadBits(uint32_t bitCount) -> uint64_t
+        {
+            NC_ASSERT(bitCount <= 64u, "BitReader bit count out of range");
+            if (bitCount > 32u)
+            {
+                const auto low = ReadBitsImpl(32u);
+                return low | (ReadBitsImpl(bitCount - 32u) << 32u);
+            }
+
+            return ReadBitsImpl(bitCount);
+        }
+
+        /** @brief Read a bool written with BitWriter::WriteBool(). */
+        auto ReadBool() -> bool
+        {
+            return ReadBitsImpl(1u) != 0u;
+        }
+
+        /** @brief Read a value written with BitWriter::WriteRanged(). */
+        template<detail::RangedValue T>
+        auto ReadRanged(T min, T max) -> T
+        {
+            const auto offset = ReadBits(RangeBitCount(min, max));
+            if (offset > detail::RangeOffset(max, min))
+                throw NcError("BitReader ranged value out of range.");
+
+            return detail::FromRangeOffset(offset, min);
+        }
+
+        /** @brief Read a value written with BitWriter::WriteQuantized(). */
+        auto ReadQuantized(float min, float max, uint32_t bitCount) -> float
+        {
+            NC_ASSERT(bitCount > 0u && bitCount <= 32u && min < max, "Invalid BitReader quantization");
+            const auto steps = static_cast<double>(detail::LowBitMask(bitCount));
+            const auto normalized = static_cast<double>(ReadBitsImpl(bitCount)) / steps;
+            return static_cast<float>(min + normalized * (static_cast<double>(max) - min));
+        }
+
+        /** @brief Read a value written with BitWriter::WriteVarUint(). */
+        auto ReadVarUint() -> uint64_t
+        {
+            auto value = uint64_t{0};
+            for (auto shift = 0u; shift < 64u; shift += 7u)
+            {
+                const auto group = ReadBitsImpl(8u);
+                value |= (group & 0x7Fu) << shift;
+                if ((group & 0x80u) == 0u)
+                    return value;
+            }
+
+            throw NcError("BitReader variable length integer is too long.");
+        }
+
+        /** @brief Get the number of bits that may still be read. */
+        auto BitsRemaining() const noexcept -> size_t
+        {
+            return (m_data.size() - m_position) * 8u + m_scratchBits;
+        }
+
+    private:
+        std::span<const uint8_t> m_data;
+        size_t m_position = 0u;
+        uint64_t m_scratch = 0u;
+        uint32_t m_scratchBits = 0u;
+
+        // Requires bitCount <= 32.
+        auto ReadBitsImpl(uint32_t bitCount) -> uint64_t
+        {
+            if (m_scratchBits < bitCount)
+                Refill(bitCount);
+
+            const auto value = m_scratch & detail::LowBitMask(bitCount);
+            m_scratch >>= bitCount;
+            m_scratchBits -= bitCount;
+            return value;
+        }
+
+        void Refill(uint32_t bitCount)
+        {
+            const auto available = m_data.size() - m_position;
+            if (available >= sizeof(uint32_t))
+            {
+                auto word = uint32_t{};
+                if constexpr (std::endian::native == std::endian::little)
+                {
+                    std::memcpy(&word, m_data.data() + m_position, sizeof(word));
+                }
+                else
+                {
+                    for (auto i = 0u; i < sizeof(word); ++i)
+                        word |= static_cast<uint32_t>(m_data[m_position + i]) << (8u * i);
+                }
+
+                m_scratch |= static_cast<uint64_t>(word) << m_scratchBits;
+                m_scratchBits += 32u;
+                m_position += sizeof(word);
+                return;
+            }
+
+            while (m_scratchBits < bitCount && m_position < m_data.size())
+            {
+                m_scratch |= static_cast<uint64_t>(m_data[m_position++]) << m_scratchBits;
+                m_scratchBits += 8u;
+            }
+
+            if (m_scratchBits < bitCount)
+                throw NcError("BitReader read past the end of the data.");
+        }
+};
+
+/**
+ * @brief An integral or enum member known to lie in [Min, Max].
+ *
+ * Bit serialization writes RangeBitCount(Min, Max) bits, while byte serialization writes the full value.
+ */
+template<detail::RangedValue T, T Min, T Max>
+    requires (detail::ToUnderlying(Min) <= detail::ToUnderlying(Max))
+struct Ranged
+{
+    T value = Min;
+
+    constexpr Ranged() = default;
+    constexpr Ranged(T v) : value{v} {}
+    constexpr operator T() const { return value; }
+    auto operator<=>(const Ranged&) const = default;
+};
+
+/**
+ * @brief A float member quantized to Bits bits over [Min, Max] by bit serialization.
+ *
+ * Bit serialization clamps the value to [Min, Max], while byte serialization writes the full value.
+ */
+template<float Min, float Max, uint32_t Bits>
+    requires (Min < Max && Bits > 0u && Bits <= 32u)
+struct Quantized
+{
+    float value = Min;
+
+    constexpr Quantized() = default;
+    constexpr Quantized(float v) : value{v} {}
+    constexpr operator float() const { return value; }
+    auto operator<=>(const Quantized&) const = default;
+
+    /** @brief The largest difference between a value in range and its decoded value. */
+    static constexpr auto Precision = (Max - Min) / static_cast<float>(detail::LowBitMask(Bits)) * 0.5f;
+};
+
+/** @cond internal */
+template<detail::RangedValue T, T Min, T Max>
+struct UniformScalarLayout<Ranged<T, Min, Max>> { static constexpr size_t ScalarSize = sizeof(T); };
+
+template<float Min, float Max, uint32_t Bits>
+struct UniformScalarLayout<Quantized<Min, Max, Bits>> { static constexpr size_t ScalarSize = sizeof(float); };
+/** @endcond internal */
+} // namespace nc::serialize
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "ncutility/NcError.h"
+#include "ncutility/detail/StreamBufferDetail.h"
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nc
+{
+/**
+ * @brief A reference counted, immutable range of bytes.
+ *
+ * Copying a Blob shares the underlying storage, so blobs can be passed between threads and through
+ * queues without copying data. Vectors returned from nc::Compress(), nc::Decompress(), and other
+ * functions producing bytes are adopted by a Blob without copying. Slices reference a sub-range of
+ * their parent and keep its storage alive.
+ *
+ * The data of a Blob which isn't a slice is aligned to at least Blob::Alignment.
+ *
+ * @note Blob is a contiguous range of const char, so it converts to std::span<const char> and may be
+ *       passed to any function accepting one.
+ */
+class Blob
+{
+    public:
+        using value_type = char;
+        using size_type = size_t;
+        using const_iterator = const char*;
+        using iterator = const_iterator;
+
+        /** @brief The minimum alignment of the data of a Blob which isn't a slice. */
+        static constexpr size_t Alignment = alignof(std::max_align_t);
+
+        /** @brief Create an empty blob. */
+        Blob() noexcept = default;
+
+        /** @brief Take ownership of a vector's storage without copying. */
+        Blob(std::vector<char>&& bytes)
+        {
+            if (!bytes.empty())
+            {
+                m_owner = std::make_shared<std::vector<char>>(std::move(bytes));
+                m_data = m_owner->data();
+                m_size = m_owner->size();
+            }
+        }
+
+        /** @brief Create a blob holding a copy of bytes. */
+        static auto Copy(std::span<const char> bytes) -> Blob
+        {
+            return Blob{std::vector<char>(bytes.begin(), bytes.end())};
+        }
+
+        /**
+         * @brief Get a blob referencing a sub-range of this one, which keeps the storage alive.
+         * @param offset The position of the first byte of the slice.
+         * @param count The number of bytes in the slice, or std::dynamic_extent for the remainder.
+         * @throw NcError if the range exceeds the blob.
+         */
+        auto Slice(size_t offset, size_t count = std::dynamic_extent) const -> Blob
+        {
+            if (offset > m_size || (count != std::dynamic_extent && count > m_size - offset))
+                throw NcError("Blob slice out of range.", fmt::format("offset: {}, count: {}, size: {}", offset, count, m_size));
+
+            const auto sliceSize = count == std::dynamic_extent ? m_size - offset : count;
+            return sliceSize == 0 ? Blob{} : Blob{m_owner, m_data + offset, sliceSize};
+        }
+
+        /**
+         * @brief Move the bytes out of the blob, leaving it empty.
+         *
+         * The storage is moved without copying when this blob is the only reference to a vector it
+         * adopted, and isn't a slice. Otherwise the bytes are copied.
+         */
+        auto Release() -> std::vector<char>
+        {
+            auto out = std::vector<char>{};
+            if (m_owner.use_count() == 1 && m_data == m_owner->data() && m_size == m_owner->size())
+                out = std::move(*m_owner);
+            else
+                out.assign(m_data, m_data + m_size);
+
+            *this = Blob{};
+            return out;
+        }
+
+        /** @brief Get the number of blobs sharing this blob's storage. */
+        auto UseCount() const noexcept -> long { return m_owner.use_count(); }
+
+        auto data() const noexcept -> const char* { return m_data; }
+        auto size() const noexcept -> size_t { return m_size; }
+        auto empty() const noexcept -> bool { return m_size == 0; }
+        auto begin() const noexcept -> const char* { return m_data; }
+        auto end() const noexcept -> const char* { return m_data + m_size; }
+        auto operator[](size_t index) const noexcept -> char { return m_data[index]; }
+
+    private:
+        std::shared_ptr<std::vector<char>> m_owner;
+        const char* m_data = nullptr;
+        size_t m_size = 0;
+
+        Blob(std::shared_ptr<std::vector<char>> owner, const char* data, size_t size)
+            : m_owner{std::move(owner)}, m_data{data}, m_size{size}
+        {
+        }
+};
+
+/**
+ * @brief An input stream reading from a Blob, which is kept alive by the stream.
+ *
+ * Allows data held by a Blob to be passed directly to nc::serialize::Deserialize() without copying.
+ */
+class BlobReader : public std::istream
+{
+    public:
+        explicit BlobReader(Blob blob)
+            : std::istream{nullptr}, m_blob{std::move(blob)}, m_buffer{m_blob}
+        {
+            rdbuf(&m_buffer);
+        }
+
+    private:
+        Blob m_blob;
+        detail::SpanReadBuffer m_buffer;
+};
+
+/**
+ * @brief An output stream collecting written bytes into a Blob.
+ *
+ * Allows the output of nc::serialize::Serialize() to be handed off as a Blob without copying.
+ */
+class BlobWriter : public std::ostream
+{
+    public:
+        /** @param reserve The number of bytes to preallocate, e.g. from nc::serialize::SerializedSize(). */
+        explicit BlobWriter(size_t reserve = 0)
+            : std::ostream{nullptr}, m_bytes{}, m_buffer{m_bytes}
+        {
+            m_bytes.reserve(reserve);
+            rdbuf(&m_buffer);
+        }
+
+        /** @brief Take the bytes written so far as a Blob, leaving the writer empty. */
+        auto Take() -> Blob
+        {
+            return Blob{std::exchange(m_bytes, std::vector<char>{})};
+        }
+
+    private:
+        std::vector<char> m_bytes;
+        detail::VectorWriteBuffer<> m_buffer;
+};
+
+/**
+ * @brief An output stream collecting written bytes into memory from a std::pmr::memory_resource.
+ *
+ * Allows nc::serialize::Serialize() to write scratch data, e.g. a network message built each frame,
+ * into an nc::ArenaResource or nc::FrameAllocator arena instead of the global heap.
+ */
+class BufferWriter : public std::ostream
+{
+    public:
+        /**
+         * @param resource The resource to allocate from. Must outlive the writer and any taken bytes.
+         * @param reserve The number of bytes to preallocate, e.g. from nc::serialize::SerializedSize().
+         */
+        explicit BufferWriter(std::pmr::memory_resource* resource, size_t reserve = 0)
+            : std::ostream{nullptr}, m_bytes{resource}, m_buffer{m_bytes}
+        {
+            m_bytes.reserve(reserve);
+            rdbuf(&m_buffer);
+        }
+
+        /** @brief Get the bytes written so far. */
+        auto Bytes() const noexcept -> std::span<const char> { return m_bytes; }
+
+        /** @brief Take the bytes written so far, leaving the writer empty. */
+        auto Take() -> std::pmr::vector<char>
+        {
+            return std::exchange(m_bytes, std::pmr::vector<char>{m_bytes.get_allocator()});
+        }
+
+    private:
+        std::pmr::vector<char> m_bytes;
+        detail::VectorWriteBuffer<std::pmr::vector<char>> m_buffer;
+};
+
+/**
+ * @brief An input stream reading from memory it doesn't own.
+ *
+ * The counterpart to BufferWriter, allowing bytes in an arena, or any other buffer, to be passed to
+ * nc::serialize::Deserialize() without copying them into a Blob. The bytes must outlive the reader.
+ */
+class BufferReader : public std::istream
+{
+    public:
+        explicit BufferReader(std::span<const char> bytes)
+            : std::istream{nullptr}, m_buffer{bytes}
+        {
+            rdbuf(&m_buffer);
+        }
+
+    private:
+        detail::SpanReadBuffer m_buffer;
+};
+} // namespace nc
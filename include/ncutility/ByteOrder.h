@@ -0,0 +1,68 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+
+namespace nc::serialize
+{
+/** @brief The byte order of multi-byte values written by nc::serialize::Serialize(). */
+enum class ByteOrder : uint8_t
+{
+    Little = 1,
+    Big = 2
+};
+
+/** @brief The byte order of the host. */
+inline constexpr auto g_nativeByteOrder = std::endian::native == std::endian::little ? ByteOrder::Little : ByteOrder::Big;
+
+/** @brief The byte order used for portable data, which is a no-op on little-endian hosts. */
+inline constexpr auto g_portableByteOrder = ByteOrder::Little;
+
+/**
+ * @brief Opts a trivially copyable class without visible members into byte order conversion.
+ *
+ * Specialize with a nonzero ScalarSize to declare that T holds only arithmetic or enum values of
+ * ScalarSize bytes, with no padding, e.g. 4 for nc::Vector3. Each ScalarSize bytes of the object are
+ * then reversed when converting. Aggregates are converted member-wise and don't need a specialization.
+ */
+template<class T>
+struct UniformScalarLayout
+{
+    static constexpr size_t ScalarSize = 0;
+};
+
+/** @cond internal */
+namespace detail
+{
+inline auto ByteOrderIndex() -> int
+{
+    static const auto index = std::ios_base::xalloc();
+    return index;
+}
+} // namespace detail
+/** @endcond internal */
+
+/**
+ * @brief Set the byte order used when (de)serializing with a stream.
+ *
+ * Streams use the host byte order unless set otherwise. When the byte order differs from the host's,
+ * scalars are byteswapped as they are written or read. Trivially copyable aggregates are swapped
+ * member-wise, and aggregates with bases or C-array members are swapped when all of their scalars
+ * have the same size. Other trivially copyable class types must specialize UniformScalarLayout or
+ * provide their own Serialize() overloads to be used with a non-native byte order, and otherwise throw
+ * NcError.
+ */
+inline void SetByteOrder(std::ios_base& stream, ByteOrder order)
+{
+    stream.iword(detail::ByteOrderIndex()) = static_cast<long>(order);
+}
+
+/** @brief Get the byte order used when (de)serializing with a stream. */
+inline auto GetByteOrder(std::ios_base& stream) -> ByteOrder
+{
+    const auto order = stream.iword(detail::ByteOrderIndex());
+    return order == 0 ? g_nativeByteOrder : static_cast<ByteOrder>(order);
+}
+} // namespace nc::serialize
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory_resource>
 #include <span>
 #include <vector>
 
@@ -21,7 +22,7 @@ static constexpr auto compressMaxInputSize = size_t{2113929216};
  * @brief Compress a range of bytes using LZ4/LZ4HC.
  * @param src The data to compress. Must not exceed compressMaxInputSize.
  * @param level The compression level to apply.
- * @return The compressed data as a vector of bytes.
+ * @return The compressed data as a vector of bytes, which may be moved into a nc::Blob without copying.
  * @throw NcError is thrown on invalid parameters.
  */
 auto Compress(std::span<const char> src, CompressionLevel level = CompressionLevel::Default) -> std::vector<char>;
@@ -30,8 +31,38 @@ auto Compress(std::span<const char> src, CompressionLevel level = CompressionLev
  * @brief Decompress a range of bytes compressed with LZ4/LZ4HC.
  * @param src The data to decompress.
  * @param maxDecompressedSize Size upper bound of the decompressed data.
- * @return The decompressed data as a vector of bytes.
+ * @return The decompressed data as a vector of bytes, which may be moved into a nc::Blob without copying.
  * @throw NcError is thrown if src is malformed or the specified max size is insufficient.
  */
 auto Decompress(std::span<const char> src, size_t maxDecompressedSize) -> std::vector<char>;
+
+/**
+ * @brief Compress a range of bytes using LZ4/LZ4HC, allocating from a memory resource.
+ *
+ * Both the output and the LZ4HC working state, which is several hundred KiB, are allocated from the
+ * resource, so an nc::ArenaResource or nc::FrameAllocator arena keeps compression off the global heap.
+ * Unlike the std::vector overload, the output isn't shrunk and keeps its worst case capacity.
+ *
+ * @param src The data to compress. Must not exceed compressMaxInputSize.
+ * @param resource The resource to allocate from.
+ * @param level The compression level to apply.
+ * @throw NcError is thrown on invalid parameters.
+ */
+auto Compress(std::span<const char> src,
+              std::pmr::memory_resource* resource,
+              CompressionLevel level = CompressionLevel::Default) -> std::pmr::vector<char>;
+
+/**
+ * @brief Decompress a range of bytes compressed with LZ4/LZ4HC, allocating from a memory resource.
+ *
+ * Unlike the std::vector overload, the output isn't shrunk and keeps a capacity of maxDecompressedSize.
+ *
+ * @param src The data to decompress.
+ * @param maxDecompressedSize Size upper bound of the decompressed data.
+ * @param resource The resource to allocate the output from.
+ * @throw NcError is thrown if src is malformed or the specified max size is insufficient.
+ */
+auto Decompress(std::span<const char> src,
+                size_t maxDecompressedSize,
+                std::pmr::memory_resource* resource) -> std::pmr::vector<char>;
 } // namespace nc
@@ -0,0 +1,420 @@
+#pragma once
+
+#include "ncutility/NcError.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace nc
+{
+/** @brief The cache line size assumed when separating data written by different threads. */
+inline constexpr size_t g_cacheLineSize = 64ull;
+
+/** @cond internal */
+namespace detail
+{
+inline auto QueueCapacity(size_t requested, size_t minimum) -> size_t
+{
+    if (requested == 0 || requested > (size_t{1} << (sizeof(size_t) * 8 - 2)))
+        throw NcError("Invalid queue capacity.", fmt::format("capacity: {}", requested));
+
+    return std::bit_ceil(std::max(requested, minimum));
+}
+} // namespace detail
+/** @endcond internal */
+
+/**
+ * @brief A bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * Elements live in a ring buffer whose capacity is rounded up to a power of two. The producer and
+ * consumer indices are kept on separate cache lines, each beside a cached copy of the other thread's
+ * index, so a thread only reads the other's line when the cached value says the ring looks full or
+ * empty. Batch operations publish all of their elements with a single store.
+ *
+ * Push functions may only be called from one thread at a time, and likewise for pop functions.
+ */
+template<class T>
+class SpscQueue
+{
+    static_assert(std::is_nothrow_destructible_v<T>, "SpscQueue requires a nothrow destructible type");
+
+    public:
+        /**
+         * @param capacity The minimum number of elements the queue can hold.
+         * @throw NcError if capacity is zero or too large.
+         */
+        explicit SpscQueue(size_t capacity)
+            : m_capacity{detail::QueueCapacity(capacity, 1)},
+              m_mask{m_capacity - 1},
+              m_slots{std::allocator<T>{}.allocate(m_capacity)}
+        {
+        }
+
+        ~SpscQueue() noexcept
+        {
+            const auto tail = m_producer.index.load(std::memory_order_relaxed);
+            for (auto head = m_consumer.index.load(std::memory_order_relaxed); head != tail; ++head)
+                std::destroy_at(m_slots + (head & m_mask));
+
+            std::allocator<T>{}.deallocate(m_slots, m_capacity);
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue(SpscQueue&&) = delete;
+        void operator=(const SpscQueue&) = delete;
+        void operator=(SpscQueue&&) = delete;
+
+        /** @brief Construct an element at the back of the queue, returning false if the queue is full. */
+        template<class... Args>
+        auto TryEmplace(Args&&... args) -> bool
+        {
+            const auto tail = m_producer.index.load(std::memory_order_relaxed);
+            if (FreeCount(tail, 1) == 0)
+                return false;
+
+            std::construct_at(m_slots + (tail & m_mask), std::forward<Args>(args)...);
+            m_producer.index.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        auto TryPush(const T& value) -> bool { return TryEmplace(value); }
+        auto TryPush(T&& value) -> bool { return TryEmplace(std::move(value)); }
+
+        /**
+         * @brief Push up to count elements read from first, returning the number pushed.
+         * @note Wrap first in std::make_move_iterator() to move elements into the queue.
+         */
+        template<std::input_iterator It>
+        auto TryPushBatch(It first, size_t count) -> size_t
+        {
+            const auto tail = m_producer.index.load(std::memory_order_relaxed);
+            const auto pushCount = std::min(count, FreeCount(tail, count));
+            auto pushed = size_t{0};
+            try
+            {
+                for (; pushed < pushCount; ++pushed, ++first)
+                    std::construct_at(m_slots + ((tail + pushed) & m_mask), *first);
+            }
+            catch (...)
+            {
+                m_producer.index.store(tail + pushed, std::memory_order_release);
+                throw;
+            }
+
+            m_producer.index.store(tail + pushed, std::memory_order_release);
+            return pushed;
+        }
+
+        /** @brief Move the front element into out, returning false if the queue is empty. */
+        auto TryPop(T& out) -> bool
+        {
+            const auto head = m_consumer.index.load(std::memory_order_relaxed);
+            if (UsedCount(head, 1) == 0)
+                return false;
+
+            const auto slot = m_slots + (head & m_mask);
+            out = std::move(*slot);
+            std::destroy_at(slot);
+            m_consumer.index.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** @brief Pop up to maxCount elements, moving them to out, and return the number popped. */
+        template<std::output_iterator<T&&> Out>
+        auto TryPopBatch(Out out, size_t maxCount) -> size_t
+        {
+            const auto head = m_consumer.index.load(std::memory_order_relaxed);
+            const auto popCount = std::min(maxCount, UsedCount(head, maxCount));
+            auto popped = size_t{0};
+            try
+            {
+                for (; popped < popCount; ++popped, ++out)
+                {
+                    const auto slot = m_slots + ((head + popped) & m_mask);
+                    *out = std::move(*slot);
+                    std::destroy_at(slot);
+                }
+            }
+            catch (...)
+            {
+                m_consumer.index.store(head + popped, std::memory_order_release);
+                throw;
+            }
+
+            m_consumer.index.store(head + popped, std::memory_order_release);
+            return popped;
+        }
+
+        /** @brief Get the maximum number of elements the queue can hold. */
+        auto Capacity() const noexcept -> size_t { return m_capacity; }
+
+        /** @brief Get the number of elements in the queue, which may be stale by the time it returns. */
+        auto SizeApprox() const noexcept -> size_t
+        {
+            const auto head = m_consumer.index.load(std::memory_order_acquire);
+            return m_producer.index.load(std::memory_order_acquire) - head;
+        }
+
+    private:
+        // Written by the producer. cachedHead is the last consumer index it saw.
+        struct alignas(g_cacheLineSize) ProducerState
+        {
+            std::atomic<size_t> index = 0;
+            size_t cachedHead = 0;
+        };
+
+        // Written by the consumer. cachedTail is the last producer index it saw.
+        struct alignas(g_cacheLineSize) ConsumerState
+        {
+            std::atomic<size_t> index = 0;
+            size_t cachedTail = 0;
+        };
+
+        alignas(g_cacheLineSize) const size_t m_capacity;
+        const size_t m_mask;
+        T* const m_slots;
+        ProducerState m_producer;
+        ConsumerState m_consumer;
+
+        // Free slots seen by the producer, only reloading the consumer index if fewer than wanted are known.
+        auto FreeCount(size_t tail, size_t wanted) noexcept -> size_t
+        {
+            auto free = m_capacity - (tail - m_producer.cachedHead);
+            if (free < wanted)
+            {
+                m_producer.cachedHead = m_consumer.index.load(std::memory_order_acquire);
+                free = m_capacity - (tail - m_producer.cachedHead);
+            }
+
+            return free;
+        }
+
+        // Filled slots seen by the consumer, only reloading the producer index if fewer than wanted are known.
+        auto UsedCount(size_t head, size_t wanted) noexcept -> size_t
+        {
+            auto used = m_consumer.cachedTail - head;
+            if (used < wanted)
+            {
+                m_consumer.cachedTail = m_producer.index.load(std::memory_order_acquire);
+                used = m_consumer.cachedTail - head;
+            }
+
+            return used;
+        }
+};
+
+/**
+ * @brief A bounded lock-free queue for any number of producer and consumer threads.
+ *
+ * Implements Dmitry Vyukov's bounded MPMC queue. Each slot of a ring buffer holds a sequence number
+ * which tells threads whether it is ready to be written or read in the current lap, so producers and
+ * consumers only contend on their own index, which are kept on separate cache lines. Batch operations
+ * claim a run of consecutive ready slots with a single compare-exchange.
+ *
+ * Pushed values are constructed before a slot is claimed and moved into it, so a throwing constructor
+ * can't leave a claimed slot unfilled. Moving elements in and out of slots must therefore not throw.
+ */
+template<class T>
+class MpmcQueue
+{
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>,
+                  "MpmcQueue requires a type with nothrow move operations and destructor");
+
+    public:
+        /**
+         * @param capacity The minimum number of elements the queue can hold.
+         * @throw NcError if capacity is zero or too large.
+         */
+        explicit MpmcQueue(size_t capacity)
+            : m_capacity{detail::QueueCapacity(capacity, 2)},
+              m_mask{m_capacity - 1},
+              m_cells{std::make_unique<Cell[]>(m_capacity)}
+        {
+            for (auto i = size_t{0}; i < m_capacity; ++i)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        ~MpmcQueue() noexcept
+        {
+            const auto tail = m_enqueue.load(std::memory_order_relaxed);
+            for (auto head = m_dequeue.load(std::memory_order_relaxed); head != tail; ++head)
+                std::destroy_at(m_cells[head & m_mask].Value());
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue(MpmcQueue&&) = delete;
+        void operator=(const MpmcQueue&) = delete;
+        void operator=(MpmcQueue&&) = delete;
+
+        /** @brief Construct an element and push it to the back of the queue, returning false if the queue is full. */
+        template<class... Args>
+        auto TryEmplace(Args&&... args) -> bool
+        {
+            auto value = T(std::forward<Args>(args)...);
+            return TryPush(std::move(value));
+        }
+
+        auto TryPush(const T& value) -> bool
+        {
+            auto copy = T(value);
+            return TryPush(std::move(copy));
+        }
+
+        /** @brief Push an element to the back of the queue, returning false and leaving value unchanged if the queue is full. */
+        auto TryPush(T&& value) noexcept -> bool
+        {
+            const auto [pos, count] = Claim<true>(m_enqueue, 1);
+            if (count == 0)
+                return false;
+
+            Fill(pos, std::move(value));
+            return true;
+        }
+
+        /**
+         * @brief Push up to count elements read from first, returning the number pushed.
+         *
+         * Elements are claimed as a run of consecutive slots, so the batch is contiguous in the queue's
+         * order. Fewer than count elements are pushed if not enough consecutive slots are free.
+         * @note Wrap first in std::make_move_iterator() to move elements into the queue.
+         */
+        template<std::input_iterator It>
+        auto TryPushBatch(It first, size_t count) -> size_t
+        {
+            if constexpr (std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>)
+            {
+                const auto [pos, claimed] = Claim<true>(m_enqueue, count);
+                for (auto i = size_t{0}; i < claimed; ++i, ++first)
+                    Fill(pos + i, *first);
+
+                return claimed;
+            }
+            else
+            {
+                // Throwing conversions happen one at a time before each slot is claimed.
+                auto pushed = size_t{0};
+                for (; pushed < count; ++pushed, ++first)
+                {
+                    if (!TryPush(T(*first)))
+                        break;
+                }
+
+                return pushed;
+            }
+        }
+
+        /** @brief Move the front element into out, returning false if the queue is empty. */
+        auto TryPop(T& out) noexcept -> bool
+        {
+            const auto [pos, count] = Claim<false>(m_dequeue, 1);
+            if (count == 0)
+                return false;
+
+            Drain(pos, [&out](T& value) { out = std::move(value); });
+            return true;
+        }
+
+        /**
+         * @brief Pop up to maxCount elements, moving them to out, and return the number popped.
+         * @note Assignment to out must not throw, as the claimed elements can't be returned to the queue.
+         */
+        template<std::output_iterator<T&&> Out>
+        auto TryPopBatch(Out out, size_t maxCount) noexcept -> size_t
+        {
+            const auto [pos, claimed] = Claim<false>(m_dequeue, maxCount);
+            for (auto i = size_t{0}; i < claimed; ++i, ++out)
+                Drain(pos + i, [&out](T& value) { *out = std::move(value); });
+
+            return claimed;
+        }
+
+        /** @brief Get the maximum number of elements the queue can hold. */
+        auto Capacity() const noexcept -> size_t { return m_capacity; }
+
+        /** @brief Get the number of elements in the queue, which may be stale by the time it returns. */
+        auto SizeApprox() const noexcept -> size_t
+        {
+            const auto head = m_dequeue.load(std::memory_order_acquire);
+            const auto tail = m_enqueue.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+    private:
+        // A slot is writable when its sequence equals the enqueue position for this lap, and readable
+        // when it is one past it. Reading advances the sequence to the write position of the next lap.
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) std::byte storage[sizeof(T)];
+
+            auto Value() noexcept -> T* { return reinterpret_cast<T*>(storage); }
+        };
+
+        struct alignas(g_cacheLineSize) PaddedIndex : std::atomic<size_t>
+        {
+            PaddedIndex() noexcept : std::atomic<size_t>{0} {}
+        };
+
+        const size_t m_capacity;
+        const size_t m_mask;
+        const std::unique_ptr<Cell[]> m_cells;
+        PaddedIndex m_enqueue;
+        PaddedIndex m_dequeue;
+
+        // Claim up to maxCount consecutive slots which are ready to be written (Push) or read, returning
+        // the first position and the number claimed.
+        template<bool Push>
+        auto Claim(std::atomic<size_t>& index, size_t maxCount) noexcept -> std::pair<size_t, size_t>
+        {
+            auto pos = index.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto ready = size_t{0};
+                auto stale = false;
+                for (; ready < maxCount && ready < m_capacity; ++ready)
+                {
+                    const auto expected = pos + ready + (Push ? 0 : 1);
+                    const auto sequence = m_cells[(pos + ready) & m_mask].sequence.load(std::memory_order_acquire);
+                    if (sequence != expected)
+                    {
+                        // A sequence ahead of pos means another thread claimed it since it was loaded.
+                        // One behind means the queue is full (Push) or empty.
+                        stale = ready == 0 && static_cast<std::ptrdiff_t>(sequence - expected) > 0;
+                        break;
+                    }
+                }
+
+                if (stale)
+                    pos = index.load(std::memory_order_relaxed);
+                else if (ready == 0)
+                    return {pos, 0};
+                else if (index.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed))
+                    return {pos, ready};
+            }
+        }
+
+        template<class V>
+        void Fill(size_t pos, V&& value) noexcept
+        {
+            auto& cell = m_cells[pos & m_mask];
+            std::construct_at(cell.Value(), std::forward<V>(value));
+            cell.sequence.store(pos + 1, std::memory_order_release);
+        }
+
+        template<class F>
+        void Drain(size_t pos, F&& consume) noexcept
+        {
+            auto& cell = m_cells[pos & m_mask];
+            consume(*cell.Value());
+            std::destroy_at(cell.Value());
+            cell.sequence.store(pos + m_capacity, std::memory_order_release);
+        }
+};
+} // namespace nc
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "ncutility/Compression.h"
+
+#if !defined(__APPLE__)
+    #include "ncutility/BinarySerialization.h"
+#endif
+
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <string_view>
+
+namespace nc
+{
+/**
+ * @brief Caches the result of parsing source text, such as json assets, in binary form.
+ *
+ * Entries are keyed by a hash of the source text and hold the parsed result written with
+ * nc::serialize::Serialize() and compressed with nc::Compress(). Loading through the cache skips
+ * parsing whenever the source is unchanged since it was last cooked.
+ *
+ * Each entry records the cache format version, the user provided version, the hash and size of its
+ * source, and a hash of its payload. Entries not matching all of these are treated as missing and are
+ * replaced on the next load.
+ * Bump the version whenever the cooked type or its serialization changes.
+ *
+ * Entries are written to a temporary file and renamed into place, so the cache may be shared by
+ * multiple threads and processes. Concurrent writers of the same entry each produce a complete file.
+ *
+ * @note Entries are keyed only by source content, so a cache directory should hold a single cooked type
+ *       for any given source. Load() uses BinarySerialization.h, and so is unavailable on macOS, where
+ *       Read() and Write() may be used with custom serialization.
+ */
+class CookCache
+{
+    public:
+        /**
+         * @brief Open a cache in a directory, which is created if it doesn't exist.
+         * @param directory The directory holding cache entries.
+         * @param version A version for the cooked data, stored with and checked against each entry.
+         * @param level The compression level for new entries.
+         * @throw NcError if the directory can't be created.
+         */
+        explicit CookCache(std::filesystem::path directory, uint32_t version, CompressionLevel level = CompressionLevel::Fast);
+
+#if !defined(__APPLE__)
+        /**
+         * @brief Load an object from the cache, or parse it from source and cache the result.
+         * @param source The text to be parsed.
+         * @param out The object to load into.
+         * @param parse Parses source into out, e.g. with nc::serialize::json::Deserialize(). Only called
+         *        if the cache holds no valid entry for source.
+         * @return True if out was loaded from the cache.
+         * @note Failing to update the cache doesn't prevent loading, as the parsed result is still valid.
+         *       Entries are read into a temporary, so parse always starts from the original out.
+         */
+        template<std::default_initializable T, class Parse>
+            requires std::movable<T> && std::invocable<Parse&, std::string_view, T&>
+        auto Load(std::string_view source, T& out, Parse&& parse) const -> bool
+        {
+            auto cached = T{};
+            if (Read(source, [&cached](std::istream& stream) { nc::serialize::Deserialize(stream, cached); }))
+            {
+                out = std::move(cached);
+                return true;
+            }
+
+            parse(source, out);
+            try
+            {
+                Write(source, [&out](std::ostream& stream) { nc::serialize::Serialize(stream, out); });
+            }
+            catch (const NcError&)
+            {
+                // The parsed result is still valid without a cache entry.
+            }
+
+            return false;
+        }
+#endif
+
+        /**
+         * @brief Read the cached entry for source, if one exists.
+         * @param source The source text the entry was cooked from.
+         * @param read Deserializes the entry from the provided stream.
+         * @return True if a valid entry was found and read. Entries that fail to decompress or that read
+         *         throws NcError for are treated as missing.
+         */
+        auto Read(std::string_view source, const std::function<void(std::istream&)>& read) const -> bool;
+
+        /**
+         * @brief Write the cached entry for source, replacing any existing entry.
+         * @param source The source text the entry is cooked from.
+         * @param write Serializes the entry to the provided stream.
+         * @throw NcError if the entry can't be written.
+         */
+        void Write(std::string_view source, const std::function<void(std::ostream&)>& write) const;
+
+        /** @brief Get the path of the entry for source. */
+        auto EntryPath(std::string_view source) const -> std::filesystem::path;
+
+    private:
+        std::filesystem::path m_directory;
+        uint32_t m_version;
+        CompressionLevel m_level;
+};
+} // namespace nc
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "ncutility/NcError.h"
+
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+
+namespace nc::serialize
+{
+/** @brief Limits applied to all deserialization from a stream while a DeserializationContext is attached. */
+struct DeserializationLimits
+{
+    /** @brief Maximum number of bytes that may be read from the stream, typically the message size. */
+    size_t maxBytes = std::numeric_limits<size_t>::max();
+
+    /** @brief Maximum total bytes of container storage that may be requested while deserializing. */
+    size_t maxAllocationBytes = std::numeric_limits<size_t>::max();
+
+    /** @brief Initial size of the arena returned from DeserializationContext::Resource(). Zero disables the arena. */
+    size_t arenaSize = 0;
+};
+
+/**
+ * @brief Bounds deserialization of untrusted input from a stream.
+ *
+ * While alive, the context is attached to the stream and every container length read by
+ * nc::serialize::Deserialize() is validated against the remaining byte and allocation budgets
+ * before any storage is allocated. A length exceeding either budget results in an NcError.
+ *
+ * When an arena is enabled, Resource() returns a monotonic buffer resource. Deserializing into
+ * std::pmr containers constructed with it places all of a message's strings and vectors in the arena,
+ * where they are released together when the context is destroyed.
+ *
+ * @note Contexts may be nested, with the innermost context taking effect.
+ */
+class DeserializationContext
+{
+    public:
+        DeserializationContext(std::istream& stream, const DeserializationLimits& limits = {})
+            : m_stream{&stream},
+              m_previous{stream.pword(StreamIndex())},
+              m_start{stream.tellg()},
+              m_maxBytes{limits.maxBytes},
+              m_allocationRemaining{limits.maxAllocationBytes},
+              m_arena{}
+        {
+            if (limits.arenaSize != 0)
+                m_arena.emplace(limits.arenaSize);
+
+            stream.pword(StreamIndex()) = this;
+        }
+
+        ~DeserializationContext() noexcept
+        {
+            m_stream->pword(StreamIndex()) = m_previous;
+        }
+
+        DeserializationContext(DeserializationContext&&) = delete;
+        DeserializationContext(const DeserializationContext&) = delete;
+        void operator=(const DeserializationContext&) = delete;
+        void operator=(DeserializationContext&&) = delete;
+
+        /** @brief Get the arena, or the default resource if the arena is disabled. */
+        auto Resource() noexcept -> std::pmr::memory_resource*
+        {
+            return m_arena ? &m_arena.value() : std::pmr::get_default_resource();
+        }
+
+        /** @brief Get the number of bytes that may still be read from the stream. */
+        auto BytesRemaining() const -> size_t
+        {
+            const auto position = m_stream->tellg();
+            if (m_start == std::streampos{-1} || position == std::streampos{-1})
+                return m_maxBytes;
+
+            const auto consumed = static_cast<size_t>(position - m_start);
+            return consumed < m_maxBytes ? m_maxBytes - consumed : 0ull;
+        }
+
+        /** @brief Get the number of bytes of container storage that may still be requested. */
+        auto AllocationRemaining() const noexcept -> size_t
+        {
+            return m_allocationRemaining;
+        }
+
+        /**
+         * @brief Validate a container length read from the stream and charge it against the budgets.
+         * @param count The number of elements.
+         * @param minElementBytes The minimum number of bytes each element occupies in the stream.
+         * @param elementAllocationBytes The number of bytes of storage each element requires.
+         * @throw NcError if count exceeds either budget.
+         */
+        void AcquireContainer(size_t count, size_t minElementBytes, size_t elementAllocationBytes)
+        {
+            if (minElementBytes != 0 && count > BytesRemaining() / minElementBytes)
+            {
+                throw NcError("Serialized container length exceeds remaining message size.",
+                    fmt::format("length: {}, remaining bytes: {}", count, BytesRemaining()));
+            }
+
+            if (elementAllocationBytes != 0 && count > m_allocationRemaining / elementAllocationBytes)
+            {
+                throw NcError("Serialized container length exceeds allocation budget.",
+                    fmt::format("length: {}, remaining budget: {}", count, m_allocationRemaining));
+            }
+
+            m_allocationRemaining -= count * elementAllocationBytes;
+        }
+
+        /** @brief Get the context attached to a stream, if any. */
+        static auto Get(std::ios_base& stream) -> DeserializationContext*
+        {
+            return static_cast<DeserializationContext*>(stream.pword(StreamIndex()));
+        }
+
+    private:
+        std::istream* m_stream;
+        void* m_previous;
+        std::streampos m_start;
+        size_t m_maxBytes;
+        size_t m_allocationRemaining;
+        std::optional<std::pmr::monotonic_buffer_resource> m_arena;
+
+        static auto StreamIndex() -> int
+        {
+            static const auto index = std::ios_base::xalloc();
+            return index;
+        }
+};
+} // namespace nc::serialize
@@ -0,0 +1,55 @@
+/**
+ * @file JsonSerialization.h
+ * @copyright Copyright Jaremie Romer and McCallister Romer 2023
+ */
+#pragma once
+
+#if defined(__APPLE__)
+    /** @note Shares aggregate reflection with BinarySerialization.h, which is
+     * currently unsupported on macOS. */
+    #error "JsonSerialization.h is currently unsupported on macOS."
+#endif
+
+#include "ncutility/detail/JsonSerializationDetail.h"
+
+namespace nc::serialize::json
+{
+/**
+ * @brief Serialize an object to a stream as json text.
+ *
+ * Serialize and Deserialize are function objects with call signatures:
+ *     `void Serialize(std::ostream&, const T&)`
+ *     `void Deserialize(std::istream&, T&)`
+ *
+ * Supported types are mapped as follows:
+ *   - bool, integers, floating point types and enums as booleans and numbers. Non-finite floating
+ *     point values are written as null and read back as NaN.
+ *   - string as a string, and optional as its value or null.
+ *   - array, vector, deque, list, set and unordered_set as arrays.
+ *   - map and unordered_map with string or integer keys as objects.
+ *   - pair and tuple as arrays of their elements.
+ *   - nlohmann::json as itself.
+ *   - Types with `to_json`/`from_json` overloads found via adl, using those overloads.
+ *   - Aggregates with <= 64 members, each satisfying at least one of the above requirements. Members
+ *     are written as an array in declaration order, unless the aggregate declares member names with
+ *     a static `JsonMemberNames` array holding one name per member, in which case it is written as
+ *     an object. When reading an object, unknown keys are ignored and members without a key keep their
+ *     existing value.
+ *
+ * Deserialize parses with nlohmann's sax interface, assigning values directly into the target object
+ * as they are read, without building an intermediate nlohmann::json. Only types with custom
+ * `from_json` overloads build a json value, and only for their own part of the document. As with
+ * nc::serialize::Deserialize, existing container elements and string capacity are reused.
+ *
+ * @throw NcError if the input is not valid json or does not match the structure of the target type.
+ *        The target may be partially assigned when an error is thrown.
+ * @note Deserialize reads a single json value, so multiple values may be read from one stream.
+ */
+inline constexpr nc::serialize::json::detail::SerializeFn Serialize;
+
+/**
+ * @brief Deserialize an object from a stream of json text.
+ * @copydetails Serialize
+ */
+inline constexpr nc::serialize::json::detail::DeserializeFn Deserialize;
+} // namespace nc::serialize::json
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace nc
+{
+/**
+ * @brief A linear (bump) memory resource for short lived scratch allocations.
+ *
+ * Allocations advance a cursor through blocks obtained from an upstream resource. Deallocation is a
+ * no-op, except that freeing the most recent allocation rolls the cursor back. Memory is reclaimed all
+ * at once with Reset(), which keeps the blocks for reuse, or Release(), which returns them upstream.
+ *
+ * When Reset() finds more than one block in use, they are replaced with a single block large enough
+ * for everything allocated since the previous reset, so a steady per-frame workload settles into one
+ * block and stops calling the upstream resource.
+ *
+ * @note ArenaResource is not thread safe. Use FrameAllocator to give each thread its own arena.
+ */
+class ArenaResource : public std::pmr::memory_resource
+{
+    public:
+        /** @brief The default size of the first block requested from upstream. */
+        static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+        /**
+         * @param initialSize The size of the first block, which is requested on first use.
+         * @param upstream The resource providing blocks. Must outlive the arena.
+         */
+        explicit ArenaResource(size_t initialSize = DefaultBlockSize,
+                               std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+        ~ArenaResource() noexcept override;
+
+        ArenaResource(const ArenaResource&) = delete;
+        ArenaResource(ArenaResource&&) = delete;
+        void operator=(const ArenaResource&) = delete;
+        void operator=(ArenaResource&&) = delete;
+
+        /** @brief Make all memory available again, invalidating every allocation. Blocks are kept. */
+        void Reset();
+
+        /** @brief Return all blocks to the upstream resource, invalidating every allocation. */
+        void Release() noexcept;
+
+        /** @brief Get the number of bytes handed out since the last reset, including alignment padding. */
+        auto BytesAllocated() const noexcept -> size_t { return m_used + static_cast<size_t>(m_cursor - m_begin); }
+
+        /** @brief Get the total size of the blocks currently held. */
+        auto Capacity() const noexcept -> size_t { return m_capacity; }
+
+        /** @brief Get the resource providing blocks. */
+        auto UpstreamResource() const noexcept -> std::pmr::memory_resource* { return m_upstream; }
+
+    protected:
+        auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+        auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+
+    private:
+        struct Block;
+
+        std::pmr::memory_resource* m_upstream;
+        Block* m_head = nullptr;    // first block, in allocation order
+        Block* m_current = nullptr; // block containing the cursor
+        std::byte* m_begin = nullptr;
+        std::byte* m_cursor = nullptr;
+        std::byte* m_end = nullptr;
+        size_t m_used = 0;          // bytes consumed in blocks before m_current
+        size_t m_capacity = 0;
+        size_t m_nextBlockSize;
+
+        auto AllocateSlow(size_t bytes, size_t alignment) -> void*;
+        auto PushBlock(size_t size) -> Block*;
+        void Enter(Block* block) noexcept;
+};
+
+/**
+ * @brief A set of per-thread arenas for per-frame scratch data, reset together.
+ *
+ * Each thread calling Local() gets its own ArenaResource, created on first use, so allocations never
+ * contend. Call Reset() once per frame, at a point where no thread is using memory from the previous
+ * frame, to reclaim everything in bulk.
+ *
+ * @note Local() is thread safe. Reset() and Release() must not run concurrently with use of any arena.
+ *       Arenas of exited threads are kept until the FrameAllocator is destroyed.
+ */
+class FrameAllocator
+{
+    public:
+        /**
+         * @param initialSize The first block size of each thread's arena.
+         * @param upstream The resource providing blocks. Must be thread safe and outlive the allocator.
+         */
+        explicit FrameAllocator(size_t initialSize = ArenaResource::DefaultBlockSize,
+                                std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+        ~FrameAllocator() noexcept;
+
+        FrameAllocator(const FrameAllocator&) = delete;
+        FrameAllocator(FrameAllocator&&) = delete;
+        void operator=(const FrameAllocator&) = delete;
+        void operator=(FrameAllocator&&) = delete;
+
+        /** @brief Get the calling thread's arena. */
+        auto Local() -> ArenaResource&;
+
+        /** @brief Reset every thread's arena, invalidating all allocations made this frame. */
+        void Reset();
+
+        /** @brief Return every arena's blocks to the upstream resource. */
+        void Release() noexcept;
+
+        /** @brief Get the number of bytes allocated from all arenas since the last reset. */
+        auto BytesAllocated() const -> size_t;
+
+    private:
+        std::unordered_map<std::thread::id, std::unique_ptr<ArenaResource>> m_arenas;
+        mutable std::mutex m_mutex;
+        std::pmr::memory_resource* m_upstream;
+        size_t m_initialSize;
+        uint64_t m_id;
+};
+
+/**
+ * @brief A memory resource handing out fixed size blocks from a free list.
+ *
+ * Requests no larger than BlockSize() and no more aligned than BlockAlignment() are served from chunks
+ * of blocks obtained from the upstream resource, and freed blocks are reused in LIFO order. Other
+ * requests are forwarded to the upstream resource. Suited to node based containers, e.g.
+ * std::pmr::list or std::pmr::map, whose nodes all have the same size.
+ *
+ * @note PoolResource is not thread safe.
+ */
+class PoolResource : public std::pmr::memory_resource
+{
+    public:
+        /**
+         * @param blockSize The size of each block. Rounded up to a multiple of pointer alignment.
+         * @param blocksPerChunk The number of blocks requested from upstream at a time.
+         * @param upstream The resource providing chunks. Must outlive the pool.
+         * @throw NcError if blockSize or blocksPerChunk is zero.
+         */
+        explicit PoolResource(size_t blockSize,
+                              size_t blocksPerChunk = 64,
+                              std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+        ~PoolResource() noexcept override;
+
+        PoolResource(const PoolResource&) = delete;
+        PoolResource(PoolResource&&) = delete;
+        void operator=(const PoolResource&) = delete;
+        void operator=(PoolResource&&) = delete;
+
+        /** @brief Return all chunks to the upstream resource, invalidating every pooled block. */
+        void Release() noexcept;
+
+        /** @brief Get the size of each block. */
+        auto BlockSize() const noexcept -> size_t { return m_blockSize; }
+
+        /** @brief Get the guaranteed alignment of each block. */
+        auto BlockAlignment() const noexcept -> size_t { return m_blockAlignment; }
+
+        /** @brief Get the resource providing chunks. */
+        auto UpstreamResource() const noexcept -> std::pmr::memory_resource* { return m_upstream; }
+
+    protected:
+        auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+        auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+
+    private:
+        struct FreeBlock;
+        struct Chunk;
+
+        std::pmr::memory_resource* m_upstream;
+        FreeBlock* m_free = nullptr;
+        Chunk* m_chunks = nullptr;
+        std::byte* m_carve = nullptr; // untouched blocks at the end of the newest chunk
+        std::byte* m_carveEnd = nullptr;
+        size_t m_blockSize;
+        size_t m_blockAlignment;
+        size_t m_blocksPerChunk;
+
+        auto Pooled(size_t bytes, size_t alignment) const noexcept -> bool;
+        auto ChunkHeaderSize() const noexcept -> size_t;
+        auto ChunkBytes() const noexcept -> size_t;
+};
+} // namespace nc
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "ncutility/NcError.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nc
+{
+template<class T>
+class SlotMap;
+} // namespace nc
+
+/** @cond internal */
+namespace nc::serialize::binary
+{
+// Defined in BinarySerializationDetail.h, and declared here so SlotMap can befriend them.
+template<class T>
+void Serialize(std::ostream& stream, const SlotMap<T>& in);
+
+template<class T>
+void Deserialize(std::istream& stream, SlotMap<T>& out);
+
+template<class T>
+auto SerializedSize(const SlotMap<T>& in) -> size_t;
+} // namespace nc::serialize::binary
+/** @endcond internal */
+
+namespace nc
+{
+/**
+ * @brief A generational reference to a value in a SlotMap.
+ *
+ * Handles remain valid until their value is erased, after which the slot's generation changes and the
+ * handle no longer resolves, even if the slot is reused. Default constructed handles never resolve.
+ */
+struct SlotHandle
+{
+    uint32_t index = std::numeric_limits<uint32_t>::max();
+    uint32_t generation = 0u;
+
+    auto operator==(const SlotHandle&) const -> bool = default;
+};
+
+/**
+ * @brief A container of values addressed by generational handles, with values packed in a dense array.
+ *
+ * Insertion, erasure and lookup are O(1). Values are stored contiguously, so iterating the map, or
+ * passing it to nc::algo::Enumerate() or any function accepting a std::span, walks linear memory. Erasing
+ * moves the last value into the erased value's position, so pointers and dense indices into the map are
+ * invalidated by erasure while handles are not. Use HandleAt() to get the handle of a value by its dense
+ * index, e.g. while enumerating.
+ *
+ * Supports nc::serialize::Serialize() and nc::serialize::Deserialize() when ncutility/BinarySerialization.h
+ * is included. Handles remain valid across a round trip.
+ *
+ * @note A slot's generation wraps after 2^31 reuses, at which point a stale handle may resolve again.
+ */
+template<class T>
+class SlotMap
+{
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using iterator = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        /** @brief Construct a value in place, returning its handle. */
+        template<class... Args>
+        auto Emplace(Args&&... args) -> SlotHandle
+        {
+            if (m_freeHead == NullIndex)
+            {
+                if (m_slots.size() == NullIndex)
+                    throw NcError("SlotMap capacity exceeded.");
+
+                m_freeHead = static_cast<uint32_t>(m_slots.size());
+                m_slots.push_back(Slot{});
+            }
+
+            // Claim the slot only once the value exists, so a throwing constructor leaves the map unchanged.
+            const auto slotIndex = m_freeHead;
+            const auto denseIndex = static_cast<uint32_t>(m_values.size());
+            m_denseToSlot.push_back(slotIndex);
+            try
+            {
+                m_values.emplace_back(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                m_denseToSlot.pop_back();
+                throw;
+            }
+
+            auto& slot = m_slots[slotIndex];
+            m_freeHead = std::exchange(slot.dense, denseIndex);
+            ++slot.generation;
+            return SlotHandle{slotIndex, slot.generation};
+        }
+
+        /** @brief Insert a value, returning its handle. */
+        auto Insert(T value) -> SlotHandle
+        {
+            return Emplace(std::move(value));
+        }
+
+        /** @brief Erase the value referenced by a handle, returning false if the handle doesn't resolve. */
+        auto Erase(SlotHandle handle) -> bool
+        {
+            if (!Contains(handle))
+                return false;
+
+            auto& slot = m_slots[handle.index];
+            const auto denseIndex = slot.dense;
+            const auto lastIndex = static_cast<uint32_t>(m_values.size() - 1);
+            if (denseIndex != lastIndex)
+            {
+                m_values[denseIndex] = std::move(m_values[lastIndex]);
+                m_denseToSlot[denseIndex] = m_denseToSlot[lastIndex];
+                m_slots[m_denseToSlot[denseIndex]].dense = denseIndex;
+            }
+
+            m_values.pop_back();
+            m_denseToSlot.pop_back();
+            ++slot.generation;
+            slot.dense = std::exchange(m_freeHead, handle.index);
+            return true;
+        }
+
+        /** @brief Check if a handle resolves to a value. */
+        auto Contains(SlotHandle handle) const noexcept -> bool
+        {
+            return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation && IsOccupied(m_slots[handle.index]);
+        }
+
+        /** @brief Get a pointer to the value referenced by a handle, or nullptr if the handle doesn't resolve. */
+        auto TryGet(SlotHandle handle) noexcept -> T*
+        {
+            return Contains(handle) ? &m_values[m_slots[handle.index].dense] : nullptr;
+        }
+
+        /** @copydoc TryGet() */
+        auto TryGet(SlotHandle handle) const noexcept -> const T*
+        {
+            return Contains(handle) ? &m_values[m_slots[handle.index].dense] : nullptr;
+        }
+
+        /**
+         * @brief Get the value referenced by a handle.
+         * @throw NcError if the handle doesn't resolve.
+         */
+        auto Get(SlotHandle handle) -> T&
+        {
+            return const_cast<T&>(std::as_const(*this).Get(handle));
+        }
+
+        /** @copydoc Get() */
+        auto Get(SlotHandle handle) const -> const T&
+        {
+            if (!Contains(handle))
+                throw NcError("Invalid SlotMap handle.", fmt::format("index: {}, generation: {}", handle.index, handle.generation));
+
+            return m_values[m_slots[handle.index].dense];
+        }
+
+        /** @brief Get the handle of the value at a position in the dense array. */
+        auto HandleAt(size_t denseIndex) const noexcept -> SlotHandle
+        {
+            const auto slotIndex = m_denseToSlot[denseIndex];
+            return SlotHandle{slotIndex, m_slots[slotIndex].generation};
+        }
+
+        /** @brief Erase all values. Outstanding handles no longer resolve, and slots are retained for reuse. */
+        void Clear()
+        {
+            while (!m_values.empty())
+                Erase(HandleAt(m_values.size() - 1));
+        }
+
+        /** @brief Preallocate storage for a number of values. */
+        void Reserve(size_t count)
+        {
+            m_values.reserve(count);
+            m_denseToSlot.reserve(count);
+            m_slots.reserve(count);
+        }
+
+        /** @brief Get the values as a contiguous span. */
+        auto Values() noexcept -> std::span<T> { return m_values; }
+        auto Values() const noexcept -> std::span<const T> { return m_values; }
+
+        auto size() const noexcept -> size_t { return m_values.size(); }
+        auto empty() const noexcept -> bool { return m_values.empty(); }
+        auto data() noexcept -> T* { return m_values.data(); }
+        auto data() const noexcept -> const T* { return m_values.data(); }
+        auto begin() noexcept -> iterator { return m_values.begin(); }
+        auto begin() const noexcept -> const_iterator { return m_values.begin(); }
+        auto end() noexcept -> iterator { return m_values.end(); }
+        auto end() const noexcept -> const_iterator { return m_values.end(); }
+        auto operator[](size_t denseIndex) noexcept -> T& { return m_values[denseIndex]; }
+        auto operator[](size_t denseIndex) const noexcept -> const T& { return m_values[denseIndex]; }
+
+    private:
+        template<class U>
+        friend void serialize::binary::Serialize(std::ostream& stream, const SlotMap<U>& in);
+
+        template<class U>
+        friend void serialize::binary::Deserialize(std::istream& stream, SlotMap<U>& out);
+
+        template<class U>
+        friend auto serialize::binary::SerializedSize(const SlotMap<U>& in) -> size_t;
+
+        // Generations are odd while a slot is occupied. A free slot's dense index links to the next free slot.
+        struct Slot
+        {
+            uint32_t dense = NullIndex;
+            uint32_t generation = 0u;
+        };
+
+        static constexpr auto NullIndex = std::numeric_limits<uint32_t>::max();
+
+        std::vector<T> m_values;
+        std::vector<uint32_t> m_denseToSlot;
+        std::vector<Slot> m_slots;
+        uint32_t m_freeHead = NullIndex;
+
+        static constexpr auto IsOccupied(const Slot& slot) noexcept -> bool
+        {
+            return (slot.generation & 1u) != 0u;
+        }
+};
+} // namespace nc
@@ -0,0 +1,479 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace nc
+{
+/**
+ * @brief A vector storing up to N elements inline, only allocating once it grows beyond them.
+ *
+ * SmallVector has the interface of std::vector, apart from allocator support, so it can replace one
+ * holding short lists without other changes. Iterators are pointers and elements are contiguous, so it
+ * may be passed to any function accepting a std::span. Unlike std::vector, moving a SmallVector whose
+ * elements are stored inline moves each element and invalidates iterators.
+ *
+ * Supports nc::serialize with the same encoding as std::vector, including bulk reads and writes of
+ * trivially copyable elements.
+ *
+ * @tparam N The number of elements stored without allocating. Must be greater than zero.
+ */
+template<class T, size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector requires an inline capacity");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /** @brief The number of elements stored without allocating. */
+        static constexpr size_t InlineCapacity = N;
+
+        SmallVector() noexcept = default;
+
+        explicit SmallVector(size_t count)
+        {
+            resize(count);
+        }
+
+        SmallVector(size_t count, const T& value)
+        {
+            assign(count, value);
+        }
+
+        template<std::input_iterator It>
+        SmallVector(It first, It last)
+        {
+            assign(first, last);
+        }
+
+        SmallVector(std::initializer_list<T> values)
+        {
+            assign(values.begin(), values.end());
+        }
+
+        SmallVector(const SmallVector& other)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            TakeStorage(other);
+        }
+
+        auto operator=(const SmallVector& other) -> SmallVector&
+        {
+            if (this != &other)
+                assign(other.begin(), other.end());
+
+            return *this;
+        }
+
+        auto operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) -> SmallVector&
+        {
+            if (this != &other)
+            {
+                clear();
+                Deallocate();
+                TakeStorage(other);
+            }
+
+            return *this;
+        }
+
+        auto operator=(std::initializer_list<T> values) -> SmallVector&
+        {
+            assign(values.begin(), values.end());
+            return *this;
+        }
+
+        ~SmallVector() noexcept
+        {
+            clear();
+            Deallocate();
+        }
+
+        void assign(size_t count, const T& value)
+        {
+            auto copy = T(value);
+            clear();
+            reserve(count);
+            std::uninitialized_fill_n(m_data, count, copy);
+            m_size = count;
+        }
+
+        template<std::input_iterator It>
+        void assign(It first, It last)
+        {
+            clear();
+            if constexpr (std::forward_iterator<It>)
+            {
+                const auto count = static_cast<size_t>(std::distance(first, last));
+                reserve(count);
+                std::uninitialized_copy(first, last, m_data);
+                m_size = count;
+            }
+            else
+            {
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+        }
+
+        void assign(std::initializer_list<T> values)
+        {
+            assign(values.begin(), values.end());
+        }
+
+        auto at(size_t index) -> T&
+        {
+            return const_cast<T&>(std::as_const(*this).at(index));
+        }
+
+        auto at(size_t index) const -> const T&
+        {
+            if (index >= m_size)
+                throw std::out_of_range("SmallVector index out of range");
+
+            return m_data[index];
+        }
+
+        auto operator[](size_t index) noexcept -> T& { return m_data[index]; }
+        auto operator[](size_t index) const noexcept -> const T& { return m_data[index]; }
+        auto front() noexcept -> T& { return m_data[0]; }
+        auto front() const noexcept -> const T& { return m_data[0]; }
+        auto back() noexcept -> T& { return m_data[m_size - 1]; }
+        auto back() const noexcept -> const T& { return m_data[m_size - 1]; }
+        auto data() noexcept -> T* { return m_data; }
+        auto data() const noexcept -> const T* { return m_data; }
+
+        auto begin() noexcept -> iterator { return m_data; }
+        auto begin() const noexcept -> const_iterator { return m_data; }
+        auto cbegin() const noexcept -> const_iterator { return m_data; }
+        auto end() noexcept -> iterator { return m_data + m_size; }
+        auto end() const noexcept -> const_iterator { return m_data + m_size; }
+        auto cend() const noexcept -> const_iterator { return m_data + m_size; }
+        auto rbegin() noexcept -> reverse_iterator { return reverse_iterator{end()}; }
+        auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{end()}; }
+        auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+        auto rend() noexcept -> reverse_iterator { return reverse_iterator{begin()}; }
+        auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{begin()}; }
+        auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+        auto empty() const noexcept -> bool { return m_size == 0; }
+        auto size() const noexcept -> size_t { return m_size; }
+        auto max_size() const noexcept -> size_t { return std::numeric_limits<difference_type>::max() / sizeof(T); }
+        auto capacity() const noexcept -> size_t { return m_capacity; }
+
+        /** @brief Check if elements are stored inline rather than in an allocation. */
+        auto IsInline() const noexcept -> bool { return m_data == InlineData(); }
+
+        void reserve(size_t count)
+        {
+            if (count > m_capacity)
+                Reallocate(count);
+        }
+
+        /** @brief Release unused capacity, moving elements back inline if they fit. */
+        void shrink_to_fit()
+        {
+            if (!IsInline() && m_size < m_capacity)
+                Reallocate(m_size);
+        }
+
+        void clear() noexcept
+        {
+            std::destroy_n(m_data, m_size);
+            m_size = 0;
+        }
+
+        auto insert(const_iterator pos, const T& value) -> iterator
+        {
+            return emplace(pos, value);
+        }
+
+        auto insert(const_iterator pos, T&& value) -> iterator
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        auto insert(const_iterator pos, size_t count, const T& value) -> iterator
+        {
+            const auto offset = pos - cbegin();
+            auto copy = T(value);
+            reserve(m_size + count);
+            for (auto i = size_t{0}; i < count; ++i)
+                emplace_back(copy);
+
+            return Rotate(offset, m_size - count);
+        }
+
+        template<std::input_iterator It>
+        auto insert(const_iterator pos, It first, It last) -> iterator
+        {
+            const auto offset = pos - cbegin();
+            const auto oldSize = m_size;
+            if constexpr (std::forward_iterator<It>)
+                reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+
+            for (; first != last; ++first)
+                emplace_back(*first);
+
+            return Rotate(offset, oldSize);
+        }
+
+        auto insert(const_iterator pos, std::initializer_list<T> values) -> iterator
+        {
+            return insert(pos, values.begin(), values.end());
+        }
+
+        template<class... Args>
+        auto emplace(const_iterator pos, Args&&... args) -> iterator
+        {
+            const auto offset = pos - cbegin();
+            emplace_back(std::forward<Args>(args)...);
+            return Rotate(offset, m_size - 1);
+        }
+
+        auto erase(const_iterator pos) -> iterator
+        {
+            return erase(pos, pos + 1);
+        }
+
+        auto erase(const_iterator first, const_iterator last) -> iterator
+        {
+            const auto out = begin() + (first - cbegin());
+            if (first != last)
+            {
+                const auto newEnd = std::move(out + (last - first), end(), out);
+                std::destroy(newEnd, end());
+                m_size = static_cast<size_t>(newEnd - m_data);
+            }
+
+            return out;
+        }
+
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        template<class... Args>
+        auto emplace_back(Args&&... args) -> T&
+        {
+            if (m_size == m_capacity)
+                return GrowAndEmplaceBack(std::forward<Args>(args)...);
+
+            const auto element = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            ++m_size;
+            return *element;
+        }
+
+        void pop_back() noexcept
+        {
+            std::destroy_at(m_data + --m_size);
+        }
+
+        void resize(size_t count)
+        {
+            if (count < m_size)
+            {
+                erase(begin() + count, end());
+                return;
+            }
+
+            reserve(count);
+            std::uninitialized_value_construct(m_data + m_size, m_data + count);
+            m_size = count;
+        }
+
+        void resize(size_t count, const T& value)
+        {
+            if (count < m_size)
+            {
+                erase(begin() + count, end());
+                return;
+            }
+
+            auto copy = T(value);
+            reserve(count);
+            std::uninitialized_fill(m_data + m_size, m_data + count, copy);
+            m_size = count;
+        }
+
+        void swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            auto temp = std::move(other);
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        friend void swap(SmallVector& lhs, SmallVector& rhs) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            lhs.swap(rhs);
+        }
+
+        friend auto operator==(const SmallVector& lhs, const SmallVector& rhs) -> bool
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend auto operator<=>(const SmallVector& lhs, const SmallVector& rhs)
+        {
+            return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+    private:
+        T* m_data = InlineData();
+        size_t m_size = 0;
+        size_t m_capacity = N;
+        alignas(T) std::byte m_inline[N * sizeof(T)];
+
+        auto InlineData() noexcept -> T* { return reinterpret_cast<T*>(m_inline); }
+        auto InlineData() const noexcept -> const T* { return reinterpret_cast<const T*>(m_inline); }
+
+        // Move elements if it can't throw, otherwise copy them so a failure leaves the source intact.
+        static void Relocate(T* from, size_t count, T* to)
+        {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                std::uninitialized_move_n(from, count, to);
+            else
+                std::uninitialized_copy_n(from, count, to);
+
+            std::destroy_n(from, count);
+        }
+
+        auto Allocate(size_t count) -> T*
+        {
+            if (count > max_size())
+                throw std::length_error("SmallVector capacity exceeded");
+
+            return std::allocator<T>{}.allocate(count);
+        }
+
+        void Deallocate() noexcept
+        {
+            if (!IsInline())
+                std::allocator<T>{}.deallocate(m_data, m_capacity);
+
+            m_data = InlineData();
+            m_capacity = N;
+        }
+
+        // Move storage to hold exactly count elements, or back inline if they fit.
+        void Reallocate(size_t count)
+        {
+            const auto toInline = count <= N;
+            const auto storage = toInline ? InlineData() : Allocate(count);
+            try
+            {
+                Relocate(m_data, m_size, storage);
+            }
+            catch (...)
+            {
+                if (!toInline)
+                    std::allocator<T>{}.deallocate(storage, count);
+
+                throw;
+            }
+
+            Deallocate();
+            m_data = storage;
+            m_capacity = toInline ? N : count;
+        }
+
+        // The new element is constructed before existing ones are relocated, as args may refer to them.
+        template<class... Args>
+        auto GrowAndEmplaceBack(Args&&... args) -> T&
+        {
+            const auto newCapacity = std::max(m_capacity * 2, m_size + 1);
+            const auto storage = Allocate(newCapacity);
+            T* element = nullptr;
+            try
+            {
+                element = std::construct_at(storage + m_size, std::forward<Args>(args)...);
+                Relocate(m_data, m_size, storage);
+            }
+            catch (...)
+            {
+                if (element)
+                    std::destroy_at(element);
+
+                std::allocator<T>{}.deallocate(storage, newCapacity);
+                throw;
+            }
+
+            Deallocate();
+            m_data = storage;
+            m_capacity = newCapacity;
+            ++m_size;
+            return *element;
+        }
+
+        // Adopt the elements of other, stealing its allocation if it has one, and leave it empty.
+        void TakeStorage(SmallVector& other)
+        {
+            if (other.IsInline())
+            {
+                std::uninitialized_move_n(other.m_data, other.m_size, m_data);
+                m_size = other.m_size;
+                other.clear();
+            }
+            else
+            {
+                m_data = std::exchange(other.m_data, other.InlineData());
+                m_size = std::exchange(other.m_size, 0);
+                m_capacity = std::exchange(other.m_capacity, N);
+            }
+        }
+
+        // Rotate elements appended from oldSize into position offset, returning an iterator to the first.
+        auto Rotate(difference_type offset, size_t oldSize) -> iterator
+        {
+            std::rotate(m_data + offset, m_data + oldSize, m_data + m_size);
+            return m_data + offset;
+        }
+};
+
+template<class T, size_t N, class U>
+auto erase(SmallVector<T, N>& container, const U& value) -> size_t
+{
+    const auto newEnd = std::remove(container.begin(), container.end(), value);
+    const auto count = static_cast<size_t>(container.end() - newEnd);
+    container.erase(newEnd, container.end());
+    return count;
+}
+
+template<class T, size_t N, class Pred>
+auto erase_if(SmallVector<T, N>& container, Pred pred) -> size_t
+{
+    const auto newEnd = std::remove_if(container.begin(), container.end(), pred);
+    const auto count = static_cast<size_t>(container.end() - newEnd);
+    container.erase(newEnd, container.end());
+    return count;
+}
+} // namespace nc
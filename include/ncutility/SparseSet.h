@@ -0,0 +1,237 @@
+#pragma once
+
+#include "ncutility/NcError.h"
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nc
+{
+template<class T, std::unsigned_integral Key, size_t PageSize>
+class SparseSet;
+} // namespace nc
+
+/** @cond internal */
+namespace nc::serialize::binary
+{
+// Defined in BinarySerializationDetail.h, and declared here so SparseSet can befriend them.
+template<class T, std::unsigned_integral Key, size_t PageSize>
+void Serialize(std::ostream& stream, const SparseSet<T, Key, PageSize>& in);
+
+template<class T, std::unsigned_integral Key, size_t PageSize>
+void Deserialize(std::istream& stream, SparseSet<T, Key, PageSize>& out);
+
+template<class T, std::unsigned_integral Key, size_t PageSize>
+auto SerializedSize(const SparseSet<T, Key, PageSize>& in) -> size_t;
+} // namespace nc::serialize::binary
+/** @endcond internal */
+
+namespace nc
+{
+/**
+ * @brief A map from integer keys, such as entity ids, to values packed in a dense array.
+ *
+ * Keys index a sparse array split into pages of PageSize entries, which are only allocated once a key
+ * in their range is inserted. The table of pages is itself dense, with an entry for every page up to
+ * the largest key, so memory use grows with the largest key as well as the number of occupied pages.
+ * Insertion, erasure and lookup are O(1). Values and keys are stored contiguously in matching order, so iterating the set, or
+ * passing it to nc::algo::Enumerate() or any function accepting a std::span, walks linear memory.
+ *
+ * Iteration order is insertion order, except that erasing moves the last value into the erased value's
+ * position. The order is otherwise unaffected by lookups and is preserved by serialization.
+ *
+ * Supports nc::serialize::Serialize() and nc::serialize::Deserialize() when ncutility/BinarySerialization.h
+ * is included.
+ *
+ * @tparam T The value type.
+ * @tparam Key An unsigned integer key type. The maximum value is reserved.
+ * @tparam PageSize The number of keys per page of the sparse array. Must be a power of two.
+ */
+template<class T, std::unsigned_integral Key = uint32_t, size_t PageSize = 4096>
+class SparseSet
+{
+    static_assert(std::has_single_bit(PageSize), "SparseSet PageSize must be a power of two");
+
+    public:
+        using key_type = Key;
+        using value_type = T;
+        using size_type = size_t;
+        using iterator = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        /**
+         * @brief Construct a value in place for a key.
+         * @throw NcError if the key is already present or is the reserved maximum value.
+         */
+        template<class... Args>
+        auto Emplace(Key key, Args&&... args) -> T&
+        {
+            if (key == NullIndex)
+                throw NcError("SparseSet key is reserved.", fmt::format("key: {}", key));
+
+            auto& entry = SparseEntry(key);
+            if (entry != NullIndex)
+                throw NcError("SparseSet key is already present.", fmt::format("key: {}", key));
+
+            m_keys.push_back(key);
+            try
+            {
+                m_values.emplace_back(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                m_keys.pop_back();
+                throw;
+            }
+
+            entry = static_cast<Key>(m_values.size() - 1);
+            return m_values.back();
+        }
+
+        /** @copydoc Emplace() */
+        auto Insert(Key key, T value) -> T&
+        {
+            return Emplace(key, std::move(value));
+        }
+
+        /** @brief Erase the value for a key, returning false if the key isn't present. */
+        auto Erase(Key key) -> bool
+        {
+            const auto denseIndex = IndexOf(key);
+            if (denseIndex == NullIndex)
+                return false;
+
+            const auto lastIndex = m_values.size() - 1;
+            if (denseIndex != lastIndex)
+            {
+                m_values[denseIndex] = std::move(m_values[lastIndex]);
+                m_keys[denseIndex] = m_keys[lastIndex];
+                SparseEntry(m_keys[denseIndex]) = static_cast<Key>(denseIndex);
+            }
+
+            m_values.pop_back();
+            m_keys.pop_back();
+            SparseEntry(key) = NullIndex;
+            return true;
+        }
+
+        /** @brief Check if a key is present. */
+        auto Contains(Key key) const noexcept -> bool
+        {
+            return IndexOf(key) != NullIndex;
+        }
+
+        /** @brief Get the position of a key's value in the dense array, or the maximum Key value if it isn't present. */
+        auto IndexOf(Key key) const noexcept -> size_t
+        {
+            const auto page = static_cast<size_t>(key) / PageSize;
+            if (page >= m_pages.size() || m_pages[page].empty())
+                return NullIndex;
+
+            return m_pages[page][static_cast<size_t>(key) & (PageSize - 1)];
+        }
+
+        /** @brief Get a pointer to the value for a key, or nullptr if the key isn't present. */
+        auto TryGet(Key key) noexcept -> T*
+        {
+            const auto denseIndex = IndexOf(key);
+            return denseIndex == NullIndex ? nullptr : &m_values[denseIndex];
+        }
+
+        /** @copydoc TryGet() */
+        auto TryGet(Key key) const noexcept -> const T*
+        {
+            const auto denseIndex = IndexOf(key);
+            return denseIndex == NullIndex ? nullptr : &m_values[denseIndex];
+        }
+
+        /**
+         * @brief Get the value for a key.
+         * @throw NcError if the key isn't present.
+         */
+        auto Get(Key key) -> T&
+        {
+            return const_cast<T&>(std::as_const(*this).Get(key));
+        }
+
+        /** @copydoc Get() */
+        auto Get(Key key) const -> const T&
+        {
+            const auto denseIndex = IndexOf(key);
+            if (denseIndex == NullIndex)
+                throw NcError("SparseSet key is not present.", fmt::format("key: {}", key));
+
+            return m_values[denseIndex];
+        }
+
+        /** @brief Erase all values. Allocated pages are retained for reuse. */
+        void Clear() noexcept
+        {
+            for (auto key : m_keys)
+                SparseEntry(key) = NullIndex;
+
+            m_keys.clear();
+            m_values.clear();
+        }
+
+        /** @brief Preallocate dense storage for a number of values. */
+        void Reserve(size_t count)
+        {
+            m_keys.reserve(count);
+            m_values.reserve(count);
+        }
+
+        /** @brief Get the keys in dense order, matching the order of values. */
+        auto Keys() const noexcept -> std::span<const Key> { return m_keys; }
+
+        /** @brief Get the values as a contiguous span. */
+        auto Values() noexcept -> std::span<T> { return m_values; }
+        auto Values() const noexcept -> std::span<const T> { return m_values; }
+
+        auto size() const noexcept -> size_t { return m_values.size(); }
+        auto empty() const noexcept -> bool { return m_values.empty(); }
+        auto data() noexcept -> T* { return m_values.data(); }
+        auto data() const noexcept -> const T* { return m_values.data(); }
+        auto begin() noexcept -> iterator { return m_values.begin(); }
+        auto begin() const noexcept -> const_iterator { return m_values.begin(); }
+        auto end() noexcept -> iterator { return m_values.end(); }
+        auto end() const noexcept -> const_iterator { return m_values.end(); }
+        auto operator[](size_t denseIndex) noexcept -> T& { return m_values[denseIndex]; }
+        auto operator[](size_t denseIndex) const noexcept -> const T& { return m_values[denseIndex]; }
+
+    private:
+        template<class U, std::unsigned_integral K, size_t P>
+        friend void serialize::binary::Serialize(std::ostream& stream, const SparseSet<U, K, P>& in);
+
+        template<class U, std::unsigned_integral K, size_t P>
+        friend void serialize::binary::Deserialize(std::istream& stream, SparseSet<U, K, P>& out);
+
+        template<class U, std::unsigned_integral K, size_t P>
+        friend auto serialize::binary::SerializedSize(const SparseSet<U, K, P>& in) -> size_t;
+
+        static constexpr auto NullIndex = std::numeric_limits<Key>::max();
+
+        std::vector<Key> m_keys;
+        std::vector<T> m_values;
+        std::vector<std::vector<Key>> m_pages;
+
+        // Get the sparse entry for a key, allocating its page if needed.
+        auto SparseEntry(Key key) -> Key&
+        {
+            const auto page = static_cast<size_t>(key) / PageSize;
+            if (page >= m_pages.size())
+                m_pages.resize(page + 1);
+
+            if (m_pages[page].empty())
+                m_pages[page].assign(PageSize, NullIndex);
+
+            return m_pages[page][static_cast<size_t>(key) & (PageSize - 1)];
+        }
+};
+} // namespace nc
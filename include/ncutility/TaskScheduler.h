@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nc
+{
+/** @cond internal */
+namespace detail
+{
+class Task;
+class WorkStealingDeque;
+
+// Hands out chunks of [0, count) to the participants of a ParallelFor. Chunks start large and shrink
+// as the range is consumed (guided scheduling), so early chunks amortize claiming overhead while the
+// small final chunks even out imbalance between participants.
+class ChunkRange
+{
+    public:
+        ChunkRange(size_t count, size_t minChunkSize, size_t participants) noexcept
+            : m_next{0}, m_count{count}, m_minChunkSize{minChunkSize}, m_divisor{2 * participants}
+        {
+        }
+
+        // Claim the next chunk, returning an empty range once all chunks are claimed.
+        auto Claim() noexcept -> std::pair<size_t, size_t>
+        {
+            auto begin = m_next.load(std::memory_order_relaxed);
+            while (begin < m_count)
+            {
+                const auto remaining = m_count - begin;
+                const auto size = std::min(remaining, std::max(m_minChunkSize, remaining / m_divisor));
+                if (m_next.compare_exchange_weak(begin, begin + size, std::memory_order_relaxed))
+                    return {begin, begin + size};
+            }
+
+            return {m_count, m_count};
+        }
+
+        // Stop handing out chunks, e.g. after an exception.
+        void Cancel() noexcept
+        {
+            m_next.store(m_count, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<size_t> m_next;
+        size_t m_count;
+        size_t m_minChunkSize;
+        size_t m_divisor;
+};
+} // namespace detail
+/** @endcond internal */
+
+/** @brief A reference to a task scheduled with a TaskScheduler. Default constructed handles are always done. */
+class TaskHandle
+{
+    public:
+        TaskHandle() noexcept = default;
+        TaskHandle(const TaskHandle& other) noexcept;
+        TaskHandle(TaskHandle&& other) noexcept;
+        auto operator=(const TaskHandle& other) noexcept -> TaskHandle&;
+        auto operator=(TaskHandle&& other) noexcept -> TaskHandle&;
+        ~TaskHandle() noexcept;
+
+        /** @brief Check if the task has finished running, or was skipped due to a failed dependency. */
+        auto IsDone() const noexcept -> bool;
+
+    private:
+        friend class TaskScheduler;
+        detail::Task* m_task = nullptr;
+
+        explicit TaskHandle(detail::Task* task) noexcept;
+};
+
+/**
+ * @brief A work-stealing task scheduler.
+ *
+ * Each worker thread owns a Chase-Lev deque. Tasks scheduled from a worker are pushed to its own deque
+ * and run in LIFO order, keeping recently produced data in cache, while idle workers steal the oldest
+ * tasks from others. Tasks scheduled from other threads go through a shared queue. Workers sleep when
+ * no tasks are queued.
+ *
+ * Waiting on a task helps run queued tasks rather than blocking, so tasks may wait on other tasks
+ * (including ParallelFor() within a task) without starving the pool. A waiting thread only blocks once
+ * no queued work remains.
+ *
+ * Exceptions thrown by a task are captured and rethrown from Wait(). A task whose dependency threw is
+ * not run, and reports the dependency's exception instead.
+ *
+ * @note Default() provides the shared scheduler used by NcUtility's parallel algorithms.
+ */
+class TaskScheduler
+{
+    public:
+        /** @brief Get the default number of worker threads, one less than the number of hardware threads. */
+        static auto DefaultWorkerCount() noexcept -> size_t;
+
+        /** @brief Get the shared scheduler, which is created on first use with DefaultWorkerCount() workers. */
+        static auto Default() -> TaskScheduler&;
+
+        /** @param workerCount The number of worker threads to create. The waiting thread also runs tasks. */
+        explicit TaskScheduler(size_t workerCount = DefaultWorkerCount());
+
+        /** @brief Runs any queued tasks to completion and joins the worker threads. */
+        ~TaskScheduler() noexcept;
+
+        TaskScheduler(TaskScheduler&&) = delete;
+        TaskScheduler(const TaskScheduler&) = delete;
+        void operator=(const TaskScheduler&) = delete;
+        void operator=(TaskScheduler&&) = delete;
+
+        /** @brief Get the number of worker threads. */
+        auto WorkerCount() const noexcept -> size_t { return m_threads.size(); }
+
+        /** @brief Schedule a task to run as soon as possible. */
+        auto Schedule(std::function<void()> fn) -> TaskHandle;
+
+        /** @brief Schedule a task to run once all of its dependencies are done. */
+        auto Schedule(std::function<void()> fn, std::span<const TaskHandle> dependencies) -> TaskHandle;
+
+        /** @copydoc Schedule(std::function<void()>, std::span<const TaskHandle>) */
+        auto Schedule(std::function<void()> fn, std::initializer_list<TaskHandle> dependencies) -> TaskHandle
+        {
+            return Schedule(std::move(fn), std::span<const TaskHandle>{dependencies.begin(), dependencies.size()});
+        }
+
+        /**
+         * @brief Wait for a task to finish, running queued tasks in the meantime.
+         * @throw Rethrows any exception thrown by the task or its dependencies.
+         */
+        void Wait(const TaskHandle& task);
+
+        /**
+         * @brief Invoke fn over [0, count) in parallel, returning once all invocations are complete.
+         *
+         * fn is invoked either as `fn(size_t begin, size_t end)` with contiguous chunks of the range, or
+         * as `fn(size_t index)` for each index. Chunks are claimed dynamically and shrink as the range is
+         * consumed, adapting to uneven work. The calling thread participates.
+         *
+         * @param minChunkSize The smallest number of indices handed out together.
+         * @param maxConcurrency The maximum number of threads to use, or 0 for no limit.
+         * @throw Rethrows the first exception thrown by fn, after all running invocations finish.
+         */
+        template<class F>
+        void ParallelFor(size_t count, F&& fn, size_t minChunkSize = 1, size_t maxConcurrency = 0);
+
+    private:
+        std::vector<std::unique_ptr<detail::WorkStealingDeque>> m_queues;
+        std::deque<detail::Task*> m_injected;
+        std::mutex m_injectedMutex;
+        std::atomic<size_t> m_queuedCount;
+        std::atomic<size_t> m_sleepingCount;
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wake;
+        bool m_stopping;
+        std::vector<std::thread> m_threads;
+
+        void Run(size_t workerIndex);
+        void Enqueue(detail::Task* task);
+        void Execute(detail::Task* task);
+        void Complete(detail::Task* task);
+        void Resolve(detail::Task* task);
+        auto FindTask(size_t workerIndex) -> detail::Task*;
+        auto CurrentWorkerIndex() const noexcept -> size_t;
+};
+
+template<class F>
+void TaskScheduler::ParallelFor(size_t count, F&& fn, size_t minChunkSize, size_t maxConcurrency)
+{
+    minChunkSize = std::max(minChunkSize, size_t{1});
+    const auto chunkCount = (count + minChunkSize - 1) / minChunkSize;
+    const auto concurrencyLimit = maxConcurrency == 0 ? std::numeric_limits<size_t>::max() : maxConcurrency;
+    const auto participants = std::min({WorkerCount() + 1, concurrencyLimit, chunkCount});
+    auto range = detail::ChunkRange{count, minChunkSize, std::max(participants, size_t{1})};
+    auto body = [&range, &fn]()
+    {
+        try
+        {
+            for (auto [begin, end] = range.Claim(); begin != end; std::tie(begin, end) = range.Claim())
+            {
+                if constexpr (std::is_invocable_v<F&, size_t, size_t>)
+                    fn(begin, end);
+                else
+                    for (auto i = begin; i < end; ++i) fn(i);
+            }
+        }
+        catch (...)
+        {
+            range.Cancel();
+            throw;
+        }
+    };
+
+    if (participants <= 1)
+    {
+        body();
+        return;
+    }
+
+    auto helpers = std::vector<TaskHandle>{};
+    helpers.reserve(participants - 1);
+    for (auto i = size_t{1}; i < participants; ++i)
+        helpers.push_back(Schedule(body));
+
+    auto error = std::exception_ptr{};
+    try
+    {
+        body();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // Helpers reference this frame, so all must finish before returning or rethrowing.
+    for (const auto& helper : helpers)
+    {
+        try
+        {
+            Wait(helper);
+        }
+        catch (...)
+        {
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+} // namespace nc
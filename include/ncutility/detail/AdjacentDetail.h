@@ -0,0 +1,300 @@
+#pragma once
+
+// Implementation of c++23 std::views::adjacent. Elements are tuples of references to N consecutive
+// elements of the underlying range.
+
+#include "EnumerateDetail.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <utility>
+
+namespace nc::algo::detail {
+template<class T, size_t>
+using repeat_t = T;
+
+template<class T, class Indices>
+struct repeat_tuple;
+
+template<class T, size_t... I>
+struct repeat_tuple<T, std::index_sequence<I...>>
+{
+    using type = std::tuple<repeat_t<T, I>...>;
+};
+
+template<std::ranges::forward_range V, size_t N>
+    requires std::ranges::view<V> && (N > 0)
+class adjacent_view : public std::ranges::view_interface<adjacent_view<V, N>>
+{
+    V m_base = {};
+
+    template<bool>
+    struct sentinel;
+
+    template<bool Const>
+    struct iterator
+    {
+      private:
+        using Base = std::conditional_t<Const, const V, V>;
+        using base_iterator = std::ranges::iterator_t<Base>;
+
+        // Iterators to each element of the current window. Only the last is compared, as the others
+        // trail it by a fixed distance.
+        std::array<base_iterator, N> m_its = {};
+
+        template <bool>
+        friend struct iterator;
+
+      public:
+        using iterator_category = decltype(iter_cat<Base>());
+        using reference = typename repeat_tuple<std::ranges::range_reference_t<Base>, std::make_index_sequence<N>>::type;
+        using value_type = reference;
+        using difference_type = std::ranges::range_difference_t<Base>;
+
+        iterator() = default;
+
+        constexpr iterator(base_iterator first, std::ranges::sentinel_t<Base> last)
+        {
+            m_its[0] = first;
+            for (auto i = size_t{1}; i < N; ++i)
+                m_its[i] = std::ranges::next(m_its[i - 1], 1, last);
+        }
+
+        // Construct the past-the-end iterator of a common range.
+        constexpr iterator(std::ranges::sentinel_t<Base> last, base_iterator first, std::true_type)
+        {
+            if constexpr (std::ranges::bidirectional_range<Base>)
+            {
+                m_its[N - 1] = last;
+                for (auto i = N - 1; i > 0; --i)
+                    m_its[i - 1] = std::ranges::prev(m_its[i], 1, first);
+            }
+            else
+            {
+                m_its.fill(last);
+            }
+        }
+
+        constexpr iterator(iterator<!Const> i)
+            requires Const &&
+                     std::convertible_to<std::ranges::iterator_t<V>, base_iterator>
+        {
+            std::ranges::move(i.m_its, m_its.begin());
+        }
+
+        constexpr auto operator*() const
+        {
+            return [this]<size_t... I>(std::index_sequence<I...>)
+            {
+                return reference{*m_its[I]...};
+            }(std::make_index_sequence<N>{});
+        }
+
+        constexpr auto operator++() -> iterator&
+        {
+            for (auto& it : m_its) ++it;
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> iterator
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        constexpr auto operator--() -> iterator&
+            requires std::ranges::bidirectional_range<Base>
+        {
+            for (auto& it : m_its) --it;
+            return *this;
+        }
+
+        constexpr auto operator--(int) -> iterator
+            requires std::ranges::bidirectional_range<Base>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        constexpr auto operator+=(difference_type n) -> iterator&
+            requires std::ranges::random_access_range<Base>
+        {
+            for (auto& it : m_its) it += n;
+            return *this;
+        }
+
+        constexpr auto operator-=(difference_type n) -> iterator&
+            requires std::ranges::random_access_range<Base>
+        {
+            for (auto& it : m_its) it -= n;
+            return *this;
+        }
+
+        friend constexpr auto operator+(const iterator& i, difference_type n) -> iterator
+            requires std::ranges::random_access_range<Base>
+        {
+            auto out = i;
+            return out += n;
+        }
+
+        friend constexpr auto operator+(difference_type n, const iterator& i) -> iterator
+            requires std::ranges::random_access_range<Base>
+        {
+            return i + n;
+        }
+
+        friend constexpr auto operator-(const iterator& i, difference_type n) -> iterator
+            requires std::ranges::random_access_range<Base>
+        {
+            auto out = i;
+            return out -= n;
+        }
+
+        constexpr auto operator[](difference_type n) const
+            requires std::ranges::random_access_range<Base>
+        {
+            return *(*this + n);
+        }
+
+        friend constexpr auto operator==(const iterator& x, const iterator& y) -> bool
+        {
+            return x.m_its.back() == y.m_its.back();
+        }
+
+        friend constexpr auto operator<=>(const iterator& x, const iterator& y)
+            requires std::ranges::random_access_range<Base> &&
+                     std::three_way_comparable<base_iterator>
+        {
+            return x.m_its.back() <=> y.m_its.back();
+        }
+
+        friend constexpr auto operator-(const iterator& x, const iterator& y) -> difference_type
+            requires std::sized_sentinel_for<base_iterator, base_iterator>
+        {
+            return x.m_its.back() - y.m_its.back();
+        }
+
+        friend constexpr auto operator==(const iterator& x, const sentinel<Const>& y) -> bool
+        {
+            return x.m_its.back() == y.base();
+        }
+
+        friend constexpr auto operator-(const sentinel<Const>& x, const iterator& y) -> difference_type
+            requires std::sized_sentinel_for<std::ranges::sentinel_t<Base>, base_iterator>
+        {
+            return x.base() - y.m_its.back();
+        }
+
+        friend constexpr auto operator-(const iterator& x, const sentinel<Const>& y) -> difference_type
+            requires std::sized_sentinel_for<std::ranges::sentinel_t<Base>, base_iterator>
+        {
+            return x.m_its.back() - y.base();
+        }
+    };
+
+    template<bool Const>
+    struct sentinel
+    {
+      private:
+        using Base = std::conditional_t<Const, const V, V>;
+
+        std::ranges::sentinel_t<Base> m_end = std::ranges::sentinel_t<Base>();
+
+      public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(std::ranges::sentinel_t<Base> end)
+            : m_end(std::move(end))
+        {
+        }
+
+        constexpr auto base() const -> std::ranges::sentinel_t<Base>
+        {
+            return m_end;
+        }
+    };
+
+    template<bool Const>
+    constexpr auto make_end(auto& base) const
+    {
+        using Base = std::conditional_t<Const, const V, V>;
+        if constexpr (std::ranges::common_range<Base>)
+            return iterator<Const>{std::ranges::end(base), std::ranges::begin(base), std::true_type{}};
+        else
+            return sentinel<Const>{std::ranges::end(base)};
+    }
+
+    static constexpr auto make_size(auto& base)
+    {
+        auto size = std::ranges::size(base);
+        return size - std::min(size, static_cast<decltype(size)>(N - 1));
+    }
+
+  public:
+    constexpr adjacent_view() = default;
+    constexpr explicit adjacent_view(V base)
+        : m_base(std::move(base))
+    {
+    }
+
+    constexpr auto begin() requires(!simple_view<V>)
+    {
+        return iterator<false>{std::ranges::begin(m_base), std::ranges::end(m_base)};
+    }
+
+    constexpr auto begin() const requires std::ranges::forward_range<const V>
+    {
+        return iterator<true>{std::ranges::begin(m_base), std::ranges::end(m_base)};
+    }
+
+    constexpr auto end() requires(!simple_view<V>)
+    {
+        return make_end<false>(m_base);
+    }
+
+    constexpr auto end() const requires std::ranges::forward_range<const V>
+    {
+        return make_end<true>(m_base);
+    }
+
+    constexpr auto size() requires std::ranges::sized_range<V>
+    {
+        return make_size(m_base);
+    }
+
+    constexpr auto size() const
+        requires std::ranges::sized_range<const V>
+    {
+        return make_size(m_base);
+    }
+
+    constexpr auto base() const & -> V
+        requires std::copyable<V>
+    {
+        return m_base;
+    }
+
+    constexpr V base() &&
+    {
+        return std::move(m_base);
+    }
+};
+
+template<size_t N>
+struct adjacent_view_fn {
+    template<std::ranges::forward_range R>
+    constexpr auto operator()(R&& r) const {
+        return adjacent_view<std::ranges::views::all_t<R>, N>{std::views::all(std::forward<R>(r))};
+    }
+
+    template<std::ranges::forward_range R>
+    constexpr friend auto operator|(R&& rng, const adjacent_view_fn& fn) {
+        return fn(std::forward<R>(rng));
+    }
+};
+} // namespace nc::algo::detail
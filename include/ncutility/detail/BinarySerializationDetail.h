@@ -1,17 +1,45 @@
 #pragma once
 
+#include "AggregateReflectionDetail.h"
+#include "ncutility/Blob.h"
+#include "ncutility/ByteOrder.h"
+#include "ncutility/DeserializationContext.h"
 #include "ncutility/NcError.h"
+#include "ncutility/SlotMap.h"
+#include "ncutility/SmallVector.h"
+#include "ncutility/SparseSet.h"
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <optional>
 #include <ranges>
+#include <set>
+#include <span>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <variant>
 #include <vector>
 
 /** @cond internal */
+namespace nc::serialize::adl
+{
+// Satisfied for types with a Serialize function found via adl. Declared outside of the binary
+// namespace so the default overloads aren't considered.
+template<class T>
+concept HasSerialize = requires(std::ostream& stream, const T& obj)
+{
+    Serialize(stream, obj); // intentional ADL
+};
+} // namespace nc::serialize::adl
+
 namespace nc::serialize::binary
 {
 template<class T>
@@ -20,58 +48,9 @@ concept TriviallyCopyable = requires { requires std::is_trivially_copyable_v<T>;
 template<class T>
 concept Aggregate = requires { requires std::is_aggregate_v<T>; };
 
-// Max supported member count for automatic aggregate serialization
-inline constexpr auto g_aggregateMaxMemberCount = 16ull;
-
-// Arbitrarily large value returned from MemberCount() when a type has too many members.
-inline constexpr size_t g_failedMemberCount = 0xFFFFFFFFFFFFFFFF;
-
-// A type which is implicitly convertable to all other types
-struct UniversalType{ template<class T> operator T() const; };
-
-// Count the number of members in an aggregate, returns g_failedMemberCount for types with > 16 members
-template<class T>
-    requires requires { std::is_aggregate_v<T>; }
-consteval auto MemberCount() -> size_t
-{
-    using U = UniversalType;
-    if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return g_failedMemberCount;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 16ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 15ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 14ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 13ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 12ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 11ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 10ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 9ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 8ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 7ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}, U{}}; })
-        return 6ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}, U{}}; })
-        return 5ull;
-    else if constexpr (requires { T{U{}, U{}, U{}, U{}}; })
-        return 4ull;
-    else if constexpr (requires { T{U{}, U{}, U{}}; })
-        return 3ull;
-    else if constexpr (requires { T{U{}, U{}}; })
-        return 2ull;
-    else if constexpr (requires { T{U{}}; })
-        return 1ull;
-    else
-        return 0ull;
-}
+// Concept for types whose nested (de)serialization resolves to a user-provided overload
+template<class T>
+concept HasCustomSerialize = nc::serialize::adl::HasSerialize<T>;
 
 // Concept for aggregate types that have automatic serialization support
 template<class T>
@@ -88,8 +67,25 @@ void Serialize(std::ostream& stream, const T& in);
 template<UnpackableAggregate T>
 void Serialize(std::ostream& stream, const T& in);
 
+template<class Char, class Traits, class Alloc>
+void Serialize(std::ostream& stream, const std::basic_string<Char, Traits, Alloc>& in);
+
+template<class T, class Alloc>
+void Serialize(std::ostream& stream, const std::vector<T, Alloc>& in);
+
+template<class T, size_t N>
+void Serialize(std::ostream& stream, const SmallVector<T, N>& in);
+
 template<class T>
-void Serialize(std::ostream& stream, const std::vector<T>& in);
+void Serialize(std::ostream& stream, const SlotMap<T>& in);
+
+template<class T, std::unsigned_integral Key, size_t PageSize>
+void Serialize(std::ostream& stream, const SparseSet<T, Key, PageSize>& in);
+
+inline void Serialize(std::ostream& stream, const Blob& in);
+
+template<class T, class Alloc>
+void Serialize(std::ostream& stream, const std::deque<T, Alloc>& in);
 
 template<class T, size_t I>
 void Serialize(std::ostream& stream, const std::array<T, I>& in);
@@ -97,8 +93,23 @@ void Serialize(std::ostream& stream, const std::array<T, I>& in);
 template<class T, class U>
 void Serialize(std::ostream& stream, const std::pair<T, U>& in);
 
-template<class K, class V>
-void Serialize(std::ostream& stream, const std::unordered_map<K, V>& in);
+template<class... Ts>
+void Serialize(std::ostream& stream, const std::tuple<Ts...>& in);
+
+template<class... Ts>
+void Serialize(std::ostream& stream, const std::variant<Ts...>& in);
+
+template<class K, class V, class Hash, class Eq, class Alloc>
+void Serialize(std::ostream& stream, const std::unordered_map<K, V, Hash, Eq, Alloc>& in);
+
+template<class K, class Hash, class Eq, class Alloc>
+void Serialize(std::ostream& stream, const std::unordered_set<K, Hash, Eq, Alloc>& in);
+
+template<class K, class V, class Compare, class Alloc>
+void Serialize(std::ostream& stream, const std::map<K, V, Compare, Alloc>& in);
+
+template<class K, class Compare, class Alloc>
+void Serialize(std::ostream& stream, const std::set<K, Compare, Alloc>& in);
 
 template<class T>
 void Serialize(std::ostream& stream, const std::optional<T>& in);
@@ -112,8 +123,25 @@ void Deserialize(std::istream& stream, T& in);
 template<UnpackableAggregate T>
 void Deserialize(std::istream& stream, T& out);
 
+template<class Char, class Traits, class Alloc>
+void Deserialize(std::istream& stream, std::basic_string<Char, Traits, Alloc>& out);
+
+template<class T, class Alloc>
+void Deserialize(std::istream& stream, std::vector<T, Alloc>& out);
+
+template<class T, size_t N>
+void Deserialize(std::istream& stream, SmallVector<T, N>& out);
+
 template<class T>
-void Deserialize(std::istream& stream, std::vector<T>& out);
+void Deserialize(std::istream& stream, SlotMap<T>& out);
+
+template<class T, std::unsigned_integral Key, size_t PageSize>
+void Deserialize(std::istream& stream, SparseSet<T, Key, PageSize>& out);
+
+inline void Deserialize(std::istream& stream, Blob& out);
+
+template<class T, class Alloc>
+void Deserialize(std::istream& stream, std::deque<T, Alloc>& out);
 
 template<class T, size_t I>
 void Deserialize(std::istream& stream, std::array<T, I>& out);
@@ -121,363 +149,1165 @@ void Deserialize(std::istream& stream, std::array<T, I>& out);
 template<class T, class U>
 void Deserialize(std::istream& stream, std::pair<T, U>& out);
 
-template<class K, class V>
-void Deserialize(std::istream& stream, std::unordered_map<K, V>& out);
+template<class... Ts>
+void Deserialize(std::istream& stream, std::tuple<Ts...>& out);
+
+template<class... Ts>
+void Deserialize(std::istream& stream, std::variant<Ts...>& out);
+
+template<class K, class V, class Hash, class Eq, class Alloc>
+void Deserialize(std::istream& stream, std::unordered_map<K, V, Hash, Eq, Alloc>& out);
+
+template<class K, class Hash, class Eq, class Alloc>
+void Deserialize(std::istream& stream, std::unordered_set<K, Hash, Eq, Alloc>& out);
+
+template<class K, class V, class Compare, class Alloc>
+void Deserialize(std::istream& stream, std::map<K, V, Compare, Alloc>& out);
+
+template<class K, class Compare, class Alloc>
+void Deserialize(std::istream& stream, std::set<K, Compare, Alloc>& out);
 
 template<class T>
 void Deserialize(std::istream& stream, std::optional<T>& out);
 
-template<class... Args>
-void SerializeMultiple(std::ostream& stream, Args&&... args)
+// Sentinel returned from FixedSerializedSize() for types with a value-dependent encoded size.
+inline constexpr size_t g_variableSerializedSize = 0xFFFFFFFFFFFFFFFF;
+
+template<class... Ts>
+struct TypeList {};
+
+// The member types of an aggregate as a TypeList.
+template<class T>
+using MemberTypes = decltype(VisitMembers(std::declval<T&>(), [](auto&... members)
 {
-    (Serialize(stream, args), ...);
-}
+    return TypeList<std::remove_cvref_t<decltype(members)>...>{};
+}));
 
-template<class... Args>
-void DeserializeMultiple(std::istream& stream, Args&&... args)
+template<class T>
+consteval auto FixedSerializedSize() -> size_t;
+
+template<class... Ts>
+consteval auto FixedSerializedSize(TypeList<Ts...>) -> size_t
 {
-    (Deserialize(stream, args), ...);
+    if constexpr (((FixedSerializedSize<Ts>() != g_variableSerializedSize) && ...))
+        return (size_t{0} + ... + FixedSerializedSize<Ts>());
+    else
+        return g_variableSerializedSize;
 }
 
-template<class C>
-void SerializeTrivialContainer(std::ostream& stream, const C& container)
+// Computes the encoded size of types whose size doesn't depend on their value. Specializations
+// mirror the Serialize() overload set.
+template<class T>
+struct FixedSerializedSizeTraits
 {
-    Serialize(stream, container.size());
-    stream.write(reinterpret_cast<const char*>(container.data()), sizeof(typename C::value_type) * container.size());
-}
+    static consteval auto Get() -> size_t
+    {
+        if constexpr (HasCustomSerialize<T>)
+            return g_variableSerializedSize;
+        else if constexpr (TriviallyCopyable<T>)
+            return sizeof(T);
+        else if constexpr (UnpackableAggregate<T>)
+            return FixedSerializedSize(MemberTypes<T>{});
+        else
+            return g_variableSerializedSize;
+    }
+};
 
-template<class C>
-void DeserializeTrivialContainer(std::istream& stream, C& container)
+template<class T, size_t I>
+struct FixedSerializedSizeTraits<std::array<T, I>>
 {
-    auto size = size_t{};
-    Deserialize(stream, size);
-    container.resize(size);
-    stream.read(reinterpret_cast<char*>(container.data()), sizeof(typename C::value_type) * size);
-}
+    static consteval auto Get() -> size_t
+    {
+        constexpr auto elementSize = std::is_trivially_copyable_v<T> ? sizeof(T) : FixedSerializedSize<T>();
+        if constexpr (elementSize == g_variableSerializedSize)
+            return g_variableSerializedSize;
+        else
+            return sizeof(size_t) + I * elementSize;
+    }
+};
 
-template<class C>
-void SerializeNonTrivialContainer(std::ostream& stream, const C& container)
+template<class T, class U>
+struct FixedSerializedSizeTraits<std::pair<T, U>>
 {
-    auto size = container.size();
-    stream.write(reinterpret_cast<char*>(&size), sizeof(size));
-    for (const auto& obj : container) Serialize(stream, obj);
-}
+    static consteval auto Get() -> size_t
+    {
+        return FixedSerializedSize(TypeList<T, U>{});
+    }
+};
 
-template<class C>
-void DeserializeNonTrivialContainer(std::istream& stream, C& container)
+template<class... Ts>
+struct FixedSerializedSizeTraits<std::tuple<Ts...>>
 {
-    auto count = size_t{};
-    Deserialize(stream, count);
-    container.reserve(count);
-    std::generate_n(std::back_inserter(container), count, [&stream]()
+    static consteval auto Get() -> size_t
     {
-        auto out = typename C::value_type{};
-        Deserialize(stream, out);
-        return out;
-    });
-}
+        return FixedSerializedSize(TypeList<Ts...>{});
+    }
+};
 
-template<TriviallyCopyable T>
-void Serialize(std::ostream& stream, const T& in)
+template<class... Ts>
+struct FixedSerializedSizeTraits<std::variant<Ts...>>
 {
-    stream.write(reinterpret_cast<const char*>(&in), sizeof(T));
-}
+    static consteval auto Get() -> size_t
+    {
+        return g_variableSerializedSize;
+    }
+};
 
-template<TriviallyCopyable T>
-void Deserialize(std::istream& stream, T& out)
+template<class T>
+struct FixedSerializedSizeTraits<std::optional<T>>
 {
-    stream.read(reinterpret_cast<char*>(&out), sizeof(T));
-}
+    static consteval auto Get() -> size_t
+    {
+        return g_variableSerializedSize;
+    }
+};
 
-template<>
-inline void Serialize(std::ostream& stream, const std::string& in)
+// Get the encoded size of T at compile time, or g_variableSerializedSize if it depends on the value.
+template<class T>
+consteval auto FixedSerializedSize() -> size_t
 {
-    SerializeTrivialContainer(stream, in);
+    return FixedSerializedSizeTraits<std::remove_cv_t<T>>::Get();
 }
 
-template<>
-inline void Deserialize(std::istream& stream, std::string& out)
+// Concept for types which always serialize to the same number of bytes.
+template<class T>
+concept FixedSize = (FixedSerializedSize<T>() != g_variableSerializedSize);
+
+// Indicates if the default encoding of a type is exactly its object representation, allowing
+// ranges of it to be written in bulk without changing the output.
+template<class T>
+inline constexpr bool g_isBitwise = TriviallyCopyable<T> && !HasCustomSerialize<T>;
+
+template<class T, size_t I>
+inline constexpr bool g_isBitwise<std::array<T, I>> = false;
+
+template<class T, class U>
+inline constexpr bool g_isBitwise<std::pair<T, U>> = false;
+
+template<class... Ts>
+inline constexpr bool g_isBitwise<std::tuple<Ts...>> = false;
+
+template<class... Ts>
+inline constexpr bool g_isBitwise<std::variant<Ts...>> = false;
+
+template<class T>
+inline constexpr bool g_isBitwise<std::optional<T>> = false;
+
+template<class T>
+consteval auto MinSerializedSize() -> size_t;
+
+template<class... Ts>
+consteval auto MinSerializedSize(TypeList<Ts...>) -> size_t
 {
-    DeserializeTrivialContainer(stream, out);
+    return (size_t{0} + ... + MinSerializedSize<Ts>());
 }
 
+// Computes a lower bound on the encoded size of a type. Used to reject container lengths which
+// can't possibly be satisfied by the remaining input. Unknown types are assumed to be empty.
 template<class T>
-void Serialize(std::ostream& stream, const std::vector<T>& in)
+struct MinSerializedSizeTraits
 {
-    if constexpr (std::is_trivially_copyable_v<T>)
-        SerializeTrivialContainer(stream, in);
-    else
-        SerializeNonTrivialContainer(stream, in);
-}
+    static consteval auto Get() -> size_t
+    {
+        if constexpr (FixedSize<T>)
+            return FixedSerializedSize<T>();
+        else if constexpr (UnpackableAggregate<T> && !HasCustomSerialize<T>)
+            return MinSerializedSize(MemberTypes<T>{});
+        else
+            return 0ull;
+    }
+};
+
+// Containers and variants are prefixed with a size or index.
+struct PrefixedMinSerializedSize
+{
+    static consteval auto Get() -> size_t
+    {
+        return sizeof(size_t);
+    }
+};
+
+template<class Char, class Traits, class Alloc>
+struct MinSerializedSizeTraits<std::basic_string<Char, Traits, Alloc>> : PrefixedMinSerializedSize {};
+
+template<class T, class Alloc>
+struct MinSerializedSizeTraits<std::vector<T, Alloc>> : PrefixedMinSerializedSize {};
 
+template<class T, size_t N>
+struct MinSerializedSizeTraits<SmallVector<T, N>> : PrefixedMinSerializedSize {};
+
+// SlotMaps hold three prefixed arrays: slots, the dense to slot mapping, and values.
 template<class T>
-void Deserialize(std::istream& stream, std::vector<T>& out)
+struct MinSerializedSizeTraits<SlotMap<T>>
 {
-    if constexpr (std::is_trivially_copyable_v<T>)
-        DeserializeTrivialContainer(stream, out);
-    else
-        DeserializeNonTrivialContainer(stream, out);
-}
+    static consteval auto Get() -> size_t
+    {
+        return 3 * sizeof(size_t);
+    }
+};
 
-template<class T, size_t I>
-void Serialize(std::ostream& stream, const std::array<T, I>& in)
+// SparseSets hold two prefixed arrays: keys and values.
+template<class T, std::unsigned_integral Key, size_t PageSize>
+struct MinSerializedSizeTraits<SparseSet<T, Key, PageSize>>
 {
-    if constexpr(std::is_trivially_copyable_v<T>)
-        SerializeTrivialContainer(stream, in);
-    else
-        SerializeNonTrivialContainer(stream, in);
-}
+    static consteval auto Get() -> size_t
+    {
+        return 2 * sizeof(size_t);
+    }
+};
+
+template<>
+struct MinSerializedSizeTraits<Blob> : PrefixedMinSerializedSize {};
+
+template<class T, class Alloc>
+struct MinSerializedSizeTraits<std::deque<T, Alloc>> : PrefixedMinSerializedSize {};
+
+template<class K, class V, class Hash, class Eq, class Alloc>
+struct MinSerializedSizeTraits<std::unordered_map<K, V, Hash, Eq, Alloc>> : PrefixedMinSerializedSize {};
+
+template<class K, class Hash, class Eq, class Alloc>
+struct MinSerializedSizeTraits<std::unordered_set<K, Hash, Eq, Alloc>> : PrefixedMinSerializedSize {};
+
+template<class K, class V, class Compare, class Alloc>
+struct MinSerializedSizeTraits<std::map<K, V, Compare, Alloc>> : PrefixedMinSerializedSize {};
+
+template<class K, class Compare, class Alloc>
+struct MinSerializedSizeTraits<std::set<K, Compare, Alloc>> : PrefixedMinSerializedSize {};
+
+template<class... Ts>
+struct MinSerializedSizeTraits<std::variant<Ts...>> : PrefixedMinSerializedSize {};
 
 template<class T, size_t I>
-void Deserialize(std::istream& stream, std::array<T, I>& out)
+struct MinSerializedSizeTraits<std::array<T, I>>
 {
-    auto size = size_t{};
-    Deserialize(stream, size);
-    NC_ASSERT(size == out.size(), "Expected array size does not match stream contents");
-
-    if constexpr(std::is_trivially_copyable_v<T>)
+    static consteval auto Get() -> size_t
     {
-        stream.read(reinterpret_cast<char*>(out.data()), sizeof(T) * size);
+        return sizeof(size_t) + I * (std::is_trivially_copyable_v<T> ? sizeof(T) : MinSerializedSize<T>());
     }
-    else
+};
+
+template<class T>
+struct MinSerializedSizeTraits<std::optional<T>>
+{
+    static consteval auto Get() -> size_t
     {
-        std::ranges::for_each(out, [&stream](auto&& obj)
-        {
-            Deserialize(stream, obj);
-        });
+        return sizeof(bool);
     }
-}
+};
 
 template<class T, class U>
-void Serialize(std::ostream& stream, const std::pair<T, U>& in)
+struct MinSerializedSizeTraits<std::pair<T, U>>
 {
-    SerializeMultiple(stream, in.first, in.second);
-}
+    static consteval auto Get() -> size_t
+    {
+        return MinSerializedSize(TypeList<T, U>{});
+    }
+};
 
-template<class T, class U>
-void Deserialize(std::istream& stream, std::pair<T, U>& out)
+template<class... Ts>
+struct MinSerializedSizeTraits<std::tuple<Ts...>>
 {
-    DeserializeMultiple(stream, out.first, out.second);
-}
+    static consteval auto Get() -> size_t
+    {
+        return MinSerializedSize(TypeList<Ts...>{});
+    }
+};
 
-template<class K, class V>
-void Serialize(std::ostream& stream, const std::unordered_map<K, V>& in)
+template<class T>
+consteval auto MinSerializedSize() -> size_t
 {
-    SerializeNonTrivialContainer(stream, in);
+    return MinSerializedSizeTraits<std::remove_cv_t<T>>::Get();
 }
 
-template<class K, class V>
-void Deserialize(std::istream& stream, std::unordered_map<K, V>& out)
+// Check a container length read from the stream against the stream's DeserializationContext, if
+// one is attached. Must be called before allocating storage for the container.
+template<class T>
+void AcquireContainer(std::istream& stream, size_t count, size_t minElementBytes = MinSerializedSize<T>())
 {
-    auto count = size_t{};
-    Deserialize(stream, count);
-    out.reserve(count);
-    std::generate_n(std::inserter(out, std::end(out)), count, [&stream]()
-    {
-        auto pair = std::pair<K, V>{};
-        Deserialize(stream, pair);
-        return pair;
-    });
+    if (auto context = nc::serialize::DeserializationContext::Get(stream))
+        context->AcquireContainer(count, minElementBytes, sizeof(T));
 }
 
+template<TriviallyCopyable T>
+constexpr auto SerializedSize(const T& in) -> size_t;
+
+template<UnpackableAggregate T>
+constexpr auto SerializedSize(const T& in) -> size_t;
+
+template<class Char, class Traits, class Alloc>
+constexpr auto SerializedSize(const std::basic_string<Char, Traits, Alloc>& in) -> size_t;
+
+template<class T, class Alloc>
+constexpr auto SerializedSize(const std::vector<T, Alloc>& in) -> size_t;
+
+template<class T, size_t N>
+constexpr auto SerializedSize(const SmallVector<T, N>& in) -> size_t;
+
 template<class T>
-void Serialize(std::ostream& stream, const std::optional<T>& in)
+auto SerializedSize(const SlotMap<T>& in) -> size_t;
+
+template<class T, std::unsigned_integral Key, size_t PageSize>
+auto SerializedSize(const SparseSet<T, Key, PageSize>& in) -> size_t;
+
+inline auto SerializedSize(const Blob& in) -> size_t;
+
+template<class T, class Alloc>
+auto SerializedSize(const std::deque<T, Alloc>& in) -> size_t;
+
+template<class T, size_t I>
+constexpr auto SerializedSize(const std::array<T, I>& in) -> size_t;
+
+template<class T, class U>
+constexpr auto SerializedSize(const std::pair<T, U>& in) -> size_t;
+
+template<class... Ts>
+constexpr auto SerializedSize(const std::tuple<Ts...>& in) -> size_t;
+
+template<class... Ts>
+constexpr auto SerializedSize(const std::variant<Ts...>& in) -> size_t;
+
+template<class K, class V, class Hash, class Eq, class Alloc>
+auto SerializedSize(const std::unordered_map<K, V, Hash, Eq, Alloc>& in) -> size_t;
+
+template<class K, class Hash, class Eq, class Alloc>
+auto SerializedSize(const std::unordered_set<K, Hash, Eq, Alloc>& in) -> size_t;
+
+template<class K, class V, class Compare, class Alloc>
+auto SerializedSize(const std::map<K, V, Compare, Alloc>& in) -> size_t;
+
+template<class K, class Compare, class Alloc>
+auto SerializedSize(const std::set<K, Compare, Alloc>& in) -> size_t;
+
+template<class T>
+constexpr auto SerializedSize(const std::optional<T>& in) -> size_t;
+
+template<class... Args>
+constexpr auto SerializedSizeMultiple(const Args&... args) -> size_t
 {
-    in.has_value()
-        ? SerializeMultiple(stream, true, in.value())
-        : Serialize(stream, false);
+    return (size_t{0} + ... + SerializedSize(args));
 }
 
-template<class T>
-void Deserialize(std::istream& stream, std::optional<T>& out)
+template<class... Args>
+void SerializeMultiple(std::ostream& stream, Args&&... args)
 {
-    auto hasValue = false;
-    Deserialize(stream, hasValue);
-    if (hasValue)
-    {
-        out = T{};
-        Deserialize(stream, out.value());
-    }
-    else
-    {
-        out = std::nullopt;
-    }
+    (Serialize(stream, args), ...);
 }
 
-template<UnpackableAggregate T>
-void Serialize(std::ostream& stream, const T& in)
+template<class... Args>
+void DeserializeMultiple(std::istream& stream, Args&&... args)
 {
-    static constexpr auto memberCount = MemberCount<T>();
-    static_assert(memberCount <= g_aggregateMaxMemberCount);
+    (Deserialize(stream, args), ...);
+}
 
-    if constexpr (memberCount == 16)
-    {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16);
-    }
-    else if constexpr (memberCount == 15)
-    {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
-    }
-    else if constexpr (memberCount == 14)
-    {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
-    }
-    else if constexpr (memberCount == 13)
-    {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
-    }
-    else if constexpr (memberCount == 12)
-    {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
-    }
-    else if constexpr (memberCount == 11)
-    {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
-    }
-    else if constexpr (memberCount == 10)
+template<size_t Size>
+using UnsignedOfSize = std::conditional_t<Size == 8, uint64_t, std::conditional_t<Size == 4, uint32_t, uint16_t>>;
+
+// Reverse the bytes of an unsigned integer. Written with shifts so it compiles to a bswap instruction,
+// and loops over contiguous scalars vectorize into byte shuffles where the target has them.
+template<std::unsigned_integral T>
+constexpr auto ByteSwap(T value) noexcept -> T
+{
+    auto out = T{0};
+    for (auto i = 0u; i < sizeof(T); ++i)
     {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
+        out = static_cast<T>((out << 8u) | (value & 0xFFu));
+        value = static_cast<T>(value >> 8u);
     }
-    else if constexpr (memberCount == 9)
+
+    return out;
+}
+
+// Reverse the bytes of each ScalarSize sized scalar within an object.
+template<size_t ScalarSize, class T>
+void SwapScalarsOfSize(T& obj)
+{
+    static_assert(sizeof(T) % ScalarSize == 0, "Object size must be a multiple of its scalar size");
+    if constexpr (ScalarSize > 1)
     {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9);
+        auto scalars = std::bit_cast<std::array<UnsignedOfSize<ScalarSize>, sizeof(T) / ScalarSize>>(obj);
+        for (auto& scalar : scalars) scalar = ByteSwap(scalar);
+        obj = std::bit_cast<T>(scalars);
     }
-    else if constexpr (memberCount == 8)
+}
+
+// Reverse the bytes of each scalar within a trivially copyable object. The object representation alone
+// doesn't say where an object's scalars lie, so aggregates are visited member-wise, or checked to hold
+// scalars of a single size, and other class types must declare their layout with UniformScalarLayout.
+template<class T>
+void SwapByteOrder(T& obj)
+{
+    constexpr auto declaredScalarSize = UniformScalarLayout<T>::ScalarSize;
+    if constexpr (sizeof(T) == 1)
     {
-        const auto& [m1, m2, m3, m4, m5, m6, m7, m8] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8);
+        return;
     }
-    else if constexpr (memberCount == 7)
+    else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
     {
-        const auto& [m1, m2, m3, m4, m5, m6, m7] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7);
+        if constexpr (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+            obj = std::bit_cast<T>(ByteSwap(std::bit_cast<UnsignedOfSize<sizeof(T)>>(obj)));
+        else
+            throw NcError("Cannot convert the byte order of a scalar of this size.", fmt::format("size: {}", sizeof(T)));
     }
-    else if constexpr (memberCount == 6)
+    else if constexpr (std::is_array_v<T>)
     {
-        const auto& [m1, m2, m3, m4, m5, m6] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5, m6);
+        for (auto& element : obj) SwapByteOrder(element);
     }
-    else if constexpr (memberCount == 5)
+    else if constexpr (requires { std::tuple_size<T>::value; obj[0]; })
     {
-        const auto& [m1, m2, m3, m4, m5] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4, m5);
+        for (auto& element : obj) SwapByteOrder(element);
     }
-    else if constexpr (memberCount == 4)
+    else if constexpr (declaredScalarSize != 0)
     {
-        const auto& [m1, m2, m3, m4] = in;
-        SerializeMultiple(stream, m1, m2, m3, m4);
+        static_assert(declaredScalarSize == 1 || declaredScalarSize == 2 || declaredScalarSize == 4 || declaredScalarSize == 8,
+                      "UniformScalarLayout::ScalarSize must be 1, 2, 4 or 8");
+        SwapScalarsOfSize<declaredScalarSize>(obj);
     }
-    else if constexpr (memberCount == 3)
+    else if constexpr (IsDecomposable<T>())
     {
-        const auto& [m1, m2, m3] = in;
-        SerializeMultiple(stream, m1, m2, m3);
+        VisitMembers(obj, [](auto&... members) { (SwapByteOrder(members), ...); });
     }
-    else if constexpr (memberCount == 2)
+    else if constexpr (Aggregate<T> && alignof(T) <= 8 && HasOnlyScalarsOfSize<T, alignof(T)>())
     {
-        const auto& [m1, m2] = in;
-        SerializeMultiple(stream, m1, m2);
+        SwapScalarsOfSize<alignof(T)>(obj);
     }
-    else if constexpr (memberCount == 1)
+    else
     {
-        const auto& [m1] = in;
-        SerializeMultiple(stream, m1);
+        throw NcError("Cannot convert the byte order of a trivially copyable type with an unknown layout.",
+            "Specialize UniformScalarLayout or provide Serialize()/Deserialize() overloads to use it with a non-native byte order.");
     }
 }
 
-template<UnpackableAggregate T>
-void Deserialize(std::istream& stream, T& out)
+// Check whether objects of type T must be byteswapped when (de)serialized with a stream.
+template<class T>
+auto NeedsByteSwap(std::ios_base& stream) -> bool
 {
-    static constexpr auto memberCount = MemberCount<T>();
-    static_assert(memberCount <= g_aggregateMaxMemberCount);
+    return sizeof(T) > 1 && GetByteOrder(stream) != g_nativeByteOrder;
+}
 
-    if constexpr (memberCount == 16)
+// Size of the stack buffer used to batch reads and writes of non-contiguous trivially copyable data.
+inline constexpr size_t g_batchBufferSize = 4096ull;
+
+// Write the object representation of each projected element of a range, batched through a stack buffer.
+template<std::ranges::input_range R, class Proj = std::identity>
+void WriteBatched(std::ostream& stream, const R& range, Proj proj = {})
+{
+    using value_t = std::remove_cvref_t<std::invoke_result_t<Proj&, std::ranges::range_reference_t<const R>>>;
+    static_assert(std::is_trivially_copyable_v<value_t>);
+    constexpr auto batchSize = std::max(g_batchBufferSize / sizeof(value_t), size_t{1});
+    alignas(value_t) char buffer[batchSize * sizeof(value_t)];
+    const auto swap = NeedsByteSwap<value_t>(stream);
+    auto count = size_t{0};
+    for (const auto& obj : range)
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16);
+        if (swap)
+        {
+            auto swapped = std::invoke(proj, obj);
+            SwapByteOrder(swapped);
+            std::memcpy(buffer + count * sizeof(value_t), &swapped, sizeof(value_t));
+        }
+        else
+        {
+            std::memcpy(buffer + count * sizeof(value_t), &std::invoke(proj, obj), sizeof(value_t));
+        }
+
+        if (++count == batchSize)
+        {
+            stream.write(buffer, static_cast<std::streamsize>(count * sizeof(value_t)));
+            count = 0;
+        }
     }
-    else if constexpr (memberCount == 15)
+
+    stream.write(buffer, static_cast<std::streamsize>(count * sizeof(value_t)));
+}
+
+// Read the object representation of each projected element of a range, batched through a stack buffer.
+template<std::ranges::input_range R, class Proj = std::identity>
+void ReadBatched(std::istream& stream, R& range, Proj proj = {})
+{
+    using value_t = std::remove_cvref_t<std::invoke_result_t<Proj&, std::ranges::range_reference_t<R>>>;
+    static_assert(std::is_trivially_copyable_v<value_t>);
+    constexpr auto batchSize = std::max(g_batchBufferSize / sizeof(value_t), size_t{1});
+    alignas(value_t) char buffer[batchSize * sizeof(value_t)];
+    const auto swap = NeedsByteSwap<value_t>(stream);
+    auto remaining = static_cast<size_t>(std::ranges::distance(range));
+    auto pos = std::ranges::begin(range);
+    while (remaining != 0)
+    {
+        const auto batch = std::min(batchSize, remaining);
+        stream.read(buffer, static_cast<std::streamsize>(batch * sizeof(value_t)));
+        for (auto i = size_t{0}; i < batch; ++i, ++pos)
+        {
+            std::memcpy(&std::invoke(proj, *pos), buffer + i * sizeof(value_t), sizeof(value_t));
+            if (swap)
+                SwapByteOrder(std::invoke(proj, *pos));
+        }
+
+        remaining -= batch;
+    }
+}
+
+// Write contiguous trivially copyable objects in bulk, or through a batch buffer when they must be swapped.
+template<class T, size_t Extent>
+void WriteContiguous(std::ostream& stream, std::span<T, Extent> objects)
+{
+    if (NeedsByteSwap<std::remove_cv_t<T>>(stream))
+        WriteBatched(stream, objects);
+    else
+        stream.write(reinterpret_cast<const char*>(objects.data()), static_cast<std::streamsize>(objects.size_bytes()));
+}
+
+// Read contiguous trivially copyable objects in bulk, swapping them in place if required.
+template<class T, size_t Extent>
+void ReadContiguous(std::istream& stream, std::span<T, Extent> objects)
+{
+    stream.read(reinterpret_cast<char*>(objects.data()), static_cast<std::streamsize>(objects.size_bytes()));
+    if (NeedsByteSwap<T>(stream))
+    {
+        for (auto& obj : objects) SwapByteOrder(obj);
+    }
+}
+
+template<class C>
+void SerializeTrivialContainer(std::ostream& stream, const C& container)
+{
+    Serialize(stream, container.size());
+    if constexpr (std::ranges::contiguous_range<C>)
+        WriteContiguous(stream, std::span{container});
+    else
+        WriteBatched(stream, container);
+}
+
+template<class C>
+void DeserializeTrivialContainer(std::istream& stream, C& container)
+{
+    auto size = size_t{};
+    Deserialize(stream, size);
+    AcquireContainer<typename C::value_type>(stream, size, sizeof(typename C::value_type));
+    container.resize(size);
+    if constexpr (std::ranges::contiguous_range<C>)
+        ReadContiguous(stream, std::span{container});
+    else
+        ReadBatched(stream, container);
+}
+
+template<class C>
+void SerializeNonTrivialContainer(std::ostream& stream, const C& container)
+{
+    Serialize(stream, container.size());
+    if constexpr (g_isBitwise<typename C::value_type>)
+        WriteBatched(stream, container);
+    else
+        for (const auto& obj : container) Serialize(stream, obj);
+}
+
+template<class C>
+constexpr auto SerializedSizeOfTrivialContainer(const C& container) -> size_t
+{
+    return sizeof(size_t) + sizeof(typename C::value_type) * container.size();
+}
+
+// Containers of fixed size elements are sized in constant time.
+template<class C>
+constexpr auto SerializedSizeOfNonTrivialContainer(const C& container) -> size_t
+{
+    using value_t = typename C::value_type;
+    if constexpr (FixedSize<value_t>)
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+        return sizeof(size_t) + container.size() * FixedSerializedSize<value_t>();
     }
-    else if constexpr (memberCount == 14)
+    else
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
+        auto size = sizeof(size_t);
+        for (const auto& obj : container) size += SerializedSize(obj);
+        return size;
     }
-    else if constexpr (memberCount == 13)
+}
+
+// Deserializes into the existing elements of a container. Surviving elements keep their storage (e.g.
+// string capacity), so repeatedly loading similarly sized data into the same object does not allocate.
+template<class C>
+void DeserializeNonTrivialContainer(std::istream& stream, C& container)
+{
+    auto count = size_t{};
+    Deserialize(stream, count);
+    AcquireContainer<typename C::value_type>(stream, count);
+    container.resize(count);
+    for (auto& obj : container) Deserialize(stream, obj);
+}
+
+// Deserializes into an associative container. Existing nodes are recycled: entries are read directly
+// into extracted nodes, reusing both the node and any storage owned by its key and value. Extraction
+// leaves the bucket array of unordered containers intact, so it is reused as well, leaving the node
+// handle scratch buffer as the only allocation for a container of unchanged size.
+template<class C>
+void DeserializeNodeContainer(std::istream& stream, C& container)
+{
+    constexpr auto isMap = requires { typename C::mapped_type; };
+    using entry_t = decltype([]
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
+        if constexpr (isMap)
+            return std::pair<typename C::key_type, typename C::mapped_type>{};
+        else
+            return typename C::key_type{};
+    }());
+
+    auto count = size_t{};
+    Deserialize(stream, count);
+    AcquireContainer<typename C::value_type>(stream, count);
+
+    auto nodes = std::vector<typename C::node_type>{};
+    nodes.reserve(std::min(count, container.size()));
+    while (nodes.size() < count && !container.empty())
+    {
+        nodes.push_back(container.extract(container.begin()));
     }
-    else if constexpr (memberCount == 12)
+
+    container.clear();
+    if constexpr (requires { container.reserve(count); })
+        container.reserve(count);
+
+    // Entries were written in iteration order, so hinting at the end makes ordered insertion O(1).
+    for (auto i = size_t{0}; i < count; ++i)
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
+        if (nodes.empty())
+        {
+            auto entry = entry_t{};
+            Deserialize(stream, entry);
+            container.insert(container.end(), std::move(entry));
+            continue;
+        }
+
+        auto node = std::move(nodes.back());
+        nodes.pop_back();
+        if constexpr (isMap)
+            DeserializeMultiple(stream, node.key(), node.mapped());
+        else
+            Deserialize(stream, node.value());
+
+        container.insert(container.end(), std::move(node));
+    }
+}
+
+// Construct the alternative of a variant selected by a runtime index.
+template<class... Ts>
+void EmplaceAlternative(std::variant<Ts...>& out, size_t index)
+{
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        ((index == I ? (out.template emplace<I>(), true) : false) || ...);
+    }(std::index_sequence_for<Ts...>{});
+}
+
+template<TriviallyCopyable T>
+void Serialize(std::ostream& stream, const T& in)
+{
+    if (NeedsByteSwap<T>(stream))
+    {
+        auto swapped = in;
+        SwapByteOrder(swapped);
+        stream.write(reinterpret_cast<const char*>(&swapped), sizeof(T));
+        return;
     }
-    else if constexpr (memberCount == 11)
+
+    stream.write(reinterpret_cast<const char*>(&in), sizeof(T));
+}
+
+template<TriviallyCopyable T>
+void Deserialize(std::istream& stream, T& out)
+{
+    stream.read(reinterpret_cast<char*>(&out), sizeof(T));
+    if (NeedsByteSwap<T>(stream))
+        SwapByteOrder(out);
+}
+
+template<class Char, class Traits, class Alloc>
+void Serialize(std::ostream& stream, const std::basic_string<Char, Traits, Alloc>& in)
+{
+    SerializeTrivialContainer(stream, in);
+}
+
+template<class Char, class Traits, class Alloc>
+void Deserialize(std::istream& stream, std::basic_string<Char, Traits, Alloc>& out)
+{
+    DeserializeTrivialContainer(stream, out);
+}
+
+template<class T, class Alloc>
+void Serialize(std::ostream& stream, const std::vector<T, Alloc>& in)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        SerializeTrivialContainer(stream, in);
+    else
+        SerializeNonTrivialContainer(stream, in);
+}
+
+template<class T, class Alloc>
+void Deserialize(std::istream& stream, std::vector<T, Alloc>& out)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        DeserializeTrivialContainer(stream, out);
+    else
+        DeserializeNonTrivialContainer(stream, out);
+}
+
+// SmallVectors are encoded identically to std::vector.
+template<class T, size_t N>
+void Serialize(std::ostream& stream, const SmallVector<T, N>& in)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        SerializeTrivialContainer(stream, in);
+    else
+        SerializeNonTrivialContainer(stream, in);
+}
+
+template<class T, size_t N>
+void Deserialize(std::istream& stream, SmallVector<T, N>& out)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        DeserializeTrivialContainer(stream, out);
+    else
+        DeserializeNonTrivialContainer(stream, out);
+}
+
+// Blobs are encoded identically to std::vector<char>.
+inline void Serialize(std::ostream& stream, const Blob& in)
+{
+    SerializeTrivialContainer(stream, in);
+}
+
+inline void Deserialize(std::istream& stream, Blob& out)
+{
+    auto bytes = std::vector<char>{};
+    DeserializeTrivialContainer(stream, bytes);
+    out = Blob{std::move(bytes)};
+}
+
+template<class T, class Alloc>
+void Serialize(std::ostream& stream, const std::deque<T, Alloc>& in)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        SerializeTrivialContainer(stream, in);
+    else
+        SerializeNonTrivialContainer(stream, in);
+}
+
+template<class T, class Alloc>
+void Deserialize(std::istream& stream, std::deque<T, Alloc>& out)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        DeserializeTrivialContainer(stream, out);
+    else
+        DeserializeNonTrivialContainer(stream, out);
+}
+
+template<class T, size_t I>
+void Serialize(std::ostream& stream, const std::array<T, I>& in)
+{
+    if constexpr(std::is_trivially_copyable_v<T>)
+        SerializeTrivialContainer(stream, in);
+    else
+        SerializeNonTrivialContainer(stream, in);
+}
+
+template<class T, size_t I>
+void Deserialize(std::istream& stream, std::array<T, I>& out)
+{
+    auto size = size_t{};
+    Deserialize(stream, size);
+    NC_ASSERT(size == out.size(), "Expected array size does not match stream contents");
+
+    if constexpr(std::is_trivially_copyable_v<T>)
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
+        ReadContiguous(stream, std::span{out});
     }
-    else if constexpr (memberCount == 10)
+    else
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
+        std::ranges::for_each(out, [&stream](auto&& obj)
+        {
+            Deserialize(stream, obj);
+        });
     }
-    else if constexpr (memberCount == 9)
+}
+
+template<class T, class U>
+void Serialize(std::ostream& stream, const std::pair<T, U>& in)
+{
+    SerializeMultiple(stream, in.first, in.second);
+}
+
+template<class T, class U>
+void Deserialize(std::istream& stream, std::pair<T, U>& out)
+{
+    DeserializeMultiple(stream, out.first, out.second);
+}
+
+template<class... Ts>
+void Serialize(std::ostream& stream, const std::tuple<Ts...>& in)
+{
+    std::apply([&stream](const auto&... elements)
+    {
+        SerializeMultiple(stream, elements...);
+    }, in);
+}
+
+template<class... Ts>
+void Deserialize(std::istream& stream, std::tuple<Ts...>& out)
+{
+    std::apply([&stream](auto&... elements)
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8, m9] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8, m9);
+        DeserializeMultiple(stream, elements...);
+    }, out);
+}
+
+template<class... Ts>
+void Serialize(std::ostream& stream, const std::variant<Ts...>& in)
+{
+    NC_ASSERT(!in.valueless_by_exception(), "Cannot serialize a valueless variant");
+    Serialize(stream, in.index());
+    std::visit([&stream](const auto& value)
+    {
+        Serialize(stream, value);
+    }, in);
+}
+
+template<class... Ts>
+void Deserialize(std::istream& stream, std::variant<Ts...>& out)
+{
+    auto index = size_t{};
+    Deserialize(stream, index);
+    if (index >= sizeof...(Ts))
+    {
+        throw NcError("Variant index does not match stream contents",
+            fmt::format("index: {}, alternatives: {}", index, sizeof...(Ts)));
     }
-    else if constexpr (memberCount == 8)
+
+    if (out.index() != index)
+        EmplaceAlternative(out, index);
+
+    std::visit([&stream](auto& value)
+    {
+        Deserialize(stream, value);
+    }, out);
+}
+
+template<class K, class V, class Hash, class Eq, class Alloc>
+void Serialize(std::ostream& stream, const std::unordered_map<K, V, Hash, Eq, Alloc>& in)
+{
+    SerializeNonTrivialContainer(stream, in);
+}
+
+template<class K, class V, class Hash, class Eq, class Alloc>
+void Deserialize(std::istream& stream, std::unordered_map<K, V, Hash, Eq, Alloc>& out)
+{
+    DeserializeNodeContainer(stream, out);
+}
+
+template<class K, class Hash, class Eq, class Alloc>
+void Serialize(std::ostream& stream, const std::unordered_set<K, Hash, Eq, Alloc>& in)
+{
+    SerializeNonTrivialContainer(stream, in);
+}
+
+template<class K, class Hash, class Eq, class Alloc>
+void Deserialize(std::istream& stream, std::unordered_set<K, Hash, Eq, Alloc>& out)
+{
+    DeserializeNodeContainer(stream, out);
+}
+
+template<class K, class V, class Compare, class Alloc>
+void Serialize(std::ostream& stream, const std::map<K, V, Compare, Alloc>& in)
+{
+    SerializeNonTrivialContainer(stream, in);
+}
+
+template<class K, class V, class Compare, class Alloc>
+void Deserialize(std::istream& stream, std::map<K, V, Compare, Alloc>& out)
+{
+    DeserializeNodeContainer(stream, out);
+}
+
+template<class K, class Compare, class Alloc>
+void Serialize(std::ostream& stream, const std::set<K, Compare, Alloc>& in)
+{
+    SerializeNonTrivialContainer(stream, in);
+}
+
+template<class K, class Compare, class Alloc>
+void Deserialize(std::istream& stream, std::set<K, Compare, Alloc>& out)
+{
+    DeserializeNodeContainer(stream, out);
+}
+
+template<class T>
+void Serialize(std::ostream& stream, const std::optional<T>& in)
+{
+    in.has_value()
+        ? SerializeMultiple(stream, true, in.value())
+        : Serialize(stream, false);
+}
+
+template<class T>
+void Deserialize(std::istream& stream, std::optional<T>& out)
+{
+    auto hasValue = false;
+    Deserialize(stream, hasValue);
+    if (hasValue)
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7, m8] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7, m8);
+        if (!out.has_value())
+            out.emplace();
+
+        Deserialize(stream, out.value());
     }
-    else if constexpr (memberCount == 7)
+    else
     {
-        auto& [m1, m2, m3, m4, m5, m6, m7] = out;
-       DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6, m7);
+        out = std::nullopt;
     }
-    else if constexpr (memberCount == 6)
+}
+
+template<class T>
+void Serialize(std::ostream& stream, const SlotMap<T>& in)
+{
+    SerializeMultiple(stream, in.m_slots, in.m_denseToSlot, in.m_values);
+}
+
+template<class T>
+void Deserialize(std::istream& stream, SlotMap<T>& out)
+{
+    using Map = SlotMap<T>;
+    auto slots = decltype(out.m_slots){};
+    auto denseToSlot = std::vector<uint32_t>{};
+    auto values = std::vector<T>{};
+    DeserializeMultiple(stream, slots, denseToSlot, values);
+
+    const auto occupiedCount = std::ranges::count_if(slots, &Map::IsOccupied);
+    auto consistent = values.size() == denseToSlot.size() && static_cast<size_t>(occupiedCount) == values.size();
+    for (auto denseIndex = size_t{0}; consistent && denseIndex < denseToSlot.size(); ++denseIndex)
     {
-        auto& [m1, m2, m3, m4, m5, m6] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5, m6);
+        const auto slotIndex = denseToSlot[denseIndex];
+        consistent = slotIndex < slots.size() && Map::IsOccupied(slots[slotIndex]) && slots[slotIndex].dense == denseIndex;
     }
-    else if constexpr (memberCount == 5)
+
+    if (!consistent)
+        throw NcError("SlotMap stream contents are inconsistent.");
+
+    // Free slot links aren't meaningful across streams, so the free list is rebuilt.
+    auto freeHead = Map::NullIndex;
+    for (auto slotIndex = slots.size(); slotIndex-- > 0;)
     {
-        auto& [m1, m2, m3, m4, m5] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4, m5);
+        if (!Map::IsOccupied(slots[slotIndex]))
+            slots[slotIndex].dense = std::exchange(freeHead, static_cast<uint32_t>(slotIndex));
     }
-    else if constexpr (memberCount == 4)
+
+    out.m_slots = std::move(slots);
+    out.m_denseToSlot = std::move(denseToSlot);
+    out.m_values = std::move(values);
+    out.m_freeHead = freeHead;
+}
+
+// Only the dense arrays of a SparseSet are written. Pages are rebuilt from the keys.
+template<class T, std::unsigned_integral Key, size_t PageSize>
+void Serialize(std::ostream& stream, const SparseSet<T, Key, PageSize>& in)
+{
+    SerializeMultiple(stream, in.m_keys, in.m_values);
+}
+
+template<class T, std::unsigned_integral Key, size_t PageSize>
+void Deserialize(std::istream& stream, SparseSet<T, Key, PageSize>& out)
+{
+    using Set = SparseSet<T, Key, PageSize>;
+    auto keys = std::vector<Key>{};
+    auto values = std::vector<T>{};
+    DeserializeMultiple(stream, keys, values);
+    if (keys.size() != values.size())
+        throw NcError("SparseSet stream contents are inconsistent.", fmt::format("keys: {}, values: {}", keys.size(), values.size()));
+
+    const auto context = nc::serialize::DeserializationContext::Get(stream);
+    auto set = Set{};
+    if (!keys.empty())
     {
-        auto& [m1, m2, m3, m4] = out;
-        DeserializeMultiple(stream, m1, m2, m3, m4);
+        const auto maxKey = std::ranges::max(keys);
+        if (maxKey == Set::NullIndex)
+            throw NcError("SparseSet stream contains a reserved or duplicate key.", fmt::format("key: {}", maxKey));
+
+        // The page table spans every page up to the largest key, so both it and each page allocated
+        // below are charged against the allocation budget of an attached context.
+        const auto pageCount = static_cast<size_t>(maxKey) / PageSize + 1;
+        if (context)
+            context->AcquireContainer(pageCount, 0ull, sizeof(std::vector<Key>));
+
+        set.m_pages.resize(pageCount);
     }
-    else if constexpr (memberCount == 3)
+
+    for (auto denseIndex = size_t{0}; denseIndex < keys.size(); ++denseIndex)
     {
-        auto& [m1, m2, m3] = out;
-        DeserializeMultiple(stream, m1, m2, m3);
+        const auto key = keys[denseIndex];
+        if (context && set.m_pages[static_cast<size_t>(key) / PageSize].empty())
+            context->AcquireContainer(PageSize, 0ull, sizeof(Key));
+
+        if (set.SparseEntry(key) != Set::NullIndex)
+            throw NcError("SparseSet stream contains a reserved or duplicate key.", fmt::format("key: {}", key));
+
+        set.SparseEntry(key) = static_cast<Key>(denseIndex);
     }
-    else if constexpr (memberCount == 2)
+
+    set.m_keys = std::move(keys);
+    set.m_values = std::move(values);
+    out = std::move(set);
+}
+
+template<UnpackableAggregate T>
+void Serialize(std::ostream& stream, const T& in)
+{
+    VisitMembers(in, [&stream](const auto&... members)
     {
-        auto& [m1, m2] = out;
-        DeserializeMultiple(stream, m1, m2);
+        SerializeMultiple(stream, members...);
+    });
+}
+
+template<UnpackableAggregate T>
+void Deserialize(std::istream& stream, T& out)
+{
+    VisitMembers(out, [&stream](auto&... members)
+    {
+        DeserializeMultiple(stream, members...);
+    });
+}
+
+template<TriviallyCopyable T>
+constexpr auto SerializedSize(const T&) -> size_t
+{
+    return sizeof(T);
+}
+
+template<UnpackableAggregate T>
+constexpr auto SerializedSize(const T& in) -> size_t
+{
+    if constexpr (FixedSize<T>)
+    {
+        return FixedSerializedSize<T>();
     }
-    else if constexpr (memberCount == 1)
+    else
     {
-        auto& [m1] = out;
-        DeserializeMultiple(stream, m1);
+        return VisitMembers(in, [](const auto&... members)
+        {
+            return SerializedSizeMultiple(members...);
+        });
     }
 }
+
+template<class Char, class Traits, class Alloc>
+constexpr auto SerializedSize(const std::basic_string<Char, Traits, Alloc>& in) -> size_t
+{
+    return SerializedSizeOfTrivialContainer(in);
+}
+
+template<class T, class Alloc>
+constexpr auto SerializedSize(const std::vector<T, Alloc>& in) -> size_t
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        return SerializedSizeOfTrivialContainer(in);
+    else
+        return SerializedSizeOfNonTrivialContainer(in);
+}
+
+template<class T, size_t N>
+constexpr auto SerializedSize(const SmallVector<T, N>& in) -> size_t
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        return SerializedSizeOfTrivialContainer(in);
+    else
+        return SerializedSizeOfNonTrivialContainer(in);
+}
+
+inline auto SerializedSize(const Blob& in) -> size_t
+{
+    return SerializedSizeOfTrivialContainer(in);
+}
+
+template<class T, class Alloc>
+auto SerializedSize(const std::deque<T, Alloc>& in) -> size_t
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        return SerializedSizeOfTrivialContainer(in);
+    else
+        return SerializedSizeOfNonTrivialContainer(in);
+}
+
+template<class T, size_t I>
+constexpr auto SerializedSize(const std::array<T, I>& in) -> size_t
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+        return SerializedSizeOfTrivialContainer(in);
+    else
+        return SerializedSizeOfNonTrivialContainer(in);
+}
+
+template<class T, class U>
+constexpr auto SerializedSize(const std::pair<T, U>& in) -> size_t
+{
+    return SerializedSizeMultiple(in.first, in.second);
+}
+
+template<class... Ts>
+constexpr auto SerializedSize(const std::tuple<Ts...>& in) -> size_t
+{
+    return std::apply([](const auto&... elements)
+    {
+        return SerializedSizeMultiple(elements...);
+    }, in);
+}
+
+template<class... Ts>
+constexpr auto SerializedSize(const std::variant<Ts...>& in) -> size_t
+{
+    return sizeof(size_t) + std::visit([](const auto& value)
+    {
+        return SerializedSize(value);
+    }, in);
+}
+
+template<class K, class V, class Hash, class Eq, class Alloc>
+auto SerializedSize(const std::unordered_map<K, V, Hash, Eq, Alloc>& in) -> size_t
+{
+    return SerializedSizeOfNonTrivialContainer(in);
+}
+
+template<class K, class Hash, class Eq, class Alloc>
+auto SerializedSize(const std::unordered_set<K, Hash, Eq, Alloc>& in) -> size_t
+{
+    return SerializedSizeOfNonTrivialContainer(in);
+}
+
+template<class K, class V, class Compare, class Alloc>
+auto SerializedSize(const std::map<K, V, Compare, Alloc>& in) -> size_t
+{
+    return SerializedSizeOfNonTrivialContainer(in);
+}
+
+template<class K, class Compare, class Alloc>
+auto SerializedSize(const std::set<K, Compare, Alloc>& in) -> size_t
+{
+    return SerializedSizeOfNonTrivialContainer(in);
+}
+
+template<class T>
+constexpr auto SerializedSize(const std::optional<T>& in) -> size_t
+{
+    return in.has_value()
+        ? SerializedSizeMultiple(true, in.value())
+        : SerializedSize(false);
+}
+
+template<class T>
+auto SerializedSize(const SlotMap<T>& in) -> size_t
+{
+    return SerializedSizeMultiple(in.m_slots, in.m_denseToSlot, in.m_values);
+}
+
+template<class T, std::unsigned_integral Key, size_t PageSize>
+auto SerializedSize(const SparseSet<T, Key, PageSize>& in) -> size_t
+{
+    return SerializedSizeMultiple(in.m_keys, in.m_values);
+}
 } // namespace nc::serialize::binary
 /** @endcond internal */
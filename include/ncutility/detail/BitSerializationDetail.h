@@ -0,0 +1,307 @@
+#pragma once
+
+#include "BinarySerializationDetail.h"
+#include "ncutility/BitStream.h"
+
+/** @cond internal */
+namespace nc::serialize::bits
+{
+// Concept for aggregates which are bit serialized member-wise.
+template<class T>
+concept BitAggregate = nc::serialize::binary::Aggregate<T>
+                    && (nc::serialize::binary::MemberCount<T>() <= nc::serialize::binary::g_aggregateMaxMemberCount);
+
+// Arithmetic types and enums, which are written at full width.
+template<class T>
+concept FullWidth = (std::is_arithmetic_v<T> || std::is_enum_v<T>) && !std::same_as<T, bool>;
+
+void Serialize(BitWriter& writer, const bool& in);
+void Deserialize(BitReader& reader, bool& out);
+
+template<FullWidth T>
+void Serialize(BitWriter& writer, const T& in);
+
+template<FullWidth T>
+void Deserialize(BitReader& reader, T& out);
+
+template<class T, T Min, T Max>
+void Serialize(BitWriter& writer, const Ranged<T, Min, Max>& in);
+
+template<class T, T Min, T Max>
+void Deserialize(BitReader& reader, Ranged<T, Min, Max>& out);
+
+template<float Min, float Max, uint32_t Bits>
+void Serialize(BitWriter& writer, const Quantized<Min, Max, Bits>& in);
+
+template<float Min, float Max, uint32_t Bits>
+void Deserialize(BitReader& reader, Quantized<Min, Max, Bits>& out);
+
+template<class T, size_t I>
+void Serialize(BitWriter& writer, const std::array<T, I>& in);
+
+template<class T, size_t I>
+void Deserialize(BitReader& reader, std::array<T, I>& out);
+
+template<class Char, class Traits, class Alloc>
+void Serialize(BitWriter& writer, const std::basic_string<Char, Traits, Alloc>& in);
+
+template<class Char, class Traits, class Alloc>
+void Deserialize(BitReader& reader, std::basic_string<Char, Traits, Alloc>& out);
+
+template<class T, class Alloc>
+void Serialize(BitWriter& writer, const std::vector<T, Alloc>& in);
+
+template<class T, class Alloc>
+void Deserialize(BitReader& reader, std::vector<T, Alloc>& out);
+
+template<class T, size_t N>
+void Serialize(BitWriter& writer, const SmallVector<T, N>& in);
+
+template<class T, size_t N>
+void Deserialize(BitReader& reader, SmallVector<T, N>& out);
+
+template<class T>
+void Serialize(BitWriter& writer, const std::optional<T>& in);
+
+template<class T>
+void Deserialize(BitReader& reader, std::optional<T>& out);
+
+template<BitAggregate T>
+void Serialize(BitWriter& writer, const T& in);
+
+template<BitAggregate T>
+void Deserialize(BitReader& reader, T& out);
+
+// Sentinel returned from FixedBitCount() for types with a value-dependent encoded size.
+inline constexpr size_t g_variableBitCount = 0xFFFFFFFFFFFFFFFF;
+
+template<class T>
+struct FixedBitCountTraits;
+
+// Get the number of bits written for T, or g_variableBitCount if it depends on the value.
+template<class T>
+consteval auto FixedBitCount() -> size_t
+{
+    return FixedBitCountTraits<std::remove_cv_t<T>>::Get();
+}
+
+template<class... Ts>
+consteval auto FixedBitCount(nc::serialize::binary::TypeList<Ts...>) -> size_t
+{
+    if constexpr (((FixedBitCount<Ts>() != g_variableBitCount) && ...))
+        return (size_t{0} + ... + FixedBitCount<Ts>());
+    else
+        return g_variableBitCount;
+}
+
+template<class T>
+struct FixedBitCountTraits
+{
+    static consteval auto Get() -> size_t
+    {
+        if constexpr (std::same_as<T, bool>)
+            return 1ull;
+        else if constexpr (FullWidth<T>)
+            return sizeof(T) * 8ull;
+        else if constexpr (BitAggregate<T>)
+            return FixedBitCount(nc::serialize::binary::MemberTypes<T>{});
+        else
+            return g_variableBitCount;
+    }
+};
+
+template<class T, T Min, T Max>
+struct FixedBitCountTraits<Ranged<T, Min, Max>>
+{
+    static consteval auto Get() -> size_t
+    {
+        return RangeBitCount(Min, Max);
+    }
+};
+
+template<float Min, float Max, uint32_t Bits>
+struct FixedBitCountTraits<Quantized<Min, Max, Bits>>
+{
+    static consteval auto Get() -> size_t
+    {
+        return Bits;
+    }
+};
+
+template<class T, size_t I>
+struct FixedBitCountTraits<std::array<T, I>>
+{
+    static consteval auto Get() -> size_t
+    {
+        constexpr auto elementBits = FixedBitCount<T>();
+        if constexpr (elementBits == g_variableBitCount)
+            return g_variableBitCount;
+        else
+            return I * elementBits;
+    }
+};
+
+inline void Serialize(BitWriter& writer, const bool& in)
+{
+    writer.WriteBool(in);
+}
+
+inline void Deserialize(BitReader& reader, bool& out)
+{
+    out = reader.ReadBool();
+}
+
+template<FullWidth T>
+void Serialize(BitWriter& writer, const T& in)
+{
+    using bits_t = std::conditional_t<sizeof(T) == 8, uint64_t, std::conditional_t<sizeof(T) == 4, uint32_t,
+                   std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>>;
+    static_assert(sizeof(T) == sizeof(bits_t), "Unsupported arithmetic type size");
+    writer.WriteBits(std::bit_cast<bits_t>(in), sizeof(T) * 8u);
+}
+
+template<FullWidth T>
+void Deserialize(BitReader& reader, T& out)
+{
+    using bits_t = std::conditional_t<sizeof(T) == 8, uint64_t, std::conditional_t<sizeof(T) == 4, uint32_t,
+                   std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>>;
+    static_assert(sizeof(T) == sizeof(bits_t), "Unsupported arithmetic type size");
+    out = std::bit_cast<T>(static_cast<bits_t>(reader.ReadBits(sizeof(T) * 8u)));
+}
+
+template<class T, T Min, T Max>
+void Serialize(BitWriter& writer, const Ranged<T, Min, Max>& in)
+{
+    writer.WriteRanged(in.value, Min, Max);
+}
+
+template<class T, T Min, T Max>
+void Deserialize(BitReader& reader, Ranged<T, Min, Max>& out)
+{
+    out.value = reader.ReadRanged(Min, Max);
+}
+
+template<float Min, float Max, uint32_t Bits>
+void Serialize(BitWriter& writer, const Quantized<Min, Max, Bits>& in)
+{
+    writer.WriteQuantized(in.value, Min, Max, Bits);
+}
+
+template<float Min, float Max, uint32_t Bits>
+void Deserialize(BitReader& reader, Quantized<Min, Max, Bits>& out)
+{
+    out.value = reader.ReadQuantized(Min, Max, Bits);
+}
+
+template<class T, size_t I>
+void Serialize(BitWriter& writer, const std::array<T, I>& in)
+{
+    for (const auto& obj : in) Serialize(writer, obj);
+}
+
+template<class T, size_t I>
+void Deserialize(BitReader& reader, std::array<T, I>& out)
+{
+    for (auto& obj : out) Deserialize(reader, obj);
+}
+
+// Reject lengths which can't be satisfied by the remaining bits, given at least one bit per element.
+inline auto ReadLength(BitReader& reader, size_t minElementBits) -> size_t
+{
+    const auto length = reader.ReadVarUint();
+    if (length > reader.BitsRemaining() / std::max(minElementBits, size_t{1}))
+    {
+        throw NcError("Serialized container length exceeds remaining bits.",
+            fmt::format("length: {}, remaining bits: {}", length, reader.BitsRemaining()));
+    }
+
+    return static_cast<size_t>(length);
+}
+
+template<class Char, class Traits, class Alloc>
+void Serialize(BitWriter& writer, const std::basic_string<Char, Traits, Alloc>& in)
+{
+    writer.WriteVarUint(in.size());
+    for (auto c : in) Serialize(writer, c);
+}
+
+template<class Char, class Traits, class Alloc>
+void Deserialize(BitReader& reader, std::basic_string<Char, Traits, Alloc>& out)
+{
+    out.resize(ReadLength(reader, sizeof(Char) * 8u));
+    for (auto& c : out) Deserialize(reader, c);
+}
+
+template<class T, class Alloc>
+void Serialize(BitWriter& writer, const std::vector<T, Alloc>& in)
+{
+    writer.WriteVarUint(in.size());
+    for (const auto& obj : in) Serialize(writer, obj);
+}
+
+template<class T, class Alloc>
+void Deserialize(BitReader& reader, std::vector<T, Alloc>& out)
+{
+    constexpr auto elementBits = FixedBitCount<T>();
+    out.resize(ReadLength(reader, elementBits == g_variableBitCount ? 1u : elementBits));
+    for (auto& obj : out) Deserialize(reader, obj);
+}
+
+template<class T, size_t N>
+void Serialize(BitWriter& writer, const SmallVector<T, N>& in)
+{
+    writer.WriteVarUint(in.size());
+    for (const auto& obj : in) Serialize(writer, obj);
+}
+
+template<class T, size_t N>
+void Deserialize(BitReader& reader, SmallVector<T, N>& out)
+{
+    constexpr auto elementBits = FixedBitCount<T>();
+    out.resize(ReadLength(reader, elementBits == g_variableBitCount ? 1u : elementBits));
+    for (auto& obj : out) Deserialize(reader, obj);
+}
+
+template<class T>
+void Serialize(BitWriter& writer, const std::optional<T>& in)
+{
+    writer.WriteBool(in.has_value());
+    if (in.has_value())
+        Serialize(writer, in.value());
+}
+
+template<class T>
+void Deserialize(BitReader& reader, std::optional<T>& out)
+{
+    if (reader.ReadBool())
+    {
+        if (!out.has_value())
+            out.emplace();
+
+        Deserialize(reader, out.value());
+    }
+    else
+    {
+        out = std::nullopt;
+    }
+}
+
+template<BitAggregate T>
+void Serialize(BitWriter& writer, const T& in)
+{
+    nc::serialize::binary::VisitMembers(in, [&writer](const auto&... members)
+    {
+        (Serialize(writer, members), ...);
+    });
+}
+
+template<BitAggregate T>
+void Deserialize(BitReader& reader, T& out)
+{
+    nc::serialize::binary::VisitMembers(out, [&reader](auto&... members)
+    {
+        (Deserialize(reader, members), ...);
+    });
+}
+} // namespace nc::serialize::bits
+/** @endcond internal */
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ncutility/TaskScheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+/** @cond internal */
+namespace nc::algo::detail
+{
+// Splits [0, count) into one contiguous block per participating thread of TaskScheduler::Default(), for
+// algorithms whose passes must agree on block boundaries. Blocks are never empty unless count is zero, and a
+// single block means run sequentially.
+class BlockPartition
+{
+    public:
+        BlockPartition(size_t count, size_t minBlockSize, size_t maxConcurrency)
+            : m_count{count}, m_blockCount{1}, m_blockSize{count}
+        {
+            // Checked first so sequential callers never start the default scheduler.
+            const auto blockLimit = count / std::max(minBlockSize, size_t{1});
+            if (maxConcurrency == 1 || blockLimit < 2)
+                return;
+
+            const auto threadCount = TaskScheduler::Default().WorkerCount() + 1;
+            const auto concurrencyLimit = maxConcurrency == 0 ? threadCount : maxConcurrency;
+            const auto targetCount = std::min({blockLimit, threadCount, concurrencyLimit});
+            if (targetCount < 2)
+                return;
+
+            // Recount after rounding the size up so no block is left empty.
+            m_blockSize = (count + targetCount - 1) / targetCount;
+            m_blockCount = (count + m_blockSize - 1) / m_blockSize;
+        }
+
+        auto BlockCount() const noexcept -> size_t { return m_blockCount; }
+
+        // Get the [begin, end) range of a block.
+        auto operator[](size_t block) const noexcept -> std::pair<size_t, size_t>
+        {
+            return {std::min(m_count, block * m_blockSize), std::min(m_count, (block + 1) * m_blockSize)};
+        }
+
+        // Invoke fn(begin, end) for each block in parallel.
+        template<class F>
+        void ForEach(F&& fn, size_t maxConcurrency) const
+        {
+            TaskScheduler::Default().ParallelFor(m_blockCount, [&](size_t block)
+            {
+                const auto [begin, end] = (*this)[block];
+                fn(begin, end);
+            }, 1, maxConcurrency);
+        }
+
+    private:
+        size_t m_count;
+        size_t m_blockCount;
+        size_t m_blockSize;
+};
+} // namespace nc::algo::detail
+/** @endcond internal */
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "BinarySerializationDetail.h"
+#include "StreamBufferDetail.h"
+#include "ncutility/TaskScheduler.h"
+
+#include <limits>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+
+/** @cond internal */
+namespace nc::serialize::binary
+{
+// Number of elements per chunk written by SerializeChunked(). Fixed so the output doesn't depend on the
+// number of threads.
+inline constexpr size_t g_elementsPerChunk = 4096ull;
+
+// Serializes access to an upstream resource, so scratch memory which isn't thread safe, such as an
+// arena, can be shared by chunks encoded in parallel.
+class LockedResource : public std::pmr::memory_resource
+{
+    public:
+        explicit LockedResource(std::pmr::memory_resource* upstream) noexcept
+            : m_upstream{upstream}
+        {
+        }
+
+    protected:
+        auto do_allocate(size_t bytes, size_t alignment) -> void* override
+        {
+            auto lock = std::lock_guard{m_mutex};
+            return m_upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            auto lock = std::lock_guard{m_mutex};
+            m_upstream->deallocate(ptr, bytes, alignment);
+        }
+
+        auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+
+    private:
+        std::pmr::memory_resource* m_upstream;
+        std::mutex m_mutex;
+};
+
+// Invoke fn for each index in [0, chunkCount) across up to threadCount threads of the default scheduler.
+// The calling thread participates, and the first exception thrown is rethrown after all threads finish.
+template<class F>
+void ForEachChunk(size_t chunkCount, size_t threadCount, F&& fn)
+{
+    if (threadCount == 1 || chunkCount <= 1)
+    {
+        for (auto i = size_t{0}; i < chunkCount; ++i) fn(i);
+        return;
+    }
+
+    TaskScheduler::Default().ParallelFor(chunkCount, [&fn](size_t chunk) { fn(chunk); }, 1, threadCount);
+}
+
+// Layout: element count, elements per chunk, chunkCount + 1 byte offsets into the payload, payload.
+// Each chunk contains its elements in their default encoding.
+template<class T, class Alloc>
+void SerializeChunked(std::ostream& stream, const std::vector<T, Alloc>& in, size_t threadCount, std::pmr::memory_resource* scratch)
+{
+    const auto count = in.size();
+    const auto chunkCount = (count + g_elementsPerChunk - 1) / g_elementsPerChunk;
+    auto lockedScratch = LockedResource{scratch};
+    auto chunks = std::pmr::vector<std::pmr::vector<char>>(chunkCount, &lockedScratch);
+    ForEachChunk(chunkCount, threadCount, [&](size_t chunk)
+    {
+        const auto begin = chunk * g_elementsPerChunk;
+        const auto end = std::min(begin + g_elementsPerChunk, count);
+        auto buffer = nc::detail::VectorWriteBuffer{chunks[chunk]};
+        auto chunkStream = std::ostream{&buffer};
+        SetByteOrder(chunkStream, GetByteOrder(stream));
+        for (auto i = begin; i < end; ++i) Serialize(chunkStream, in[i]);
+    });
+
+    auto offsets = std::pmr::vector<size_t>{scratch};
+    offsets.reserve(chunkCount + 1);
+    offsets.push_back(0ull);
+    for (const auto& chunk : chunks) offsets.push_back(offsets.back() + chunk.size());
+
+    SerializeMultiple(stream, count, g_elementsPerChunk);
+    WriteContiguous(stream, std::span<const size_t>{offsets});
+    for (const auto& chunk : chunks) stream.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+}
+
+template<class T, class Alloc>
+void DeserializeChunked(std::istream& stream, std::vector<T, Alloc>& out, size_t threadCount, std::pmr::memory_resource* scratch)
+{
+    auto count = size_t{};
+    auto elementsPerChunk = size_t{};
+    DeserializeMultiple(stream, count, elementsPerChunk);
+    if (elementsPerChunk == 0 && count != 0)
+        throw NcError("Chunked container has an invalid chunk size.");
+
+    // The offset table holds chunkCount + 1 entries, which must not wrap.
+    if (count != 0 && (count - 1) / elementsPerChunk >= std::numeric_limits<size_t>::max() - 1)
+        throw NcError("Chunked container has an invalid chunk count.", fmt::format("count: {}, elements per chunk: {}", count, elementsPerChunk));
+
+    const auto chunkCount = count == 0 ? 0ull : (count - 1) / elementsPerChunk + 1;
+    AcquireContainer<size_t>(stream, chunkCount + 1);
+    auto offsets = std::pmr::vector<size_t>(chunkCount + 1, scratch);
+    ReadContiguous(stream, std::span{offsets});
+    if (!stream || offsets.front() != 0 || !std::ranges::is_sorted(offsets))
+        throw NcError("Chunked container offset table does not match stream contents.");
+
+    const auto payloadSize = offsets.back();
+    constexpr auto minElementSize = MinSerializedSize<T>();
+    if (minElementSize != 0 && count > payloadSize / minElementSize)
+    {
+        throw NcError("Chunked container length exceeds payload size.",
+            fmt::format("length: {}, payload bytes: {}", count, payloadSize));
+    }
+
+    AcquireContainer<T>(stream, count);
+    AcquireContainer<char>(stream, payloadSize, 1ull);
+    auto payload = std::pmr::vector<char>(payloadSize, scratch);
+    stream.read(payload.data(), static_cast<std::streamsize>(payloadSize));
+    if (!stream)
+        throw NcError("Chunked container payload does not match stream contents.");
+
+    // Chunks are decoded from memory, so the parent context's byte limit has already been enforced. Each
+    // chunk gets its own context limiting lengths to the chunk's bytes. When bounded, it also carries the
+    // allocation budget remaining when the chunk starts, and what it allocates is charged back to the parent
+    // when it finishes. Chunks decoded concurrently may together briefly exceed the budget, but the total
+    // is rejected before returning.
+    const auto parentContext = nc::serialize::DeserializationContext::Get(stream);
+    auto budgetMutex = std::mutex{};
+
+    out.resize(count);
+    ForEachChunk(chunkCount, threadCount, [&](size_t chunk)
+    {
+        const auto chunkSize = offsets[chunk + 1] - offsets[chunk];
+        auto buffer = nc::detail::SpanReadBuffer{std::span{payload}.subspan(offsets[chunk], chunkSize)};
+        auto chunkStream = std::istream{&buffer};
+        SetByteOrder(chunkStream, GetByteOrder(stream));
+        auto budget = std::numeric_limits<size_t>::max();
+        if (parentContext)
+        {
+            auto lock = std::lock_guard{budgetMutex};
+            budget = parentContext->AllocationRemaining();
+        }
+
+        auto context = nc::serialize::DeserializationContext{chunkStream, {.maxBytes = chunkSize, .maxAllocationBytes = budget}};
+
+        const auto begin = chunk * elementsPerChunk;
+        const auto end = std::min(begin + elementsPerChunk, count);
+        for (auto i = begin; i < end; ++i) Deserialize(chunkStream, out[i]);
+
+        if (!chunkStream || static_cast<size_t>(chunkStream.tellg()) != chunkSize)
+        {
+            throw NcError("Chunk contents do not match offset table.",
+                fmt::format("chunk: {}, expected bytes: {}", chunk, chunkSize));
+        }
+
+        if (parentContext)
+        {
+            auto lock = std::lock_guard{budgetMutex};
+            parentContext->AcquireContainer(budget - context.AllocationRemaining(), 0ull, 1ull);
+        }
+    });
+}
+} // namespace nc::serialize::binary
+/** @endcond internal */
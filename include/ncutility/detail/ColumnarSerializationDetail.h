@@ -0,0 +1,102 @@
+#pragma once
+
+#include "BinarySerializationDetail.h"
+
+#include <tuple>
+#include <utility>
+
+/** @cond internal */
+namespace nc::serialize::binary
+{
+// Concept for aggregates which can be written member-wise as columns.
+template<class T>
+concept ColumnarAggregate = Aggregate<T>
+                         && (MemberCount<T>() > 0)
+                         && (MemberCount<T>() <= g_aggregateMaxMemberCount);
+
+// Get a reference to the Ith member of an aggregate.
+template<size_t I, class T>
+constexpr auto GetMember(T& obj) -> auto&
+{
+    return VisitMembers(obj, [](auto&... members) -> auto&
+    {
+        return std::get<I>(std::tie(members...));
+    });
+}
+
+// Minimum number of bytes each object contributes across all of its columns.
+template<class... Ts>
+consteval auto MinRowSize(TypeList<Ts...>) -> size_t
+{
+    return (size_t{0} + ... + (std::is_trivially_copyable_v<Ts> ? sizeof(Ts) : MinSerializedSize<Ts>()));
+}
+
+template<size_t I, class T>
+using MemberType = std::remove_cvref_t<decltype(GetMember<I>(std::declval<T&>()))>;
+
+// Write the Ith member of each object with the same encoding as a std::vector of that member type.
+template<size_t I, std::ranges::sized_range R>
+void SerializeColumn(std::ostream& stream, const R& objects)
+{
+    using object_t = std::ranges::range_value_t<R>;
+    using member_t = MemberType<I, object_t>;
+    Serialize(stream, static_cast<size_t>(std::ranges::size(objects)));
+
+    if constexpr (std::is_trivially_copyable_v<member_t>)
+    {
+        WriteBatched(stream, objects, [](const auto& obj) -> const auto& { return GetMember<I>(obj); });
+    }
+    else
+    {
+        for (const auto& obj : objects) Serialize(stream, GetMember<I>(obj));
+    }
+}
+
+// Read a column written by SerializeColumn() into the Ith member of each object. The first column
+// determines the object count.
+template<size_t I, class T>
+void DeserializeColumn(std::istream& stream, std::vector<T>& objects)
+{
+    using member_t = MemberType<I, T>;
+    auto count = size_t{};
+    Deserialize(stream, count);
+    if constexpr (I == 0)
+    {
+        AcquireContainer<T>(stream, count, MinRowSize(MemberTypes<T>{}));
+        objects.resize(count);
+    }
+    else
+    {
+        NC_ASSERT(count == objects.size(), "Column size does not match stream contents");
+    }
+
+    if constexpr (std::is_trivially_copyable_v<member_t>)
+    {
+        ReadBatched(stream, objects, [](auto& obj) -> auto& { return GetMember<I>(obj); });
+    }
+    else
+    {
+        for (auto& obj : objects) Deserialize(stream, GetMember<I>(obj));
+    }
+}
+
+template<std::ranges::sized_range R>
+void SerializeColumnar(std::ostream& stream, const R& objects)
+{
+    using object_t = std::ranges::range_value_t<R>;
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        (SerializeColumn<I>(stream, objects), ...);
+    }(std::make_index_sequence<MemberCount<object_t>()>{});
+}
+
+template<class T>
+void DeserializeColumnar(std::istream& stream, std::vector<T>& objects)
+{
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        (DeserializeColumn<I>(stream, objects), ...);
+    }(std::make_index_sequence<MemberCount<T>()>{});
+}
+} // namespace nc::serialize::binary
+/** @endcond internal */
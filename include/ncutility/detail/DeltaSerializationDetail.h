@@ -0,0 +1,132 @@
+#pragma once
+
+#include "SerializeCpo.h"
+
+#include <cstring>
+
+/** @cond internal */
+namespace nc::serialize::binary
+{
+// Concept for aggregates which can be delta encoded member-wise. The changed-members mask is a
+// single uint64_t, which bounds the member count.
+template<class T>
+concept DeltaAggregate = Aggregate<T>
+                      && (MemberCount<T>() > 0)
+                      && (MemberCount<T>() <= 64ull)
+                      && (MemberCount<T>() <= g_aggregateMaxMemberCount);
+
+// Compare members for delta encoding. Trivially copyable types without operator== are compared
+// bitwise, which may report padding differences as changes but never misses one.
+template<class T>
+constexpr auto MembersEqual(const T& lhs, const T& rhs) -> bool
+{
+    if constexpr (std::equality_comparable<T>)
+    {
+        return lhs == rhs;
+    }
+    else if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+    }
+    else if constexpr (Aggregate<T> && MemberCount<T>() <= g_aggregateMaxMemberCount)
+    {
+        return VisitMembers(lhs, [&rhs](const auto&... lhsMembers)
+        {
+            return VisitMembers(rhs, [&lhsMembers...](const auto&... rhsMembers)
+            {
+                return (MembersEqual(lhsMembers, rhsMembers) && ...);
+            });
+        });
+    }
+    else
+    {
+        static_assert(cpo::g_alwaysFalse<T>, "Delta encoded members must be equality comparable");
+        return false;
+    }
+}
+
+// Number of bytes used to write the mask of an aggregate with memberCount members to a byte stream.
+constexpr auto DeltaMaskBytes(size_t memberCount) -> size_t
+{
+    return (memberCount + 7u) / 8u;
+}
+
+inline void WriteDeltaMask(std::ostream& stream, uint64_t mask, size_t memberCount)
+{
+    char bytes[sizeof(uint64_t)];
+    for (auto i = 0u; i < sizeof(bytes); ++i) bytes[i] = static_cast<char>(mask >> (8u * i));
+    stream.write(bytes, static_cast<std::streamsize>(DeltaMaskBytes(memberCount)));
+}
+
+inline void WriteDeltaMask(BitWriter& writer, uint64_t mask, size_t memberCount)
+{
+    writer.WriteBits(mask, static_cast<uint32_t>(memberCount));
+}
+
+inline auto ReadDeltaMask(std::istream& stream, size_t memberCount) -> uint64_t
+{
+    unsigned char bytes[sizeof(uint64_t)] = {};
+    stream.read(reinterpret_cast<char*>(bytes), static_cast<std::streamsize>(DeltaMaskBytes(memberCount)));
+    auto mask = uint64_t{0};
+    for (auto i = 0u; i < sizeof(bytes); ++i) mask |= static_cast<uint64_t>(bytes[i]) << (8u * i);
+    return mask;
+}
+
+inline auto ReadDeltaMask(BitReader& reader, size_t memberCount) -> uint64_t
+{
+    return reader.ReadBits(static_cast<uint32_t>(memberCount));
+}
+
+// Compute which members of current differ from baseline, one bit per member in declaration order.
+template<DeltaAggregate T>
+auto ChangedMembers(const T& baseline, const T& current) -> uint64_t
+{
+    return VisitMembers(baseline, [&current](const auto&... baselineMembers)
+    {
+        return VisitMembers(current, [&baselineMembers...](const auto&... currentMembers)
+        {
+            auto mask = uint64_t{0};
+            auto bit = uint64_t{1};
+            ((mask |= (MembersEqual(baselineMembers, currentMembers) ? 0u : bit), bit <<= 1u), ...);
+            return mask;
+        });
+    });
+}
+
+template<class Stream, DeltaAggregate T>
+auto SerializeDelta(Stream& stream, const T& baseline, const T& current) -> bool
+{
+    constexpr auto memberCount = MemberCount<T>();
+    const auto mask = ChangedMembers(baseline, current);
+    WriteDeltaMask(stream, mask, memberCount);
+    if (mask == 0u)
+        return false;
+
+    VisitMembers(current, [&stream, mask](const auto&... members)
+    {
+        auto bit = uint64_t{1};
+        (((mask & bit) ? cpo::SerializeFn{}(stream, members) : void(), bit <<= 1u), ...);
+    });
+
+    return true;
+}
+
+template<class Stream, DeltaAggregate T>
+void DeserializeDelta(Stream& stream, T& object)
+{
+    constexpr auto memberCount = MemberCount<T>();
+    const auto mask = ReadDeltaMask(stream, memberCount);
+    if constexpr (memberCount < 64u)
+    {
+        if (mask >> memberCount)
+            throw NcError("Delta mask does not match member count.", fmt::format("mask: {:#x}, members: {}", mask, memberCount));
+    }
+
+    VisitMembers(object, [&stream, mask](auto&... members)
+    {
+        auto bit = uint64_t{1};
+        (((mask & bit) ? cpo::DeserializeFn{}(stream, members) : void(), bit <<= 1u), ...);
+    });
+}
+} // namespace nc::serialize::binary
+/** @endcond internal */
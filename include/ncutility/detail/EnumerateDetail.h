@@ -351,15 +351,203 @@ template<typename R>
 requires std::ranges::input_range<R> enumerate_view(R &&r)
     -> enumerate_view<std::ranges::views::all_t<R>>;
 
+template<class I, class T>
+struct enumerate_result
+{
+    const I index;
+    T value;
+
+    constexpr bool operator==(const enumerate_result& other) const = default;
+};
+
+// Fast path for contiguous, sized ranges. The iterator is a pointer and a single index, so loops over
+// the view reduce to a plain indexed loop the compiler can vectorize. The view can't itself be
+// contiguous since its elements are prvalue [index, value] pairs, so it's random access.
+template<std::ranges::contiguous_range V>
+    requires std::ranges::view<V> && std::ranges::sized_range<V>
+class contiguous_enumerate_view : public std::ranges::view_interface<contiguous_enumerate_view<V>>
+{
+    V m_base = {};
+
+    template<bool Const>
+    struct iterator
+    {
+      private:
+        using Base = std::conditional_t<Const, const V, V>;
+        using count_type = std::ranges::range_size_t<Base>;
+        using pointer = std::add_pointer_t<std::ranges::range_reference_t<Base>>;
+
+        pointer m_data = nullptr;
+        count_type m_pos = 0;
+
+        template <bool>
+        friend struct iterator;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using reference = enumerate_result<count_type, std::ranges::range_reference_t<Base>>;
+        using value_type = enumerate_result<count_type, std::ranges::range_reference_t<Base>>;
+        using difference_type = std::ranges::range_difference_t<Base>;
+
+        iterator() = default;
+
+        constexpr explicit iterator(pointer data, count_type pos)
+            : m_data(data),
+              m_pos(pos)
+        {
+        }
+
+        constexpr iterator(iterator<!Const> i)
+            requires Const &&
+                     std::convertible_to<typename iterator<!Const>::pointer, pointer>
+            : m_data(i.m_data),
+              m_pos(i.m_pos)
+        {
+        }
+
+        constexpr auto operator*() const
+        {
+            return reference{m_pos, m_data[m_pos]};
+        }
+
+        constexpr auto operator++() -> iterator&
+        {
+            ++m_pos;
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> iterator
+        {
+            auto tmp = *this;
+            ++m_pos;
+            return tmp;
+        }
+
+        constexpr auto operator--() -> iterator&
+        {
+            --m_pos;
+            return *this;
+        }
+
+        constexpr auto operator--(int) -> iterator
+        {
+            auto tmp = *this;
+            --m_pos;
+            return tmp;
+        }
+
+        constexpr auto operator+=(difference_type n) -> iterator&
+        {
+            m_pos = static_cast<count_type>(static_cast<difference_type>(m_pos) + n);
+            return *this;
+        }
+
+        constexpr auto operator-=(difference_type n) -> iterator&
+        {
+            return *this += -n;
+        }
+
+        friend constexpr auto operator+(iterator i, difference_type n) -> iterator
+        {
+            return i += n;
+        }
+
+        friend constexpr auto operator+(difference_type n, iterator i) -> iterator
+        {
+            return i += n;
+        }
+
+        friend constexpr auto operator-(iterator i, difference_type n) -> iterator
+        {
+            return i -= n;
+        }
+
+        constexpr auto operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        friend constexpr auto operator==(const iterator& x, const iterator& y) -> bool
+        {
+            return x.m_pos == y.m_pos;
+        }
+
+        friend constexpr auto operator<=>(const iterator& x, const iterator& y)
+        {
+            return x.m_pos <=> y.m_pos;
+        }
+
+        friend constexpr auto operator-(const iterator& x, const iterator& y) -> difference_type
+        {
+            return static_cast<difference_type>(x.m_pos) - static_cast<difference_type>(y.m_pos);
+        }
+    };
+
+  public:
+    constexpr contiguous_enumerate_view() = default;
+    constexpr contiguous_enumerate_view(V base)
+        : m_base(std::move(base))
+    {
+    }
+
+    constexpr auto begin() requires(!simple_view<V>)
+    {
+        return iterator<false>(std::ranges::data(m_base), 0);
+    }
+
+    constexpr auto begin() const requires std::ranges::contiguous_range<const V>
+    {
+        return iterator<true>(std::ranges::data(m_base), 0);
+    }
+
+    constexpr auto end() requires(!simple_view<V>)
+    {
+        return iterator<false>(std::ranges::data(m_base), std::ranges::size(m_base));
+    }
+
+    constexpr auto end() const requires std::ranges::contiguous_range<const V>
+    {
+        return iterator<true>(std::ranges::data(m_base), std::ranges::size(m_base));
+    }
+
+    constexpr auto size() requires std::ranges::sized_range<V>
+    {
+        return std::ranges::size(m_base);
+    }
+
+    constexpr auto size() const
+        requires std::ranges::sized_range<const V>
+    {
+        return std::ranges::size(m_base);
+    }
+
+    constexpr auto base() const & -> V
+        requires std::copyable<V>
+    {
+        return m_base;
+    }
+
+    constexpr V base() &&
+    {
+        return std::move(m_base);
+    }
+};
+
+template<typename R>
+contiguous_enumerate_view(R &&r) -> contiguous_enumerate_view<std::ranges::views::all_t<R>>;
+
 struct enumerate_view_fn {
     template<typename R>
     constexpr auto operator()(R &&r) const {
-        return enumerate_view{std::forward<R>(r)};
+        if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R>)
+            return contiguous_enumerate_view{std::forward<R>(r)};
+        else
+            return enumerate_view{std::forward<R>(r)};
     }
 
     template<std::ranges::input_range R>
-    constexpr friend auto operator|(R &&rng, const enumerate_view_fn &) {
-        return enumerate_view{std::forward<R>(rng)};
+    constexpr friend auto operator|(R &&rng, const enumerate_view_fn &fn) {
+        return fn(std::forward<R>(rng));
     }
 };
 } // namespace nc::algo::detail
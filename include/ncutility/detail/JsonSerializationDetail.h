@@ -0,0 +1,886 @@
+#pragma once
+
+#include "AggregateReflectionDetail.h"
+#include "ncutility/NcError.h"
+
+#include "nlohmann/json.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/** @cond internal */
+namespace nc::serialize::json::detail
+{
+using Json = nlohmann::json;
+
+// Satisfied for types with a to_json overload found via adl. Overloads for builtin and stl types live
+// in nlohmann's internal namespace, so only user provided overloads are matched.
+template<class T>
+concept HasCustomToJson = requires(Json& j, const T& obj)
+{
+    to_json(j, obj); // intentional ADL
+};
+
+// Satisfied for types with a from_json overload found via adl.
+template<class T>
+concept HasCustomFromJson = requires(const Json& j, T& obj)
+{
+    from_json(j, obj); // intentional ADL
+};
+
+template<class T>
+concept Integer = std::integral<T> && !std::same_as<T, bool>;
+
+template<class T>
+concept StringLike = requires(T& str, const std::string& source)
+{
+    typename T::traits_type;
+    requires std::same_as<typename T::value_type, char>;
+    str.assign(source.data(), source.size());
+};
+
+template<class T>
+concept Optional = requires(T& opt)
+{
+    typename T::value_type;
+    opt.has_value();
+    opt.emplace();
+    opt.reset();
+};
+
+template<class T>
+concept Map = requires(T& map, typename T::key_type& key)
+{
+    typename T::mapped_type;
+    map.try_emplace(std::move(key));
+    map.clear();
+};
+
+template<class T>
+concept Set = !Map<T> && requires(T& set, typename T::key_type& key)
+{
+    set.insert(std::move(key));
+    set.clear();
+};
+
+template<class T>
+concept FixedArray = requires(T& arr)
+{
+    std::tuple_size<T>::value;
+    arr[0];
+    std::ranges::begin(arr);
+};
+
+template<class T>
+concept TupleLike = !FixedArray<T> && requires { std::tuple_size<T>::value; };
+
+template<class T>
+concept Sequence = !StringLike<T> && requires(T& container)
+{
+    container.emplace_back();
+    container.erase(container.begin(), container.end());
+};
+
+template<class T>
+concept ReflectedAggregate = std::is_aggregate_v<T>
+                          && !FixedArray<T>
+                          && (nc::serialize::binary::MemberCount<T>() > 0)
+                          && (nc::serialize::binary::MemberCount<T>() <= nc::serialize::binary::g_aggregateMaxMemberCount);
+
+// Aggregates listing their member names are mapped to json objects rather than arrays.
+template<class T>
+concept NamedAggregate = ReflectedAggregate<T> && requires
+{
+    requires T::JsonMemberNames.size() == nc::serialize::binary::MemberCount<T>();
+    std::string_view{T::JsonMemberNames[0]};
+};
+
+/***** Writing *****/
+
+template<class T>
+void Write(std::ostream& stream, const T& in);
+
+inline void WriteString(std::ostream& stream, std::string_view in)
+{
+    constexpr auto hex = std::string_view{"0123456789abcdef"};
+    stream.put('"');
+    auto pending = in.data();
+    const auto end = in.data() + in.size();
+    for (auto pos = pending; pos != end; ++pos)
+    {
+        const auto c = static_cast<unsigned char>(*pos);
+        if (c >= 0x20u && c != '"' && c != '\\')
+            continue;
+
+        stream.write(pending, pos - pending);
+        pending = pos + 1;
+        switch (c)
+        {
+            case '"':  stream.write("\\\"", 2); break;
+            case '\\': stream.write("\\\\", 2); break;
+            case '\b': stream.write("\\b", 2);  break;
+            case '\f': stream.write("\\f", 2);  break;
+            case '\n': stream.write("\\n", 2);  break;
+            case '\r': stream.write("\\r", 2);  break;
+            case '\t': stream.write("\\t", 2);  break;
+            default:
+            {
+                const char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4u], hex[c & 0xFu]};
+                stream.write(escaped, sizeof(escaped));
+            }
+        }
+    }
+
+    stream.write(pending, end - pending);
+    stream.put('"');
+}
+
+// Widen integers so character types are written as numbers.
+template<Integer T>
+auto FormatInteger(T value) -> std::string
+{
+    if constexpr (std::is_signed_v<T>)
+        return fmt::format("{}", static_cast<int64_t>(value));
+    else
+        return fmt::format("{}", static_cast<uint64_t>(value));
+}
+
+template<class T>
+void WriteKey(std::ostream& stream, const T& key)
+{
+    if constexpr (StringLike<T>)
+        WriteString(stream, std::string_view{key.data(), key.size()});
+    else if constexpr (Integer<T>)
+        stream << '"' << FormatInteger(key) << '"';
+    else
+        static_assert(!sizeof(T), "Json object keys must be strings or integers");
+
+    stream.put(':');
+}
+
+template<class... Ts>
+void WriteElements(std::ostream& stream, const Ts&... elements)
+{
+    [[maybe_unused]] auto first = true;
+    stream.put('[');
+    ((std::exchange(first, false) ? void() : void(stream.put(',')), Write(stream, elements)), ...);
+    stream.put(']');
+}
+
+template<class T>
+void Write(std::ostream& stream, const T& in)
+{
+    if constexpr (std::same_as<T, Json>)
+    {
+        stream << in;
+    }
+    else if constexpr (HasCustomToJson<T>)
+    {
+        auto j = Json{};
+        to_json(j, in);
+        stream << j;
+    }
+    else if constexpr (std::same_as<T, bool>)
+    {
+        stream << (in ? "true" : "false");
+    }
+    else if constexpr (Integer<T>)
+    {
+        stream << FormatInteger(in);
+    }
+    else if constexpr (std::floating_point<T>)
+    {
+        // Json can't represent non-finite values, so they're written as null like nlohmann does.
+        if (std::isfinite(in))
+            stream << fmt::format("{}", in);
+        else
+            stream << "null";
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        Write(stream, static_cast<std::underlying_type_t<T>>(in));
+    }
+    else if constexpr (StringLike<T> || std::same_as<T, std::string_view>)
+    {
+        WriteString(stream, std::string_view{in.data(), in.size()});
+    }
+    else if constexpr (Optional<T>)
+    {
+        if (in.has_value())
+            Write(stream, *in);
+        else
+            stream << "null";
+    }
+    else if constexpr (Map<T>)
+    {
+        auto first = true;
+        stream.put('{');
+        for (const auto& [key, value] : in)
+        {
+            if (!std::exchange(first, false))
+                stream.put(',');
+
+            WriteKey(stream, key);
+            Write(stream, value);
+        }
+
+        stream.put('}');
+    }
+    else if constexpr (TupleLike<T>)
+    {
+        std::apply([&stream](const auto&... elements) { WriteElements(stream, elements...); }, in);
+    }
+    else if constexpr (std::ranges::range<T>)
+    {
+        auto first = true;
+        stream.put('[');
+        for (const auto& element : in)
+        {
+            if (!std::exchange(first, false))
+                stream.put(',');
+
+            Write(stream, element);
+        }
+
+        stream.put(']');
+    }
+    else if constexpr (NamedAggregate<T>)
+    {
+        stream.put('{');
+        nc::serialize::binary::VisitMembers(in, [&stream](const auto&... members)
+        {
+            auto index = size_t{0};
+            ((index != 0 ? void(stream.put(',')) : void(), WriteString(stream, T::JsonMemberNames[index++]), stream.put(':'), Write(stream, members)), ...);
+        });
+        stream.put('}');
+    }
+    else if constexpr (ReflectedAggregate<T>)
+    {
+        nc::serialize::binary::VisitMembers(in, [&stream](const auto&... members)
+        {
+            WriteElements(stream, members...);
+        });
+    }
+    else
+    {
+        static_assert(!sizeof(T), "Type is not supported by json serialization");
+    }
+}
+
+/***** Reading *****/
+
+class FrameStack;
+
+// A type-erased destination for the next parsed value. Scalar events are assigned to the object
+// directly, while the start of an array or object pushes a Frame to receive the nested values.
+struct SlotTable
+{
+    void (*null)(void*);
+    void (*boolean)(void*, bool);
+    void (*integer)(void*, int64_t);
+    void (*unsignedInteger)(void*, uint64_t);
+    void (*floating)(void*, double);
+    void (*string)(void*, std::string&);
+    void (*array)(void*, FrameStack&);
+    void (*object)(void*, FrameStack&);
+};
+
+struct Slot
+{
+    void* object;
+    const SlotTable* table;
+};
+
+// Receives the contents of an array or object.
+class Frame
+{
+    public:
+        virtual ~Frame() noexcept = default;
+
+        // Get the destination for the next array element, or for the value of the last read key.
+        virtual auto Next() -> Slot = 0;
+
+        virtual void Key(std::string&)
+        {
+            throw NcError("Json object found where an array was expected.");
+        }
+
+        // Called after the value for the slot returned from Next() is complete.
+        virtual void ValueDone() {}
+
+        // Called when the array or object is closed.
+        virtual void End() {}
+};
+
+// Frames are strictly nested, so they're created in memory from a pool and destroyed in LIFO order.
+// Frame storage is recycled, so reading large arrays of objects doesn't allocate per object.
+class FrameStack
+{
+    public:
+        FrameStack() = default;
+        FrameStack(FrameStack&&) = delete;
+        FrameStack(const FrameStack&) = delete;
+        void operator=(const FrameStack&) = delete;
+        void operator=(FrameStack&&) = delete;
+
+        ~FrameStack() noexcept
+        {
+            while (!m_frames.empty())
+                Pop();
+        }
+
+        template<class F, class... Args>
+        void Push(Args&&... args)
+        {
+            void* storage = m_pool.allocate(sizeof(F), alignof(F));
+            try
+            {
+                m_frames.push_back(Entry{::new (storage) F(std::forward<Args>(args)...), storage, sizeof(F), alignof(F)});
+            }
+            catch (...)
+            {
+                m_pool.deallocate(storage, sizeof(F), alignof(F));
+                throw;
+            }
+        }
+
+        void Pop() noexcept
+        {
+            const auto entry = m_frames.back();
+            m_frames.pop_back();
+            entry.frame->~Frame();
+            m_pool.deallocate(entry.storage, entry.size, entry.alignment);
+        }
+
+        auto Top() -> Frame& { return *m_frames.back().frame; }
+        auto Empty() const noexcept -> bool { return m_frames.empty(); }
+
+    private:
+        struct Entry
+        {
+            Frame* frame;
+            void* storage;
+            size_t size;
+            size_t alignment;
+        };
+
+        std::vector<Entry> m_frames;
+        std::pmr::unsynchronized_pool_resource m_pool;
+};
+
+template<class T>
+struct SlotOps;
+
+template<class T>
+inline constexpr auto g_slotTable = SlotTable
+{
+    &SlotOps<T>::Null,
+    &SlotOps<T>::template Scalar<bool>,
+    &SlotOps<T>::template Scalar<int64_t>,
+    &SlotOps<T>::template Scalar<uint64_t>,
+    &SlotOps<T>::template Scalar<double>,
+    &SlotOps<T>::String,
+    &SlotOps<T>::Array,
+    &SlotOps<T>::Object
+};
+
+template<class T>
+auto MakeSlot(T& object) -> Slot
+{
+    return Slot{&object, &g_slotTable<T>};
+}
+
+template<class V>
+consteval auto JsonTypeName() -> std::string_view
+{
+    if constexpr (std::same_as<V, std::nullptr_t>) return "null";
+    else if constexpr (std::same_as<V, bool>)      return "boolean";
+    else if constexpr (std::same_as<V, int64_t>)   return "integer";
+    else if constexpr (std::same_as<V, uint64_t>)  return "unsigned integer";
+    else if constexpr (std::same_as<V, double>)    return "number";
+    else                                           return "string";
+}
+
+[[noreturn]] inline void ThrowTypeMismatch(std::string_view found)
+{
+    throw NcError("Json value does not match the target type.", fmt::format("found: {}", found));
+}
+
+template<class T, class V>
+auto CheckedInteger(V value) -> T
+{
+    if (!std::in_range<T>(value))
+        throw NcError("Json integer is out of range for the target type.", fmt::format("value: {}", value));
+
+    return static_cast<T>(value);
+}
+
+// Assign a scalar json value to an object. Strings are copied into the target's existing storage.
+template<class T, class V>
+void Assign(T& obj, V& value)
+{
+    constexpr auto isInteger = std::same_as<V, int64_t> || std::same_as<V, uint64_t>;
+    if constexpr (std::same_as<T, Json>)
+        obj = std::move(value);
+    else if constexpr (HasCustomFromJson<T>)
+        from_json(Json(std::move(value)), obj);
+    else if constexpr (Optional<T>)
+    {
+        if constexpr (std::same_as<V, std::nullptr_t>)
+            obj.reset();
+        else
+            Assign(obj.has_value() ? *obj : obj.emplace(), value);
+    }
+    else if constexpr (std::same_as<T, bool> && std::same_as<V, bool>)
+        obj = value;
+    else if constexpr (Integer<T> && isInteger)
+        obj = CheckedInteger<T>(value);
+    else if constexpr (std::floating_point<T> && (isInteger || std::same_as<V, double>))
+        obj = static_cast<T>(value);
+    else if constexpr (std::floating_point<T> && std::same_as<V, std::nullptr_t>)
+        obj = std::numeric_limits<T>::quiet_NaN();
+    else if constexpr (std::is_enum_v<T> && isInteger)
+        obj = static_cast<T>(CheckedInteger<std::underlying_type_t<T>>(value));
+    else if constexpr (StringLike<T> && std::same_as<V, std::string>)
+        obj.assign(value.data(), value.size());
+    else
+        ThrowTypeMismatch(JsonTypeName<V>());
+}
+
+// Builds a json value for targets read through nlohmann (Json itself or types with from_json).
+inline auto DomNext(Json& json, std::string& key) -> Slot
+{
+    if (json.is_array())
+    {
+        json.emplace_back();
+        return MakeSlot(json.back());
+    }
+
+    return MakeSlot(json[key]);
+}
+
+class DomFrame final : public Frame
+{
+    public:
+        explicit DomFrame(Json& json) : m_json{&json}, m_key{} {}
+        auto Next() -> Slot override { return DomNext(*m_json, m_key); }
+        void Key(std::string& key) override { m_key.swap(key); }
+
+    private:
+        Json* m_json;
+        std::string m_key;
+};
+
+template<class T>
+class CustomFrame final : public Frame
+{
+    public:
+        // Json is initialized with parentheses, as braces would wrap the value in an array.
+        CustomFrame(T& target, Json&& json) : m_target{&target}, m_json(std::move(json)), m_key{} {}
+        auto Next() -> Slot override { return DomNext(m_json, m_key); }
+        void Key(std::string& key) override { m_key.swap(key); }
+        void End() override { from_json(std::as_const(m_json), *m_target); }
+
+    private:
+        T* m_target;
+        Json m_json;
+        std::string m_key;
+};
+
+// Ignores a value and everything nested within it, for object members the target doesn't have.
+class SkipFrame final : public Frame
+{
+    public:
+        auto Next() -> Slot override;
+        void Key(std::string&) override {}
+};
+
+inline constexpr auto g_skipSlotTable = SlotTable
+{
+    [](void*) {},
+    [](void*, bool) {},
+    [](void*, int64_t) {},
+    [](void*, uint64_t) {},
+    [](void*, double) {},
+    [](void*, std::string&) {},
+    [](void*, FrameStack& frames) { frames.Push<SkipFrame>(); },
+    [](void*, FrameStack& frames) { frames.Push<SkipFrame>(); }
+};
+
+inline auto SkipFrame::Next() -> Slot
+{
+    return Slot{nullptr, &g_skipSlotTable};
+}
+
+// Reads into a resizable container, reusing existing elements before appending new ones.
+template<class T>
+class SequenceFrame final : public Frame
+{
+    public:
+        explicit SequenceFrame(T& container)
+            : m_container{&container}, m_next{container.begin()}
+        {
+        }
+
+        auto Next() -> Slot override
+        {
+            if (m_next != m_container->end())
+                return MakeSlot(*m_next++);
+
+            auto& element = m_container->emplace_back();
+            m_next = m_container->end();
+            return MakeSlot(element);
+        }
+
+        void End() override
+        {
+            m_container->erase(m_next, m_container->end());
+        }
+
+    private:
+        T* m_container;
+        typename T::iterator m_next;
+};
+
+template<class T>
+class FixedArrayFrame final : public Frame
+{
+    public:
+        explicit FixedArrayFrame(T& arr) : m_array{&arr}, m_index{0} {}
+
+        auto Next() -> Slot override
+        {
+            if (m_index == std::tuple_size_v<T>)
+                ThrowLengthMismatch();
+
+            return MakeSlot((*m_array)[m_index++]);
+        }
+
+        void End() override
+        {
+            if (m_index != std::tuple_size_v<T>)
+                ThrowLengthMismatch();
+        }
+
+    private:
+        T* m_array;
+        size_t m_index;
+
+        [[noreturn]] static void ThrowLengthMismatch()
+        {
+            throw NcError("Json array length does not match the target type.", fmt::format("expected: {}", std::tuple_size_v<T>));
+        }
+};
+
+template<class T>
+class SetFrame final : public Frame
+{
+    public:
+        explicit SetFrame(T& set) : m_set{&set}, m_value{} { set.clear(); }
+        auto Next() -> Slot override { return MakeSlot(m_value); }
+
+        void ValueDone() override
+        {
+            m_set->insert(std::move(m_value));
+            m_value = typename T::key_type{};
+        }
+
+    private:
+        T* m_set;
+        typename T::key_type m_value;
+};
+
+template<class T>
+class MapFrame final : public Frame
+{
+    public:
+        explicit MapFrame(T& map) : m_map{&map}, m_key{}, m_value{nullptr} { map.clear(); }
+
+        auto Next() -> Slot override
+        {
+            return MakeSlot(*m_value);
+        }
+
+        void Key(std::string& key) override
+        {
+            using key_type = typename T::key_type;
+            if constexpr (StringLike<key_type>)
+            {
+                m_key.assign(key.data(), key.size());
+            }
+            else if constexpr (Integer<key_type>)
+            {
+                const auto [end, error] = std::from_chars(key.data(), key.data() + key.size(), m_key);
+                if (error != std::errc{} || end != key.data() + key.size())
+                    throw NcError("Json object key is not a valid integer for the target map.", key);
+            }
+            else
+            {
+                static_assert(!sizeof(T), "Json object keys must be strings or integers");
+            }
+
+            m_value = &m_map->try_emplace(std::move(m_key)).first->second;
+        }
+
+    private:
+        T* m_map;
+        typename T::key_type m_key;
+        typename T::mapped_type* m_value;
+};
+
+// Reads array elements into a fixed list of slots, used for tuples and aggregates without names.
+template<size_t N>
+class PositionalFrame final : public Frame
+{
+    public:
+        explicit PositionalFrame(const std::array<Slot, N>& slots) : m_slots{slots}, m_index{0} {}
+
+        auto Next() -> Slot override
+        {
+            if (m_index == N)
+                ThrowLengthMismatch();
+
+            return m_slots[m_index++];
+        }
+
+        void End() override
+        {
+            if (m_index != N)
+                ThrowLengthMismatch();
+        }
+
+    private:
+        std::array<Slot, N> m_slots;
+        size_t m_index;
+
+        [[noreturn]] static void ThrowLengthMismatch()
+        {
+            throw NcError("Json array length does not match the target's member count.", fmt::format("expected: {}", N));
+        }
+};
+
+// Reads object members into aggregate members by name. Unknown keys are skipped, and members without
+// a key keep their existing value.
+template<class T>
+class NamedFrame final : public Frame
+{
+    static constexpr auto Count = nc::serialize::binary::MemberCount<T>();
+
+    public:
+        explicit NamedFrame(T& obj)
+            : m_slots{nc::serialize::binary::VisitMembers(obj, [](auto&... members) { return std::array<Slot, Count>{MakeSlot(members)...}; })},
+              m_next{}
+        {
+        }
+
+        auto Next() -> Slot override { return m_next; }
+
+        void Key(std::string& key) override
+        {
+            m_next = Slot{nullptr, &g_skipSlotTable};
+            for (auto i = 0u; i < Count; ++i)
+            {
+                if (key == std::string_view{T::JsonMemberNames[i]})
+                {
+                    m_next = m_slots[i];
+                    break;
+                }
+            }
+        }
+
+    private:
+        std::array<Slot, Count> m_slots;
+        Slot m_next;
+};
+
+template<class T>
+struct SlotOps
+{
+    static auto Target(void* obj) -> T& { return *static_cast<T*>(obj); }
+
+    static void Null(void* obj)
+    {
+        auto value = nullptr;
+        Assign(Target(obj), value);
+    }
+
+    template<class V>
+    static void Scalar(void* obj, V value)
+    {
+        Assign(Target(obj), value);
+    }
+
+    static void String(void* obj, std::string& value)
+    {
+        Assign(Target(obj), value);
+    }
+
+    static void Array(void* obj, FrameStack& frames)
+    {
+        auto& target = Target(obj);
+        if constexpr (std::same_as<T, Json>)
+        {
+            target = Json::array();
+            frames.Push<DomFrame>(target);
+        }
+        else if constexpr (HasCustomFromJson<T>)
+            frames.Push<CustomFrame<T>>(target, Json::array());
+        else if constexpr (Optional<T>)
+            SlotOps<typename T::value_type>::Array(target.has_value() ? &*target : &target.emplace(), frames);
+        else if constexpr (Set<T>)
+            frames.Push<SetFrame<T>>(target);
+        else if constexpr (FixedArray<T>)
+            frames.Push<FixedArrayFrame<T>>(target);
+        else if constexpr (TupleLike<T>)
+            frames.Push<PositionalFrame<std::tuple_size_v<T>>>(std::apply([](auto&... elements) { return std::array{MakeSlot(elements)...}; }, target));
+        else if constexpr (Sequence<T>)
+            frames.Push<SequenceFrame<T>>(target);
+        else if constexpr (ReflectedAggregate<T> && !NamedAggregate<T>)
+            frames.Push<PositionalFrame<nc::serialize::binary::MemberCount<T>()>>(nc::serialize::binary::VisitMembers(target, [](auto&... members) { return std::array{MakeSlot(members)...}; }));
+        else
+            ThrowTypeMismatch("array");
+    }
+
+    static void Object(void* obj, FrameStack& frames)
+    {
+        auto& target = Target(obj);
+        if constexpr (std::same_as<T, Json>)
+        {
+            target = Json::object();
+            frames.Push<DomFrame>(target);
+        }
+        else if constexpr (HasCustomFromJson<T>)
+            frames.Push<CustomFrame<T>>(target, Json::object());
+        else if constexpr (Optional<T>)
+            SlotOps<typename T::value_type>::Object(target.has_value() ? &*target : &target.emplace(), frames);
+        else if constexpr (Map<T>)
+            frames.Push<MapFrame<T>>(target);
+        else if constexpr (NamedAggregate<T>)
+            frames.Push<NamedFrame<T>>(target);
+        else
+            ThrowTypeMismatch("object");
+    }
+};
+
+// Receives events from nlohmann's sax parser, forwarding them to the slot for the current value.
+class SaxReader
+{
+    public:
+        explicit SaxReader(Slot root) : m_frames{}, m_root{root} {}
+
+        auto null() -> bool
+        {
+            const auto slot = NextSlot();
+            slot.table->null(slot.object);
+            return ValueDone();
+        }
+
+        auto boolean(bool value) -> bool { return Scalar(&SlotTable::boolean, value); }
+        auto number_integer(int64_t value) -> bool { return Scalar(&SlotTable::integer, value); }
+        auto number_unsigned(uint64_t value) -> bool { return Scalar(&SlotTable::unsignedInteger, value); }
+        auto number_float(double value, const std::string&) -> bool { return Scalar(&SlotTable::floating, value); }
+        auto string(std::string& value) -> bool { return Scalar<std::string&>(&SlotTable::string, value); }
+        auto binary(Json::binary_t&) -> bool { ThrowTypeMismatch("binary"); }
+
+        auto start_array(size_t) -> bool
+        {
+            const auto slot = NextSlot();
+            slot.table->array(slot.object, m_frames);
+            return true;
+        }
+
+        auto start_object(size_t) -> bool
+        {
+            const auto slot = NextSlot();
+            slot.table->object(slot.object, m_frames);
+            return true;
+        }
+
+        auto key(std::string& key) -> bool
+        {
+            m_frames.Top().Key(key);
+            return true;
+        }
+
+        auto end_array() -> bool { return EndFrame(); }
+        auto end_object() -> bool { return EndFrame(); }
+
+        auto parse_error(size_t position, const std::string&, const nlohmann::detail::exception& error) -> bool
+        {
+            throw NcError("Failed to parse json.", fmt::format("position: {}, {}", position, error.what()));
+        }
+
+    private:
+        FrameStack m_frames;
+        Slot m_root;
+
+        template<class V>
+        auto Scalar(void (*SlotTable::*handler)(void*, V), V value) -> bool
+        {
+            const auto slot = NextSlot();
+            (slot.table->*handler)(slot.object, value);
+            return ValueDone();
+        }
+
+        auto NextSlot() -> Slot
+        {
+            return m_frames.Empty() ? m_root : m_frames.Top().Next();
+        }
+
+        auto ValueDone() -> bool
+        {
+            if (!m_frames.Empty())
+                m_frames.Top().ValueDone();
+
+            return true;
+        }
+
+        auto EndFrame() -> bool
+        {
+            m_frames.Top().End();
+            m_frames.Pop();
+            return ValueDone();
+        }
+};
+
+template<class T>
+void Read(std::istream& stream, T& out)
+{
+    auto reader = SaxReader{MakeSlot(out)};
+    Json::sax_parse(stream, &reader, nlohmann::detail::input_format_t::json, false);
+}
+
+// CPO for nc::serialize::json::Serialize
+struct SerializeFn
+{
+    template<class T>
+    void operator()(std::ostream& stream, const T& obj) const
+    {
+        nc::serialize::json::detail::Write(stream, obj);
+    }
+};
+
+// CPO for nc::serialize::json::Deserialize
+struct DeserializeFn
+{
+    template<class T>
+    void operator()(std::istream& stream, T& obj) const
+    {
+        nc::serialize::json::detail::Read(stream, obj);
+    }
+};
+} // namespace nc::serialize::json::detail
+/** @endcond internal */
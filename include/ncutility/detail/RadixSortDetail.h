@@ -0,0 +1,185 @@
+#pragma once
+
+#include "BlockPartitionDetail.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/** @cond internal */
+namespace nc::algo::detail
+{
+inline constexpr size_t g_radixBits = 8ull;
+inline constexpr size_t g_radixBucketCount = 1ull << g_radixBits;
+
+template<class K>
+using radix_bits_t = std::conditional_t<sizeof(K) == 1, uint8_t,
+                     std::conditional_t<sizeof(K) == 2, uint16_t,
+                     std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>>>;
+
+// Map a key to unsigned bits with the same ordering. Signed integers flip the sign bit. Floats flip all
+// bits when negative so larger magnitudes sort first, and only the sign bit otherwise.
+template<class K>
+constexpr auto ToRadixBits(K key) noexcept -> radix_bits_t<K>
+{
+    using bits_t = radix_bits_t<K>;
+    constexpr auto signBit = static_cast<bits_t>(bits_t{1} << (sizeof(bits_t) * 8 - 1));
+    if constexpr (std::unsigned_integral<K>)
+    {
+        return static_cast<bits_t>(key);
+    }
+    else if constexpr (std::signed_integral<K>)
+    {
+        return static_cast<bits_t>(static_cast<bits_t>(key) ^ signBit);
+    }
+    else
+    {
+        const auto bits = std::bit_cast<bits_t>(key);
+        return (bits & signBit) ? static_cast<bits_t>(~bits) : static_cast<bits_t>(bits | signBit);
+    }
+}
+
+template<class Bits>
+constexpr auto Digit(Bits bits, size_t pass) noexcept -> size_t
+{
+    return static_cast<size_t>((bits >> (pass * g_radixBits)) & (g_radixBucketCount - 1));
+}
+
+template<class T, class Proj>
+using radix_key_t = std::remove_cvref_t<std::invoke_result_t<Proj&, T&>>;
+
+// Size the scratch buffer for n items, preferring not to copy when items can be default constructed.
+template<class T>
+auto PrepareScratch(std::vector<T>& scratch, std::span<T> items) -> T*
+{
+    if constexpr (std::default_initializable<T>)
+    {
+        if (scratch.size() < items.size())
+            scratch.resize(items.size());
+    }
+    else
+    {
+        scratch.assign(items.begin(), items.end());
+    }
+
+    return scratch.data();
+}
+
+template<class T, class Proj>
+void RadixSortSequential(std::span<T> items, std::vector<T>& scratch, Proj& proj)
+{
+    constexpr auto passCount = sizeof(radix_key_t<T, Proj>);
+    const auto count = items.size();
+    if (count < 2)
+        return;
+
+    // Histograms for all passes come from one read of the keys.
+    auto histograms = std::array<std::array<size_t, g_radixBucketCount>, passCount>{};
+    for (auto& item : items)
+    {
+        const auto bits = ToRadixBits(std::invoke(proj, item));
+        for (auto pass = size_t{0}; pass < passCount; ++pass)
+            ++histograms[pass][Digit(bits, pass)];
+    }
+
+    auto from = items.data();
+    auto to = PrepareScratch(scratch, items);
+    for (auto pass = size_t{0}; pass < passCount; ++pass)
+    {
+        // Skip passes where every key has the same digit, common for small or clustered keys.
+        auto& offsets = histograms[pass];
+        if (std::ranges::find(offsets, count) != offsets.end())
+            continue;
+
+        auto sum = size_t{0};
+        for (auto& offset : offsets)
+            sum += std::exchange(offset, sum);
+
+        for (auto i = size_t{0}; i < count; ++i)
+        {
+            const auto digit = Digit(ToRadixBits(std::invoke(proj, from[i])), pass);
+            to[offsets[digit]++] = std::move(from[i]);
+        }
+
+        std::swap(from, to);
+    }
+
+    if (from != items.data())
+        std::move(from, from + count, items.data());
+}
+
+// Items are split into fixed blocks, one histogram per block. Offsets are assigned bucket-major then
+// block-major, so each block scatters into disjoint positions and the sort remains stable.
+template<class T, class Proj>
+void RadixSortParallel(std::span<T> items, std::vector<T>& scratch, std::vector<size_t>& counts, Proj& proj,
+                       size_t minBlockSize, size_t maxConcurrency)
+{
+    constexpr auto passCount = sizeof(radix_key_t<T, Proj>);
+    const auto count = items.size();
+    const auto blocks = BlockPartition{count, minBlockSize, maxConcurrency};
+    const auto blockCount = blocks.BlockCount();
+    if (blockCount < 2)
+    {
+        RadixSortSequential(items, scratch, proj);
+        return;
+    }
+
+    counts.assign(blockCount * g_radixBucketCount, 0);
+    auto from = items.data();
+    auto to = PrepareScratch(scratch, items);
+    for (auto pass = size_t{0}; pass < passCount; ++pass)
+    {
+        TaskScheduler::Default().ParallelFor(blockCount, [&](size_t block)
+        {
+            const auto histogram = counts.data() + block * g_radixBucketCount;
+            std::fill_n(histogram, g_radixBucketCount, size_t{0});
+            const auto [begin, end] = blocks[block];
+            for (auto i = begin; i < end; ++i)
+                ++histogram[Digit(ToRadixBits(std::invoke(proj, from[i])), pass)];
+        }, 1, maxConcurrency);
+
+        auto sum = size_t{0};
+        auto trivial = false;
+        for (auto bucket = size_t{0}; bucket < g_radixBucketCount; ++bucket)
+        {
+            const auto bucketStart = sum;
+            for (auto block = size_t{0}; block < blockCount; ++block)
+                sum += std::exchange(counts[block * g_radixBucketCount + bucket], sum);
+
+            trivial |= sum - bucketStart == count;
+        }
+
+        if (trivial)
+            continue;
+
+        TaskScheduler::Default().ParallelFor(blockCount, [&](size_t block)
+        {
+            const auto offsets = counts.data() + block * g_radixBucketCount;
+            const auto [begin, end] = blocks[block];
+            for (auto i = begin; i < end; ++i)
+            {
+                const auto digit = Digit(ToRadixBits(std::invoke(proj, from[i])), pass);
+                to[offsets[digit]++] = std::move(from[i]);
+            }
+        }, 1, maxConcurrency);
+
+        std::swap(from, to);
+    }
+
+    if (from != items.data())
+    {
+        blocks.ForEach([&](size_t begin, size_t end)
+        {
+            std::move(from + begin, from + end, items.data() + begin);
+        }, maxConcurrency);
+    }
+}
+} // namespace nc::algo::detail
+/** @endcond internal */
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "BlockPartitionDetail.h"
+#include "ncutility/NcError.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+/** @cond internal */
+namespace nc::algo::detail
+{
+// Independent accumulators in the reduction kernel. Splitting the dependency chain lets the compiler
+// vectorize the loop for arithmetic types without relaxing floating point rules.
+inline constexpr size_t g_reduceLaneCount = 8ull;
+
+template<std::random_access_iterator It>
+constexpr auto Advance(It it, size_t n) -> It
+{
+    return it + static_cast<std::iter_difference_t<It>>(n);
+}
+
+// Reduce a non-empty block. Elements are combined out of order, so op must be associative and commutative.
+template<class T, class It, class Op>
+auto ReduceBlock(It first, size_t count, Op& op) -> T
+{
+    auto i = size_t{0};
+    auto acc = std::optional<T>{};
+    if (count >= g_reduceLaneCount * 2)
+    {
+        auto lanes = [first]<size_t... Lane>(std::index_sequence<Lane...>)
+        {
+            return std::array<T, g_reduceLaneCount>{static_cast<T>(first[Lane])...};
+        }(std::make_index_sequence<g_reduceLaneCount>{});
+
+        const auto laneEnd = count - count % g_reduceLaneCount;
+        for (i = g_reduceLaneCount; i < laneEnd; i += g_reduceLaneCount)
+        {
+            const auto block = Advance(first, i);
+            for (auto lane = size_t{0}; lane < g_reduceLaneCount; ++lane)
+                lanes[lane] = static_cast<T>(std::invoke(op, lanes[lane], block[static_cast<std::iter_difference_t<It>>(lane)]));
+        }
+
+        acc.emplace(lanes[0]);
+        for (auto lane = size_t{1}; lane < g_reduceLaneCount; ++lane)
+            *acc = static_cast<T>(std::invoke(op, *acc, lanes[lane]));
+    }
+    else
+    {
+        acc.emplace(static_cast<T>(*first));
+        i = 1;
+    }
+
+    for (auto it = Advance(first, i); i < count; ++i, ++it)
+        *acc = static_cast<T>(std::invoke(op, *acc, *it));
+
+    return std::move(*acc);
+}
+
+template<class T, class In, class Out, class Op>
+auto InclusiveScanBlock(In first, Out out, size_t count, T acc, Op& op) -> T
+{
+    for (auto i = size_t{0}; i < count; ++i, ++first, ++out)
+    {
+        acc = static_cast<T>(std::invoke(op, acc, *first));
+        *out = acc;
+    }
+
+    return acc;
+}
+
+// The element is read before the output is written so the scan may run in place.
+template<class T, class In, class Out, class Op>
+auto ExclusiveScanBlock(In first, Out out, size_t count, T acc, Op& op) -> T
+{
+    for (auto i = size_t{0}; i < count; ++i, ++first, ++out)
+    {
+        auto value = static_cast<T>(*first);
+        *out = acc;
+        acc = static_cast<T>(std::invoke(op, acc, std::move(value)));
+    }
+
+    return acc;
+}
+
+// Pass one of the parallel scans. Reduce each block with the vectorized kernel.
+template<class T, class It, class Op>
+auto ReduceBlocks(It first, const BlockPartition& blocks, Op& op, size_t maxConcurrency) -> std::vector<std::optional<T>>
+{
+    auto partials = std::vector<std::optional<T>>(blocks.BlockCount());
+    TaskScheduler::Default().ParallelFor(blocks.BlockCount(), [&](size_t block)
+    {
+        const auto [begin, end] = blocks[block];
+        partials[block].emplace(ReduceBlock<T>(Advance(first, begin), end - begin, op));
+    }, 1, maxConcurrency);
+
+    return partials;
+}
+
+template<class T, class R, class Op>
+auto Reduce(const R& range, T init, Op& op, size_t minBlockSize, size_t maxConcurrency) -> T
+{
+    const auto count = static_cast<size_t>(std::ranges::size(range));
+    if (count == 0)
+        return init;
+
+    const auto first = std::ranges::begin(range);
+    const auto blocks = BlockPartition{count, minBlockSize, maxConcurrency};
+    if (blocks.BlockCount() < 2)
+        return static_cast<T>(std::invoke(op, std::move(init), ReduceBlock<T>(first, count, op)));
+
+    for (auto& partial : ReduceBlocks<T>(first, blocks, op, maxConcurrency))
+        init = static_cast<T>(std::invoke(op, std::move(init), std::move(*partial)));
+
+    return init;
+}
+
+// Two-pass scan: reduce each block, scan the block totals on the calling thread, then scan each block
+// from its starting offset. The second pass only touches its own block, so in place scans are safe.
+template<bool Inclusive, class T, class In, class Out, class Op>
+auto Scan(In& input, Out& output, std::optional<T> init, Op& op, size_t minBlockSize, size_t maxConcurrency) -> std::optional<T>
+{
+    const auto count = static_cast<size_t>(std::ranges::size(input));
+    if (count == 0)
+        return init;
+
+    const auto inFirst = std::ranges::begin(input);
+    const auto outFirst = std::ranges::begin(output);
+    const auto scanBlock = [&](size_t begin, size_t end, std::optional<T> acc) -> T
+    {
+        auto in = Advance(inFirst, begin);
+        auto out = Advance(outFirst, begin);
+        if (!acc)
+        {
+            // Only an inclusive scan without an initial value; the first element starts the sum.
+            acc.emplace(static_cast<T>(*in));
+            *out = *acc;
+            ++in;
+            ++out;
+            ++begin;
+        }
+
+        if constexpr (Inclusive)
+            return InclusiveScanBlock(in, out, end - begin, std::move(*acc), op);
+        else
+            return ExclusiveScanBlock(in, out, end - begin, std::move(*acc), op);
+    };
+
+    const auto blocks = BlockPartition{count, minBlockSize, maxConcurrency};
+    if (blocks.BlockCount() < 2)
+        return scanBlock(0, count, std::move(init));
+
+    auto offsets = ReduceBlocks<T>(inFirst, blocks, op, maxConcurrency);
+    auto total = std::move(init);
+    for (auto& offset : offsets)
+    {
+        auto blockTotal = total ? static_cast<T>(std::invoke(op, *total, std::move(*offset))) : std::move(*offset);
+        offset = std::exchange(total, std::move(blockTotal));
+    }
+
+    TaskScheduler::Default().ParallelFor(blocks.BlockCount(), [&](size_t block)
+    {
+        const auto [begin, end] = blocks[block];
+        scanBlock(begin, end, std::move(offsets[block]));
+    }, 1, maxConcurrency);
+
+    return total;
+}
+
+template<class In, class Out, class Pred>
+auto CopyIfSequential(In& input, Out& output, Pred& pred) -> size_t
+{
+    [[maybe_unused]] const auto capacity = static_cast<size_t>(std::ranges::size(output));
+    auto out = std::ranges::begin(output);
+    auto written = size_t{0};
+    for (auto&& value : input)
+    {
+        if (std::invoke(pred, value))
+        {
+            NC_ASSERT(written < capacity, "CopyIf output is too small");
+            *out = value;
+            ++out;
+            ++written;
+        }
+    }
+
+    return written;
+}
+
+// Two-pass compaction: count selected elements per block, scan the counts into write offsets, then copy
+// each block into its own dense region of the output.
+template<class In, class Out, class Pred>
+auto CopyIfParallel(In& input, Out& output, Pred& pred, size_t minBlockSize, size_t maxConcurrency) -> size_t
+{
+    const auto count = static_cast<size_t>(std::ranges::size(input));
+    const auto blocks = BlockPartition{count, minBlockSize, maxConcurrency};
+    if (blocks.BlockCount() < 2)
+        return CopyIfSequential(input, output, pred);
+
+    const auto inFirst = std::ranges::begin(input);
+    auto offsets = std::vector<size_t>(blocks.BlockCount());
+    TaskScheduler::Default().ParallelFor(blocks.BlockCount(), [&](size_t block)
+    {
+        const auto [begin, end] = blocks[block];
+        offsets[block] = static_cast<size_t>(std::count_if(Advance(inFirst, begin), Advance(inFirst, end), std::ref(pred)));
+    }, 1, maxConcurrency);
+
+    auto total = size_t{0};
+    for (auto& offset : offsets)
+        total += std::exchange(offset, total);
+
+    NC_ASSERT(total <= static_cast<size_t>(std::ranges::size(output)), "CopyIf output is too small");
+    const auto outFirst = std::ranges::begin(output);
+    TaskScheduler::Default().ParallelFor(blocks.BlockCount(), [&](size_t block)
+    {
+        const auto [begin, end] = blocks[block];
+        std::copy_if(Advance(inFirst, begin), Advance(inFirst, end), Advance(outFirst, offsets[block]), std::ref(pred));
+    }, 1, maxConcurrency);
+
+    return total;
+}
+} // namespace nc::algo::detail
+/** @endcond internal */
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "BinarySerializationDetail.h"
+#include "BitSerializationDetail.h"
 
 /** @cond internal */
 namespace nc::serialize::cpo
@@ -12,101 +13,215 @@ inline constexpr bool g_alwaysFalse = false;
 // Indicates how a (de)serialize call will be resolved.
 enum class Dispatch { None, Member, Adl, Default };
 
+// Internal implementations for each stream type.
+template<class T>
+void DefaultSerialize(std::ostream& stream, const T& obj)
+{
+    nc::serialize::binary::Serialize(stream, obj);
+}
+
+template<class T>
+    requires requires(BitWriter& writer, const T& obj) { nc::serialize::bits::Serialize(writer, obj); }
+void DefaultSerialize(BitWriter& writer, const T& obj)
+{
+    nc::serialize::bits::Serialize(writer, obj);
+}
+
+template<class T>
+void DefaultDeserialize(std::istream& stream, T& obj)
+{
+    nc::serialize::binary::Deserialize(stream, obj);
+}
+
+template<class T>
+    requires requires(BitReader& reader, T& obj) { nc::serialize::bits::Deserialize(reader, obj); }
+void DefaultDeserialize(BitReader& reader, T& obj)
+{
+    nc::serialize::bits::Deserialize(reader, obj);
+}
+
 // Satisfied for types that have a Serialize member function.
-template <class T>
-concept HasSerializeMember = requires(std::ostream& stream, const T& obj)
+template <class T, class Stream = std::ostream>
+concept HasSerializeMember = requires(Stream& stream, const T& obj)
 {
     { obj.Serialize(stream) } -> std::same_as<void>;
 };
 
 // Satisfied for types that have a Serialize function in their namespace.
-template <class T>
-concept HasSerializeAdl = requires(std::ostream& stream, const T& obj)
+template <class T, class Stream = std::ostream>
+concept HasSerializeAdl = requires(Stream& stream, const T& obj)
 {
     { Serialize(stream, obj) } -> std::same_as<void>;
 };
 
 // Satisfied for types that have a compatible Serialize function internally.
-template <class T>
-concept HasSerializeDefault = requires(std::ostream& stream, const T& obj)
+template <class T, class Stream = std::ostream>
+concept HasSerializeDefault = requires(Stream& stream, const T& obj)
 {
-    { nc::serialize::binary::Serialize(stream, obj) } -> std::same_as<void>;
+    { nc::serialize::cpo::DefaultSerialize(stream, obj) } -> std::same_as<void>;
 };
 
 // CPO for nc::serialize::Serialize - dispatches to a `Serialize()` function that is either
 // a member of T, non-member found via adl, or internal non- member depending on what is
-// available. Resolution is attempted in that order.
+// available. Resolution is attempted in that order. Supports byte streams and BitWriters.
 struct SerializeFn
 {
     private:
-        template<class T>
+        template<class T, class Stream>
         static consteval auto GetDispatch() -> Dispatch
         {
-            if constexpr(HasSerializeMember<T>)
+            if constexpr(HasSerializeMember<T, Stream>)
                 return Dispatch::Member;
-            else if constexpr(HasSerializeAdl<T>)
+            else if constexpr(HasSerializeAdl<T, Stream>)
                 return Dispatch::Adl;
-            else if constexpr(HasSerializeDefault<T>)
+            else if constexpr(HasSerializeDefault<T, Stream>)
                 return Dispatch::Default;
             else
                 return Dispatch::None;
         }
 
-        template<class T>
-        static constexpr auto Strategy = GetDispatch<T>();
+        template<class T, class Stream>
+        static constexpr auto Strategy = GetDispatch<T, Stream>();
 
-    public:
-        template<class T>
-            requires (Strategy<T> != Dispatch::None)
-        auto operator()(std::ostream& stream, const T& obj) const
+        template<class Stream, class T>
+        static void Invoke(Stream& stream, const T& obj)
         {
-            constexpr auto dispatch = Strategy<T>;
+            constexpr auto dispatch = Strategy<T, Stream>;
             if constexpr(dispatch == Dispatch::Member)
                 obj.Serialize(stream);
             else if constexpr(dispatch == Dispatch::Adl)
                 Serialize(stream, obj);
             else if constexpr(dispatch == Dispatch::Default)
-                nc::serialize::binary::Serialize(stream, obj);
+                nc::serialize::cpo::DefaultSerialize(stream, obj);
             else
                 static_assert(g_alwaysFalse<T>, "Unreachable");
         }
+
+    public:
+        template<class T>
+            requires (Strategy<T, std::ostream> != Dispatch::None)
+        auto operator()(std::ostream& stream, const T& obj) const
+        {
+            Invoke(stream, obj);
+        }
+
+        template<class T>
+            requires (Strategy<T, BitWriter> != Dispatch::None)
+        auto operator()(BitWriter& writer, const T& obj) const
+        {
+            Invoke(writer, obj);
+        }
 };
 
 // Satisfied for types that have a Deserialize member function.
-template <class T>
-concept HasDeserializeMember = requires(std::istream& stream, T& obj)
+template <class T, class Stream = std::istream>
+concept HasDeserializeMember = requires(Stream& stream, T& obj)
 {
     { obj.Deserialize(stream) } -> std::same_as<void>;
 };
 
 // Satisfied for types that have a Deserialize function in their namespace.
-template <class T>
-concept HasDeserializeAdl = requires(std::istream& stream, T& obj)
+template <class T, class Stream = std::istream>
+concept HasDeserializeAdl = requires(Stream& stream, T& obj)
 {
     { Deserialize(stream, obj) } -> std::same_as<void>; // intentional ADL
 };
 
 // Satisfied for types that have a compatible Deserialize function internally.
-template <class T>
-concept HasDeserializeDefault = requires(std::istream& stream, T& obj)
+template <class T, class Stream = std::istream>
+concept HasDeserializeDefault = requires(Stream& stream, T& obj)
 {
-    { nc::serialize::binary::Deserialize(stream, obj) } -> std::same_as<void>;
+    { nc::serialize::cpo::DefaultDeserialize(stream, obj) } -> std::same_as<void>;
 };
 
 // CPO for nc::serialize::Deserialize - dispatches to a `Deserialize()` function that is either
 // a member of T, non-member found via adl, or internal non- member depending on what is
-// available. Resolution is attempted in that order.
+// available. Resolution is attempted in that order. Supports byte streams and BitReaders.
 struct DeserializeFn
+{
+    private:
+        template<class T, class Stream>
+        static consteval auto GetDispatch() -> Dispatch
+        {
+            if constexpr(HasDeserializeMember<T, Stream>)
+                return Dispatch::Member;
+            else if constexpr(HasDeserializeAdl<T, Stream>)
+                return Dispatch::Adl;
+            else if constexpr(HasDeserializeDefault<T, Stream>)
+                return Dispatch::Default;
+            else
+                return Dispatch::None;
+        }
+
+        template<class T, class Stream>
+        static constexpr auto Strategy = GetDispatch<T, Stream>();
+
+        template<class Stream, class T>
+        static void Invoke(Stream& stream, T& obj)
+        {
+            constexpr auto dispatch = Strategy<T, Stream>;
+            if constexpr(dispatch == Dispatch::Member)
+                obj.Deserialize(stream);
+            else if constexpr(dispatch == Dispatch::Adl)
+                Deserialize(stream, obj);
+            else if constexpr(dispatch == Dispatch::Default)
+                nc::serialize::cpo::DefaultDeserialize(stream, obj);
+            else
+                static_assert(g_alwaysFalse<T>, "Unreachable");
+        }
+
+    public:
+        template<class T>
+            requires (Strategy<T, std::istream> != Dispatch::None)
+        auto operator()(std::istream& stream, T& obj) const
+        {
+            Invoke(stream, obj);
+        }
+
+        template<class T>
+            requires (Strategy<T, BitReader> != Dispatch::None)
+        auto operator()(BitReader& reader, T& obj) const
+        {
+            Invoke(reader, obj);
+        }
+};
+
+// Satisfied for types that have a SerializedSize member function.
+template <class T>
+concept HasSerializedSizeMember = requires(const T& obj)
+{
+    { obj.SerializedSize() } -> std::convertible_to<size_t>;
+};
+
+// Satisfied for types that have a SerializedSize function in their namespace.
+template <class T>
+concept HasSerializedSizeAdl = requires(const T& obj)
+{
+    { SerializedSize(obj) } -> std::convertible_to<size_t>; // intentional ADL
+};
+
+// Satisfied for types that have a compatible SerializedSize function internally. Only applicable
+// when serialization also resolves to the internal implementation.
+template <class T>
+concept HasSerializedSizeDefault = !HasSerializeMember<T> && !HasSerializeAdl<T> && requires(const T& obj)
+{
+    { nc::serialize::binary::SerializedSize(obj) } -> std::convertible_to<size_t>;
+};
+
+// CPO for nc::serialize::SerializedSize - dispatches to a `SerializedSize()` function that is either
+// a member of T, non-member found via adl, or internal non-member depending on what is available.
+// Resolution is attempted in that order.
+struct SerializedSizeFn
 {
     private:
         template<class T>
         static consteval auto GetDispatch() -> Dispatch
         {
-            if constexpr(HasDeserializeMember<T>)
+            if constexpr(HasSerializedSizeMember<T>)
                 return Dispatch::Member;
-            else if constexpr(HasDeserializeAdl<T>)
+            else if constexpr(HasSerializedSizeAdl<T>)
                 return Dispatch::Adl;
-            else if constexpr(HasDeserializeDefault<T>)
+            else if constexpr(HasSerializedSizeDefault<T>)
                 return Dispatch::Default;
             else
                 return Dispatch::None;
@@ -118,15 +233,15 @@ struct DeserializeFn
     public:
         template<class T>
             requires (Strategy<T> != Dispatch::None)
-        auto operator()(std::istream& stream, T& obj) const
+        constexpr auto operator()(const T& obj) const -> size_t
         {
             constexpr auto dispatch = Strategy<T>;
             if constexpr(dispatch == Dispatch::Member)
-                obj.Deserialize(stream);
+                return obj.SerializedSize();
             else if constexpr(dispatch == Dispatch::Adl)
-                Deserialize(stream, obj);
+                return SerializedSize(obj);
             else if constexpr(dispatch == Dispatch::Default)
-                nc::serialize::binary::Deserialize(stream, obj);
+                return nc::serialize::binary::SerializedSize(obj);
             else
                 static_assert(g_alwaysFalse<T>, "Unreachable");
         }
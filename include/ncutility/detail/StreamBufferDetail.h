@@ -0,0 +1,84 @@
+#pragma once
+
+#include <ios>
+#include <span>
+#include <streambuf>
+#include <vector>
+
+/** @cond internal */
+namespace nc::detail
+{
+// A write-only streambuf appending to a vector, so buffers can keep their capacity between uses. Works
+// with any allocator, e.g. std::pmr::vector<char> for writing into an arena.
+template<class Vector = std::vector<char>>
+class VectorWriteBuffer : public std::streambuf
+{
+    public:
+        explicit VectorWriteBuffer(Vector& out)
+            : m_out{&out}
+        {
+        }
+
+    protected:
+        auto overflow(int_type ch) -> int_type override
+        {
+            if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                m_out->push_back(traits_type::to_char_type(ch));
+
+            return traits_type::not_eof(ch);
+        }
+
+        auto xsputn(const char_type* data, std::streamsize count) -> std::streamsize override
+        {
+            m_out->insert(m_out->end(), data, data + count);
+            return count;
+        }
+
+        auto seekoff(off_type offset, std::ios_base::seekdir dir, std::ios_base::openmode which) -> pos_type override
+        {
+            if (offset != 0 || dir == std::ios_base::beg || !(which & std::ios_base::out))
+                return pos_type(off_type(-1));
+
+            return pos_type(static_cast<off_type>(m_out->size()));
+        }
+
+    private:
+        Vector* m_out;
+};
+
+// A read-only streambuf over existing memory, supporting position queries and seeking.
+class SpanReadBuffer : public std::streambuf
+{
+    public:
+        explicit SpanReadBuffer(std::span<const char> data)
+        {
+            // The get area is never written through, the const_cast only satisfies the streambuf interface.
+            auto begin = const_cast<char*>(data.data());
+            setg(begin, begin, begin + data.size());
+        }
+
+    protected:
+        auto seekoff(off_type offset, std::ios_base::seekdir dir, std::ios_base::openmode which) -> pos_type override
+        {
+            if (!(which & std::ios_base::in))
+                return pos_type(off_type(-1));
+
+            const auto base = dir == std::ios_base::beg ? off_type{0}
+                            : dir == std::ios_base::cur ? static_cast<off_type>(gptr() - eback())
+                            : static_cast<off_type>(egptr() - eback());
+
+            return seekpos(pos_type(base + offset), which);
+        }
+
+        auto seekpos(pos_type position, std::ios_base::openmode which) -> pos_type override
+        {
+            const auto offset = static_cast<off_type>(position);
+            if (!(which & std::ios_base::in) || offset < 0 || offset > egptr() - eback())
+                return pos_type(off_type(-1));
+
+            setg(eback(), eback() + offset, egptr());
+            return position;
+        }
+};
+} // namespace nc::detail
+/** @endcond internal */
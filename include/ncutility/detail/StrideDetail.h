@@ -0,0 +1,277 @@
+#pragma once
+
+// Implementation of c++23 std::views::stride, restricted to forward ranges.
+
+#include "ChunkDetail.h"
+
+#include <iterator>
+#include <ranges>
+
+namespace nc::algo::detail {
+template<std::ranges::forward_range V>
+    requires std::ranges::view<V>
+class stride_view : public std::ranges::view_interface<stride_view<V>>
+{
+    V m_base = {};
+    std::ranges::range_difference_t<V> m_stride = 1;
+
+    template<bool Const>
+    struct iterator
+    {
+      private:
+        using Base = std::conditional_t<Const, const V, V>;
+        using base_iterator = std::ranges::iterator_t<Base>;
+
+        // m_missing is how far the last increment fell short of a full stride, so decrements from the
+        // end land on the final element.
+        base_iterator m_it = base_iterator();
+        std::ranges::sentinel_t<Base> m_end = std::ranges::sentinel_t<Base>();
+        std::ranges::range_difference_t<Base> m_stride = 0;
+        std::ranges::range_difference_t<Base> m_missing = 0;
+
+        template <bool>
+        friend struct iterator;
+
+      public:
+        using iterator_category = decltype(iter_cat<Base>());
+        using reference = std::ranges::range_reference_t<Base>;
+        using value_type = std::ranges::range_value_t<Base>;
+        using difference_type = std::ranges::range_difference_t<Base>;
+
+        iterator() = default;
+
+        constexpr iterator(base_iterator current, std::ranges::sentinel_t<Base> end, difference_type stride, difference_type missing = 0)
+            : m_it(std::move(current)),
+              m_end(std::move(end)),
+              m_stride(stride),
+              m_missing(missing)
+        {
+        }
+
+        constexpr iterator(iterator<!Const> i)
+            requires Const &&
+                     std::convertible_to<std::ranges::iterator_t<V>, base_iterator> &&
+                     std::convertible_to<std::ranges::sentinel_t<V>, std::ranges::sentinel_t<Base>>
+            : m_it(std::move(i.m_it)),
+              m_end(std::move(i.m_end)),
+              m_stride(i.m_stride),
+              m_missing(i.m_missing)
+        {
+        }
+
+        constexpr auto base() const -> base_iterator
+        {
+            return m_it;
+        }
+
+        constexpr decltype(auto) operator*() const
+        {
+            return *m_it;
+        }
+
+        constexpr auto operator++() -> iterator&
+        {
+            m_missing = std::ranges::advance(m_it, m_stride, m_end);
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> iterator
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        constexpr auto operator--() -> iterator&
+            requires std::ranges::bidirectional_range<Base>
+        {
+            std::ranges::advance(m_it, m_missing - m_stride);
+            m_missing = 0;
+            return *this;
+        }
+
+        constexpr auto operator--(int) -> iterator
+            requires std::ranges::bidirectional_range<Base>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        constexpr auto operator+=(difference_type x) -> iterator&
+            requires std::ranges::random_access_range<Base>
+        {
+            if (x > 0)
+            {
+                m_missing = std::ranges::advance(m_it, m_stride * x, m_end);
+            }
+            else if (x < 0)
+            {
+                std::ranges::advance(m_it, m_stride * x + m_missing);
+                m_missing = 0;
+            }
+
+            return *this;
+        }
+
+        constexpr auto operator-=(difference_type x) -> iterator&
+            requires std::ranges::random_access_range<Base>
+        {
+            return *this += -x;
+        }
+
+        friend constexpr auto operator+(const iterator& i, difference_type n) -> iterator
+            requires std::ranges::random_access_range<Base>
+        {
+            auto out = i;
+            return out += n;
+        }
+
+        friend constexpr auto operator+(difference_type n, const iterator& i) -> iterator
+            requires std::ranges::random_access_range<Base>
+        {
+            return i + n;
+        }
+
+        friend constexpr auto operator-(const iterator& i, difference_type n) -> iterator
+            requires std::ranges::random_access_range<Base>
+        {
+            auto out = i;
+            return out -= n;
+        }
+
+        constexpr decltype(auto) operator[](difference_type n) const
+            requires std::ranges::random_access_range<Base>
+        {
+            return *(*this + n);
+        }
+
+        friend constexpr auto operator==(const iterator& x, const iterator& y) -> bool
+        {
+            return x.m_it == y.m_it;
+        }
+
+        friend constexpr auto operator==(const iterator& x, std::default_sentinel_t) -> bool
+        {
+            return x.m_it == x.m_end;
+        }
+
+        friend constexpr auto operator<=>(const iterator& x, const iterator& y)
+            requires std::ranges::random_access_range<Base> &&
+                     std::three_way_comparable<base_iterator>
+        {
+            return x.m_it <=> y.m_it;
+        }
+
+        friend constexpr auto operator-(const iterator& x, const iterator& y) -> difference_type
+            requires std::sized_sentinel_for<base_iterator, base_iterator>
+        {
+            return (x.m_it - y.m_it + x.m_missing - y.m_missing) / x.m_stride;
+        }
+
+        friend constexpr auto operator-(std::default_sentinel_t, const iterator& x) -> difference_type
+            requires std::sized_sentinel_for<std::ranges::sentinel_t<Base>, base_iterator>
+        {
+            return div_ceil(x.m_end - x.m_it, x.m_stride);
+        }
+
+        friend constexpr auto operator-(const iterator& x, std::default_sentinel_t s) -> difference_type
+            requires std::sized_sentinel_for<std::ranges::sentinel_t<Base>, base_iterator>
+        {
+            return -(s - x);
+        }
+    };
+
+    template<bool Const>
+    constexpr auto make_end(auto& base) const
+    {
+        using Base = std::conditional_t<Const, const V, V>;
+        if constexpr (std::ranges::common_range<Base> && std::ranges::sized_range<Base>)
+        {
+            const auto missing = (m_stride - std::ranges::distance(base) % m_stride) % m_stride;
+            return iterator<Const>{std::ranges::end(base), std::ranges::end(base), m_stride, missing};
+        }
+        else if constexpr (std::ranges::common_range<Base> && !std::ranges::bidirectional_range<Base>)
+        {
+            return iterator<Const>{std::ranges::end(base), std::ranges::end(base), m_stride};
+        }
+        else
+        {
+            return std::default_sentinel;
+        }
+    }
+
+  public:
+    constexpr stride_view() = default;
+    constexpr stride_view(V base, std::ranges::range_difference_t<V> stride)
+        : m_base(std::move(base)),
+          m_stride(stride)
+    {
+    }
+
+    constexpr auto begin() requires(!simple_view<V>)
+    {
+        return iterator<false>{std::ranges::begin(m_base), std::ranges::end(m_base), m_stride};
+    }
+
+    constexpr auto begin() const requires std::ranges::forward_range<const V>
+    {
+        return iterator<true>{std::ranges::begin(m_base), std::ranges::end(m_base), m_stride};
+    }
+
+    constexpr auto end() requires(!simple_view<V>)
+    {
+        return make_end<false>(m_base);
+    }
+
+    constexpr auto end() const requires std::ranges::forward_range<const V>
+    {
+        return make_end<true>(m_base);
+    }
+
+    constexpr auto size() requires std::ranges::sized_range<V>
+    {
+        return static_cast<std::ranges::range_size_t<V>>(div_ceil(std::ranges::distance(m_base), m_stride));
+    }
+
+    constexpr auto size() const
+        requires std::ranges::sized_range<const V>
+    {
+        return static_cast<std::ranges::range_size_t<const V>>(div_ceil(std::ranges::distance(m_base), m_stride));
+    }
+
+    constexpr auto base() const & -> V
+        requires std::copyable<V>
+    {
+        return m_base;
+    }
+
+    constexpr V base() &&
+    {
+        return std::move(m_base);
+    }
+};
+
+template<class R>
+stride_view(R&&, std::ranges::range_difference_t<R>) -> stride_view<std::ranges::views::all_t<R>>;
+
+struct stride_view_closure {
+    std::ptrdiff_t stride;
+
+    template<std::ranges::forward_range R>
+    constexpr friend auto operator|(R&& rng, const stride_view_closure& closure) {
+        return stride_view{std::forward<R>(rng), static_cast<std::ranges::range_difference_t<R>>(closure.stride)};
+    }
+};
+
+struct stride_view_fn {
+    template<std::ranges::forward_range R>
+    constexpr auto operator()(R&& r, std::ranges::range_difference_t<R> stride) const {
+        return stride_view{std::forward<R>(r), stride};
+    }
+
+    constexpr auto operator()(std::ptrdiff_t stride) const {
+        return stride_view_closure{stride};
+    }
+};
+} // namespace nc::algo::detail
@@ -0,0 +1,330 @@
+#pragma once
+
+// Implementation of c++23 std::views::zip. Elements are tuples of references into each range, and the
+// view ends with its shortest range.
+
+#include "EnumerateDetail.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <utility>
+
+namespace nc::algo::detail {
+template<bool Const, class V>
+using maybe_const = std::conditional_t<Const, const V, V>;
+
+// Distance with the smallest magnitude, as zipped iterators stop at the shortest range in either direction.
+template<class Difference>
+constexpr auto nearest(std::initializer_list<Difference> distances) -> Difference
+{
+    return std::ranges::min(distances, {}, [](Difference d) { return d < 0 ? -d : d; });
+}
+
+template<std::ranges::input_range... Vs>
+    requires (std::ranges::view<Vs> && ...) && (sizeof...(Vs) > 0)
+class zip_view : public std::ranges::view_interface<zip_view<Vs...>>
+{
+    std::tuple<Vs...> m_bases = {};
+
+    template<bool Const>
+    static constexpr bool all_random_access = (std::ranges::random_access_range<maybe_const<Const, Vs>> && ...);
+
+    template<bool Const>
+    static constexpr bool all_bidirectional = (std::ranges::bidirectional_range<maybe_const<Const, Vs>> && ...);
+
+    template<bool Const>
+    static constexpr bool all_forward = (std::ranges::forward_range<maybe_const<Const, Vs>> && ...);
+
+    // Only returns common iterators from end() when they're cheap to compute and compare correctly.
+    template<bool Const>
+    static constexpr bool is_common = (sizeof...(Vs) == 1 && (std::ranges::common_range<maybe_const<Const, Vs>> && ...)) ||
+                                      (!all_bidirectional<Const> && (std::ranges::common_range<maybe_const<Const, Vs>> && ...)) ||
+                                      (all_random_access<Const> && (std::ranges::sized_range<maybe_const<Const, Vs>> && ...));
+
+    template<bool>
+    struct sentinel;
+
+    template<bool Const>
+    struct iterator
+    {
+      private:
+        using iterators = std::tuple<std::ranges::iterator_t<maybe_const<Const, Vs>>...>;
+
+        iterators m_its = iterators();
+
+        template <bool>
+        friend struct iterator;
+        friend zip_view;
+
+        template<class F>
+        constexpr void for_each(F&& f)
+        {
+            std::apply([&f](auto&... it) { (f(it), ...); }, m_its);
+        }
+
+      public:
+        using iterator_category = decltype(iter_cat<maybe_const<Const, Vs>...>());
+        using reference = std::tuple<std::ranges::range_reference_t<maybe_const<Const, Vs>>...>;
+        using value_type = std::tuple<std::ranges::range_reference_t<maybe_const<Const, Vs>>...>;
+        using difference_type = std::common_type_t<std::ranges::range_difference_t<maybe_const<Const, Vs>>...>;
+
+        iterator() = default;
+
+        constexpr explicit iterator(iterators its)
+            : m_its(std::move(its))
+        {
+        }
+
+        constexpr iterator(iterator<!Const> i)
+            requires Const &&
+                     (std::convertible_to<std::ranges::iterator_t<Vs>, std::ranges::iterator_t<const Vs>> && ...)
+            : m_its(std::move(i.m_its))
+        {
+        }
+
+        constexpr auto operator*() const
+        {
+            return std::apply([](const auto&... it) { return reference{*it...}; }, m_its);
+        }
+
+        constexpr auto operator++() -> iterator&
+        {
+            for_each([](auto& it) { ++it; });
+            return *this;
+        }
+
+        constexpr auto operator++(int)
+        {
+            if constexpr (all_forward<Const>)
+            {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            else
+            {
+                ++*this;
+            }
+        }
+
+        constexpr auto operator--() -> iterator&
+            requires all_bidirectional<Const>
+        {
+            for_each([](auto& it) { --it; });
+            return *this;
+        }
+
+        constexpr auto operator--(int) -> iterator
+            requires all_bidirectional<Const>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        constexpr auto operator+=(difference_type n) -> iterator&
+            requires all_random_access<Const>
+        {
+            for_each([n](auto& it) { it += static_cast<std::iter_difference_t<std::remove_reference_t<decltype(it)>>>(n); });
+            return *this;
+        }
+
+        constexpr auto operator-=(difference_type n) -> iterator&
+            requires all_random_access<Const>
+        {
+            for_each([n](auto& it) { it -= static_cast<std::iter_difference_t<std::remove_reference_t<decltype(it)>>>(n); });
+            return *this;
+        }
+
+        friend constexpr auto operator+(const iterator& i, difference_type n) -> iterator
+            requires all_random_access<Const>
+        {
+            auto out = i;
+            return out += n;
+        }
+
+        friend constexpr auto operator+(difference_type n, const iterator& i) -> iterator
+            requires all_random_access<Const>
+        {
+            return i + n;
+        }
+
+        friend constexpr auto operator-(const iterator& i, difference_type n) -> iterator
+            requires all_random_access<Const>
+        {
+            auto out = i;
+            return out -= n;
+        }
+
+        constexpr auto operator[](difference_type n) const
+            requires all_random_access<Const>
+        {
+            return *(*this + n);
+        }
+
+        // Bidirectional iterators all move in lockstep, otherwise the shortest range ends iteration.
+        friend constexpr auto operator==(const iterator& x, const iterator& y) -> bool
+            requires (std::equality_comparable<std::ranges::iterator_t<maybe_const<Const, Vs>>> && ...)
+        {
+            if constexpr (all_bidirectional<Const>)
+            {
+                return x.m_its == y.m_its;
+            }
+            else
+            {
+                return [&]<size_t... I>(std::index_sequence<I...>)
+                {
+                    return ((std::get<I>(x.m_its) == std::get<I>(y.m_its)) || ...);
+                }(std::index_sequence_for<Vs...>{});
+            }
+        }
+
+        friend constexpr auto operator<=>(const iterator& x, const iterator& y)
+            requires all_random_access<Const>
+        {
+            return std::get<0>(x.m_its) <=> std::get<0>(y.m_its);
+        }
+
+        friend constexpr auto operator-(const iterator& x, const iterator& y) -> difference_type
+            requires (std::sized_sentinel_for<std::ranges::iterator_t<maybe_const<Const, Vs>>,
+                                              std::ranges::iterator_t<maybe_const<Const, Vs>>> && ...)
+        {
+            return [&]<size_t... I>(std::index_sequence<I...>)
+            {
+                return nearest({static_cast<difference_type>(std::get<I>(x.m_its) - std::get<I>(y.m_its))...});
+            }(std::index_sequence_for<Vs...>{});
+        }
+
+        friend constexpr auto operator==(const iterator& x, const sentinel<Const>& y) -> bool
+        {
+            return [&]<size_t... I>(std::index_sequence<I...>)
+            {
+                return ((std::get<I>(x.m_its) == std::get<I>(y.base())) || ...);
+            }(std::index_sequence_for<Vs...>{});
+        }
+
+        friend constexpr auto operator-(const sentinel<Const>& x, const iterator& y) -> difference_type
+            requires (std::sized_sentinel_for<std::ranges::sentinel_t<maybe_const<Const, Vs>>,
+                                              std::ranges::iterator_t<maybe_const<Const, Vs>>> && ...)
+        {
+            return [&]<size_t... I>(std::index_sequence<I...>)
+            {
+                return nearest({static_cast<difference_type>(std::get<I>(x.base()) - std::get<I>(y.m_its))...});
+            }(std::index_sequence_for<Vs...>{});
+        }
+
+        friend constexpr auto operator-(const iterator& x, const sentinel<Const>& y) -> difference_type
+            requires (std::sized_sentinel_for<std::ranges::sentinel_t<maybe_const<Const, Vs>>,
+                                              std::ranges::iterator_t<maybe_const<Const, Vs>>> && ...)
+        {
+            return -(y - x);
+        }
+    };
+
+    template<bool Const>
+    struct sentinel
+    {
+      private:
+        using sentinels = std::tuple<std::ranges::sentinel_t<maybe_const<Const, Vs>>...>;
+
+        sentinels m_ends = sentinels();
+
+      public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(sentinels ends)
+            : m_ends(std::move(ends))
+        {
+        }
+
+        constexpr auto base() const -> const sentinels&
+        {
+            return m_ends;
+        }
+    };
+
+    template<bool Const>
+    constexpr auto make_begin(auto& bases) const
+    {
+        return iterator<Const>{std::apply([](auto&... base) { return std::tuple{std::ranges::begin(base)...}; }, bases)};
+    }
+
+    template<bool Const>
+    constexpr auto make_end(auto& bases) const
+    {
+        if constexpr (all_random_access<Const> && (std::ranges::sized_range<maybe_const<Const, Vs>> && ...))
+        {
+            using difference_type = typename iterator<Const>::difference_type;
+            return make_begin<Const>(bases) + static_cast<difference_type>(make_size(bases));
+        }
+        else if constexpr (is_common<Const>)
+        {
+            return iterator<Const>{std::apply([](auto&... base) { return std::tuple{std::ranges::end(base)...}; }, bases)};
+        }
+        else
+        {
+            return sentinel<Const>{std::apply([](auto&... base) { return std::tuple{std::ranges::end(base)...}; }, bases)};
+        }
+    }
+
+    static constexpr auto make_size(auto& bases)
+    {
+        return std::apply([](auto&... base)
+        {
+            using size_type = std::make_unsigned_t<std::common_type_t<decltype(std::ranges::size(base))...>>;
+            return std::ranges::min({static_cast<size_type>(std::ranges::size(base))...});
+        }, bases);
+    }
+
+  public:
+    constexpr zip_view() = default;
+    constexpr explicit zip_view(Vs... bases)
+        : m_bases(std::move(bases)...)
+    {
+    }
+
+    constexpr auto begin() requires(!(simple_view<Vs> && ...))
+    {
+        return make_begin<false>(m_bases);
+    }
+
+    constexpr auto begin() const requires (std::ranges::range<const Vs> && ...)
+    {
+        return make_begin<true>(m_bases);
+    }
+
+    constexpr auto end() requires(!(simple_view<Vs> && ...))
+    {
+        return make_end<false>(m_bases);
+    }
+
+    constexpr auto end() const requires (std::ranges::range<const Vs> && ...)
+    {
+        return make_end<true>(m_bases);
+    }
+
+    constexpr auto size() requires (std::ranges::sized_range<Vs> && ...)
+    {
+        return make_size(m_bases);
+    }
+
+    constexpr auto size() const requires (std::ranges::sized_range<const Vs> && ...)
+    {
+        return make_size(m_bases);
+    }
+};
+
+template<class... R>
+zip_view(R&&...) -> zip_view<std::ranges::views::all_t<R>...>;
+
+struct zip_view_fn {
+    template<std::ranges::input_range... R>
+        requires (sizeof...(R) > 0)
+    constexpr auto operator()(R&&... r) const {
+        return zip_view{std::forward<R>(r)...};
+    }
+};
+} // namespace nc::algo::detail
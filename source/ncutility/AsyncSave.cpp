@@ -0,0 +1,147 @@
+#include "ncutility/AsyncSave.h"
+#include "ncutility/NcError.h"
+#include "FileIo.h"
+
+#include <algorithm>
+#include <ostream>
+
+namespace
+{
+constexpr auto g_saveMagic = std::array<char, 4>{'N', 'C', 'S', 'V'};
+constexpr auto g_saveHeaderSize = g_saveMagic.size() + 2 * sizeof(uint64_t);
+} // anonymous namespace
+
+namespace nc
+{
+AsyncSaver::AsyncSaver(CompressionLevel level)
+    : m_buffers{},
+      m_busy{},
+      m_jobs{},
+      m_mutex{},
+      m_condition{},
+      m_level{level},
+      m_stopping{false},
+      m_worker{[this]() { Run(); }}
+{
+}
+
+AsyncSaver::~AsyncSaver() noexcept
+{
+    {
+        auto lock = std::lock_guard{m_mutex};
+        m_stopping = true;
+    }
+
+    m_condition.notify_all();
+    m_worker.join();
+}
+
+auto AsyncSaver::Save(const std::filesystem::path& path, const std::function<void(std::ostream&)>& write) -> std::future<void>
+{
+    auto buffer = size_t{0};
+    {
+        auto lock = std::unique_lock{m_mutex};
+        m_condition.wait(lock, [this]() { return std::ranges::find(m_busy, false) != m_busy.end(); });
+        buffer = static_cast<size_t>(std::ranges::find(m_busy, false) - m_busy.begin());
+        m_busy[buffer] = true;
+    }
+
+    auto& snapshot = m_buffers[buffer];
+    snapshot.clear();
+    try
+    {
+        auto streambuf = detail::VectorWriteBuffer{snapshot};
+        auto stream = std::ostream{&streambuf};
+        write(stream);
+        if (snapshot.size() > compressMaxInputSize)
+            throw NcError("Save data exceeds max compression input size.", fmt::format("size: {}", snapshot.size()));
+    }
+    catch (...)
+    {
+        {
+            auto lock = std::lock_guard{m_mutex};
+            m_busy[buffer] = false;
+        }
+
+        m_condition.notify_all();
+        throw;
+    }
+
+    auto job = Job{path, buffer, std::promise<void>{}};
+    auto future = job.promise.get_future();
+    {
+        auto lock = std::lock_guard{m_mutex};
+        m_jobs.push_back(std::move(job));
+    }
+
+    m_condition.notify_all();
+    return future;
+}
+
+void AsyncSaver::Wait()
+{
+    auto lock = std::unique_lock{m_mutex};
+    m_condition.wait(lock, [this]() { return std::ranges::find(m_busy, true) == m_busy.end(); });
+}
+
+void AsyncSaver::Run()
+{
+    while (true)
+    {
+        auto lock = std::unique_lock{m_mutex};
+        m_condition.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+        if (m_jobs.empty())
+            return;
+
+        auto job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        lock.unlock();
+
+        try
+        {
+            Write(job);
+            job.promise.set_value();
+        }
+        catch (...)
+        {
+            job.promise.set_exception(std::current_exception());
+        }
+
+        lock.lock();
+        m_busy[job.buffer] = false;
+        lock.unlock();
+        m_condition.notify_all();
+    }
+}
+
+void AsyncSaver::Write(const Job& job) const
+{
+    const auto& snapshot = m_buffers[job.buffer];
+    const auto compressed = Compress(snapshot, m_level);
+    detail::ReplaceFile(job.path, [&](std::ostream& file)
+    {
+        file.write(g_saveMagic.data(), static_cast<std::streamsize>(g_saveMagic.size()));
+        detail::WriteLittleEndian<uint64_t>(file, snapshot.size());
+        detail::WriteLittleEndian<uint64_t>(file, compressed.size());
+        file.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+    });
+}
+
+auto LoadSaveFile(const std::filesystem::path& path) -> std::vector<char>
+{
+    const auto contents = detail::ReadFile(path);
+    if (!contents)
+        throw NcError("Failed to open save file.", path.string());
+
+    const auto fileSize = contents->size();
+    if (fileSize < g_saveHeaderSize || !std::equal(g_saveMagic.begin(), g_saveMagic.end(), contents->begin()))
+        throw NcError("Invalid save file.", path.string());
+
+    const auto rawSize = detail::ReadLittleEndian<uint64_t>(std::span{*contents}.subspan(g_saveMagic.size()));
+    const auto compressedSize = detail::ReadLittleEndian<uint64_t>(std::span{*contents}.subspan(g_saveMagic.size() + sizeof(uint64_t)));
+    if (rawSize > compressMaxInputSize || compressedSize != fileSize - g_saveHeaderSize)
+        throw NcError("Save file header does not match its contents.", path.string());
+
+    return Decompress(std::span{*contents}.subspan(g_saveHeaderSize), static_cast<size_t>(rawSize));
+}
+} // namespace nc
@@ -4,26 +4,46 @@
 #include "lz4/lz4.h"
 #include "lz4/lz4hc.h"
 
-namespace nc
+#include <cstddef>
+
+namespace
 {
-auto Compress(std::span<const char> src, CompressionLevel level) -> std::vector<char>
+// Compress into dst, which is resized to the compressed size. The LZ4HC state is allocated from
+// stateResource rather than by LZ4 itself.
+template<class Vector>
+void CompressInto(Vector& dst, std::span<const char> src, nc::CompressionLevel level, std::pmr::memory_resource* stateResource)
 {
-    NC_ASSERT(src.size() <= compressMaxInputSize, "Compression source data exceeds max size.");
+    NC_ASSERT(src.size() <= nc::compressMaxInputSize, "Compression source data exceeds max size.");
     const auto srcSize = static_cast<int>(src.size());
     const auto dstCapacity = ::LZ4_compressBound(srcSize);
-    auto dst = std::vector<char>(static_cast<size_t>(dstCapacity), '\0');
+    dst.resize(static_cast<size_t>(dstCapacity));
+
+    const auto compressHC = [&](int compressionLevel)
+    {
+        const auto stateSize = static_cast<size_t>(::LZ4_sizeofStateHC());
+        const auto state = stateResource->allocate(stateSize, alignof(std::max_align_t));
+        const auto written = ::LZ4_compress_HC_extStateHC(state, src.data(), dst.data(), srcSize, dstCapacity, compressionLevel);
+        stateResource->deallocate(state, stateSize, alignof(std::max_align_t));
+        return written;
+    };
+
     const auto bytesWritten = [&]()
     {
+        // LZ4HC's optimal parser (used at max level) doesn't handle empty input. The encoding of empty
+        // input doesn't depend on the level, so use the fast path.
+        if (srcSize == 0)
+            return ::LZ4_compress_default(src.data(), dst.data(), srcSize, dstCapacity);
+
         switch(level)
         {
             // The mapping here is a little awkward. We're not very concerned with compression speed,
             // so we choose 'Default' to mean high compression mode and 'Fast' to mean default mode.
             case nc::CompressionLevel::Default:
-                return ::LZ4_compress_HC(src.data(), dst.data(), srcSize, dstCapacity, LZ4HC_CLEVEL_DEFAULT);
+                return compressHC(LZ4HC_CLEVEL_DEFAULT);
             case nc::CompressionLevel::Fast:
                 return ::LZ4_compress_default(src.data(), dst.data(), srcSize, dstCapacity);
             case nc::CompressionLevel::Max:
-                return ::LZ4_compress_HC(src.data(), dst.data(), srcSize, dstCapacity, LZ4HC_CLEVEL_MAX);
+                return compressHC(LZ4HC_CLEVEL_MAX);
         }
 
         throw nc::NcError{fmt::format("Unknown compression level '{}'.", static_cast<unsigned>(level))};
@@ -31,23 +51,53 @@ auto Compress(std::span<const char> src, CompressionLevel level) -> std::vector<
 
     NC_ASSERT(bytesWritten > 0, "Unexpected compression failure."); // should be impossible
     dst.resize(static_cast<size_t>(bytesWritten));
-    dst.shrink_to_fit();
-    return dst;
 }
 
-auto Decompress(std::span<const char> src, size_t maxDecompressedSize) -> std::vector<char>
+// Decompress into dst, which must hold maxDecompressedSize bytes and is resized to the decompressed size.
+template<class Vector>
+void DecompressInto(Vector& dst, std::span<const char> src)
 {
     const auto srcSize = static_cast<int>(src.size());
-    const auto dstCapacity = static_cast<int>(maxDecompressedSize);
-    auto dst = std::vector<char>(maxDecompressedSize, '\0');
+    const auto dstCapacity = static_cast<int>(dst.size());
     const auto result = ::LZ4_decompress_safe(src.data(), dst.data(), srcSize, dstCapacity);
     if (result < 0)
     {
-        throw NcError(fmt::format("Decompression failed with error '{}'", result));
+        throw nc::NcError(fmt::format("Decompression failed with error '{}'", result));
     }
 
     dst.resize(static_cast<size_t>(result)); // On success, result == numBytesRead
+}
+} // anonymous namespace
+
+namespace nc
+{
+auto Compress(std::span<const char> src, CompressionLevel level) -> std::vector<char>
+{
+    auto dst = std::vector<char>{};
+    CompressInto(dst, src, level, std::pmr::new_delete_resource());
+    dst.shrink_to_fit();
+    return dst;
+}
+
+auto Decompress(std::span<const char> src, size_t maxDecompressedSize) -> std::vector<char>
+{
+    auto dst = std::vector<char>(maxDecompressedSize, '\0');
+    DecompressInto(dst, src);
     dst.shrink_to_fit();
     return dst;
 }
+
+auto Compress(std::span<const char> src, std::pmr::memory_resource* resource, CompressionLevel level) -> std::pmr::vector<char>
+{
+    auto dst = std::pmr::vector<char>{resource};
+    CompressInto(dst, src, level, resource);
+    return dst;
+}
+
+auto Decompress(std::span<const char> src, size_t maxDecompressedSize, std::pmr::memory_resource* resource) -> std::pmr::vector<char>
+{
+    auto dst = std::pmr::vector<char>(maxDecompressedSize, '\0', resource);
+    DecompressInto(dst, src);
+    return dst;
+}
 } // namespace nc
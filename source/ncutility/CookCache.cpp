@@ -0,0 +1,122 @@
+#include "ncutility/CookCache.h"
+#include "ncutility/Hash.h"
+#include "ncutility/NcError.h"
+#include "FileIo.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+
+namespace
+{
+constexpr auto g_cookMagic = std::array<char, 4>{'N', 'C', 'C', 'K'};
+constexpr auto g_cookFormatVersion = uint32_t{1};
+constexpr auto g_cookHeaderSize = g_cookMagic.size() + 2 * sizeof(uint32_t) + 5 * sizeof(uint64_t);
+
+struct CookHeader
+{
+    uint32_t formatVersion;
+    uint32_t version;
+    uint64_t sourceHash;
+    uint64_t sourceSize;
+    uint64_t rawSize;
+    uint64_t rawHash;
+    uint64_t compressedSize;
+};
+
+auto ReadHeader(std::span<const char> bytes) -> CookHeader
+{
+    using nc::detail::ReadLittleEndian;
+    const auto fields = bytes.subspan(g_cookMagic.size());
+    return CookHeader
+    {
+        ReadLittleEndian<uint32_t>(fields.subspan(0)),
+        ReadLittleEndian<uint32_t>(fields.subspan(4)),
+        ReadLittleEndian<uint64_t>(fields.subspan(8)),
+        ReadLittleEndian<uint64_t>(fields.subspan(16)),
+        ReadLittleEndian<uint64_t>(fields.subspan(24)),
+        ReadLittleEndian<uint64_t>(fields.subspan(32)),
+        ReadLittleEndian<uint64_t>(fields.subspan(40))
+    };
+}
+} // anonymous namespace
+
+namespace nc
+{
+CookCache::CookCache(std::filesystem::path directory, uint32_t version, CompressionLevel level)
+    : m_directory{std::move(directory)},
+      m_version{version},
+      m_level{level}
+{
+    auto error = std::error_code{};
+    std::filesystem::create_directories(m_directory, error);
+    if (error)
+        throw NcError("Failed to create cook cache directory.", fmt::format("{}: {}", m_directory.string(), error.message()));
+}
+
+auto CookCache::EntryPath(std::string_view source) const -> std::filesystem::path
+{
+    return m_directory / fmt::format("{:016x}.cooked", utility::Fnv1a(source));
+}
+
+auto CookCache::Read(std::string_view source, const std::function<void(std::istream&)>& read) const -> bool
+{
+    const auto contents = detail::ReadFile(EntryPath(source));
+    if (!contents || contents->size() < g_cookHeaderSize || !std::equal(g_cookMagic.begin(), g_cookMagic.end(), contents->begin()))
+        return false;
+
+    const auto header = ReadHeader(*contents);
+    if (header.formatVersion != g_cookFormatVersion ||
+        header.version != m_version ||
+        header.sourceHash != utility::Fnv1a(source) ||
+        header.sourceSize != source.size() ||
+        header.rawSize > compressMaxInputSize ||
+        header.compressedSize != contents->size() - g_cookHeaderSize)
+    {
+        return false;
+    }
+
+    try
+    {
+        const auto raw = Decompress(std::span{*contents}.subspan(g_cookHeaderSize), static_cast<size_t>(header.rawSize));
+        if (raw.size() != header.rawSize || utility::Fnv1a(std::string_view{raw.data(), raw.size()}) != header.rawHash)
+            return false;
+
+        auto streambuf = detail::SpanReadBuffer{raw};
+        auto stream = std::istream{&streambuf};
+        read(stream);
+        return true;
+    }
+    catch (const NcError&)
+    {
+        return false;
+    }
+}
+
+void CookCache::Write(std::string_view source, const std::function<void(std::ostream&)>& write) const
+{
+    auto raw = std::vector<char>{};
+    {
+        auto streambuf = detail::VectorWriteBuffer{raw};
+        auto stream = std::ostream{&streambuf};
+        write(stream);
+    }
+
+    if (raw.size() > compressMaxInputSize)
+        throw NcError("Cooked data exceeds max compression input size.", fmt::format("size: {}", raw.size()));
+
+    const auto compressed = Compress(raw, m_level);
+    detail::ReplaceFile(EntryPath(source), [&](std::ostream& file)
+    {
+        file.write(g_cookMagic.data(), static_cast<std::streamsize>(g_cookMagic.size()));
+        detail::WriteLittleEndian(file, g_cookFormatVersion);
+        detail::WriteLittleEndian(file, m_version);
+        detail::WriteLittleEndian<uint64_t>(file, utility::Fnv1a(source));
+        detail::WriteLittleEndian<uint64_t>(file, source.size());
+        detail::WriteLittleEndian<uint64_t>(file, raw.size());
+        detail::WriteLittleEndian<uint64_t>(file, utility::Fnv1a(std::string_view{raw.data(), raw.size()}));
+        detail::WriteLittleEndian<uint64_t>(file, compressed.size());
+        file.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+    });
+}
+} // namespace nc
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "ncutility/NcError.h"
+#include "ncutility/detail/StreamBufferDetail.h"
+
+#include <concepts>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace nc::detail
+{
+template<std::unsigned_integral T>
+void WriteLittleEndian(std::ostream& stream, T value)
+{
+    char bytes[sizeof(T)];
+    for (auto i = 0u; i < sizeof(T); ++i) bytes[i] = static_cast<char>(value >> (8u * i));
+    stream.write(bytes, sizeof(bytes));
+}
+
+template<std::unsigned_integral T>
+auto ReadLittleEndian(std::span<const char> bytes) -> T
+{
+    auto value = T{0};
+    for (auto i = 0u; i < sizeof(T); ++i) value |= static_cast<T>(static_cast<T>(static_cast<unsigned char>(bytes[i])) << (8u * i));
+    return value;
+}
+
+// Read an entire file, returning an empty optional if it can't be opened or read. Opening a directory
+// may succeed and report a meaningless size, so only regular files are read.
+inline auto ReadFile(const std::filesystem::path& path) -> std::optional<std::vector<char>>
+{
+    auto error = std::error_code{};
+    if (!std::filesystem::is_regular_file(path, error))
+        return std::nullopt;
+
+    auto file = std::ifstream{path, std::ios::binary | std::ios::ate};
+    if (!file)
+        return std::nullopt;
+
+    const auto size = file.tellg();
+    if (size < 0)
+        return std::nullopt;
+
+    auto contents = std::vector<char>(static_cast<size_t>(size));
+    file.seekg(0);
+    file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+    if (!file)
+        return std::nullopt;
+
+    return contents;
+}
+
+// Write a file to a uniquely named temporary beside the destination, then rename it over the
+// destination. Renaming is atomic, so readers in this or other processes never observe a partially
+// written file, and concurrent writers each produce a complete file with the last rename winning.
+inline void ReplaceFile(const std::filesystem::path& destination, const std::function<void(std::ostream&)>& write)
+{
+    thread_local auto rng = std::mt19937_64{std::random_device{}() ^ std::hash<std::thread::id>{}(std::this_thread::get_id())};
+    auto temporary = destination;
+    temporary += fmt::format(".{:016x}.tmp", rng());
+
+    try
+    {
+        auto file = std::ofstream{temporary, std::ios::binary | std::ios::trunc};
+        if (!file)
+            throw NcError("Failed to open file for writing.", temporary.string());
+
+        write(file);
+        file.close();
+        if (!file)
+            throw NcError("Failed to write file.", temporary.string());
+
+        std::filesystem::rename(temporary, destination);
+    }
+    catch (const std::filesystem::filesystem_error& error)
+    {
+        auto ignored = std::error_code{};
+        std::filesystem::remove(temporary, ignored);
+        throw NcError("Failed to replace file.", fmt::format("{}: {}", destination.string(), error.what()));
+    }
+    catch (...)
+    {
+        auto ignored = std::error_code{};
+        std::filesystem::remove(temporary, ignored);
+        throw;
+    }
+}
+} // namespace nc::detail
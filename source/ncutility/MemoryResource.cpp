@@ -0,0 +1,316 @@
+#include "ncutility/MemoryResource.h"
+#include "ncutility/NcError.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace
+{
+struct LocalArena
+{
+    uint64_t owner = 0;
+    nc::ArenaResource* arena = nullptr;
+};
+
+// Ids are never reused, so a thread's cached arena can't be mistaken for one of a newer FrameAllocator
+// constructed at the same address.
+auto g_nextFrameAllocatorId = std::atomic<uint64_t>{1};
+thread_local auto t_frameArena = LocalArena{};
+
+constexpr auto g_maxAlign = alignof(std::max_align_t);
+
+constexpr auto RoundUp(size_t value, size_t alignment) noexcept -> size_t
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Bump cursor within [cursor, end), returning null if the allocation doesn't fit.
+auto Bump(std::byte*& cursor, std::byte* end, size_t bytes, size_t alignment) noexcept -> std::byte*
+{
+    const auto address = reinterpret_cast<uintptr_t>(cursor);
+    const auto padding = RoundUp(address, alignment) - address;
+    const auto remaining = static_cast<size_t>(end - cursor);
+    if (padding > remaining || bytes > remaining - padding)
+        return nullptr;
+
+    const auto ptr = cursor + padding;
+    cursor = ptr + bytes;
+    return ptr;
+}
+} // anonymous namespace
+
+namespace nc
+{
+struct ArenaResource::Block
+{
+    Block* next;
+    size_t size;
+
+    static constexpr auto HeaderSize = RoundUp(sizeof(Block*) + sizeof(size_t), g_maxAlign);
+
+    auto Data() noexcept -> std::byte* { return reinterpret_cast<std::byte*>(this) + HeaderSize; }
+};
+
+ArenaResource::ArenaResource(size_t initialSize, std::pmr::memory_resource* upstream) noexcept
+    : m_upstream{upstream}, m_nextBlockSize{std::max(initialSize, g_maxAlign)}
+{
+}
+
+ArenaResource::~ArenaResource() noexcept
+{
+    Release();
+}
+
+void ArenaResource::Reset()
+{
+    if (!m_head)
+        return;
+
+    // Coalesce so the next frame fits in a single block.
+    if (m_head->next)
+    {
+        const auto size = m_capacity;
+        Release();
+        PushBlock(size);
+    }
+
+    m_used = 0;
+    m_begin = nullptr;
+    Enter(m_head);
+}
+
+void ArenaResource::Release() noexcept
+{
+    for (auto block = m_head; block;)
+    {
+        const auto next = block->next;
+        m_upstream->deallocate(block, Block::HeaderSize + block->size, g_maxAlign);
+        block = next;
+    }
+
+    m_head = m_current = nullptr;
+    m_begin = m_cursor = m_end = nullptr;
+    m_used = 0;
+    m_capacity = 0;
+}
+
+auto ArenaResource::do_allocate(size_t bytes, size_t alignment) -> void*
+{
+    if (m_cursor)
+    {
+        if (const auto ptr = Bump(m_cursor, m_end, bytes, alignment))
+            return ptr;
+    }
+
+    return AllocateSlow(bytes, alignment);
+}
+
+void ArenaResource::do_deallocate(void* ptr, size_t bytes, size_t)
+{
+    // Roll back the most recent allocation, which makes stack-like use of the arena free.
+    if (m_cursor && bytes <= static_cast<size_t>(m_cursor - m_begin) && m_cursor - bytes == ptr)
+        m_cursor -= bytes;
+}
+
+auto ArenaResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+auto ArenaResource::AllocateSlow(size_t bytes, size_t alignment) -> void*
+{
+    // Blocks following the current one are left over from before a Reset() that didn't coalesce.
+    for (auto block = m_current ? m_current->next : m_head; block; block = block->next)
+    {
+        Enter(block);
+        if (const auto ptr = Bump(m_cursor, m_end, bytes, alignment))
+            return ptr;
+    }
+
+    // Block data is max aligned, so only over-aligned requests need room for padding.
+    const auto padding = alignment > g_maxAlign ? alignment : size_t{0};
+    if (bytes > std::numeric_limits<size_t>::max() - Block::HeaderSize - padding)
+        throw std::bad_alloc{};
+
+    const auto size = std::max(m_nextBlockSize, RoundUp(bytes + padding, g_maxAlign));
+    Enter(PushBlock(size));
+    m_nextBlockSize = std::max(m_nextBlockSize, size) * 2;
+    return Bump(m_cursor, m_end, bytes, alignment);
+}
+
+auto ArenaResource::PushBlock(size_t size) -> Block*
+{
+    auto block = ::new (m_upstream->allocate(Block::HeaderSize + size, g_maxAlign)) Block{nullptr, size};
+    if (!m_head)
+    {
+        m_head = block;
+    }
+    else
+    {
+        auto tail = m_current ? m_current : m_head;
+        while (tail->next)
+            tail = tail->next;
+
+        tail->next = block;
+    }
+
+    m_capacity += size;
+    return block;
+}
+
+void ArenaResource::Enter(Block* block) noexcept
+{
+    if (m_begin)
+        m_used += static_cast<size_t>(m_cursor - m_begin);
+
+    m_current = block;
+    m_begin = m_cursor = block->Data();
+    m_end = m_begin + block->size;
+}
+
+FrameAllocator::FrameAllocator(size_t initialSize, std::pmr::memory_resource* upstream)
+    : m_arenas{},
+      m_mutex{},
+      m_upstream{upstream},
+      m_initialSize{initialSize},
+      m_id{g_nextFrameAllocatorId.fetch_add(1, std::memory_order_relaxed)}
+{
+}
+
+FrameAllocator::~FrameAllocator() noexcept = default;
+
+auto FrameAllocator::Local() -> ArenaResource&
+{
+    if (t_frameArena.owner == m_id)
+        return *t_frameArena.arena;
+
+    auto lock = std::lock_guard{m_mutex};
+    auto& arena = m_arenas[std::this_thread::get_id()];
+    if (!arena)
+        arena = std::make_unique<ArenaResource>(m_initialSize, m_upstream);
+
+    t_frameArena = LocalArena{m_id, arena.get()};
+    return *arena;
+}
+
+void FrameAllocator::Reset()
+{
+    auto lock = std::lock_guard{m_mutex};
+    for (auto& [id, arena] : m_arenas)
+        arena->Reset();
+}
+
+void FrameAllocator::Release() noexcept
+{
+    auto lock = std::lock_guard{m_mutex};
+    for (auto& [id, arena] : m_arenas)
+        arena->Release();
+}
+
+auto FrameAllocator::BytesAllocated() const -> size_t
+{
+    auto lock = std::lock_guard{m_mutex};
+    auto total = size_t{0};
+    for (const auto& [id, arena] : m_arenas)
+        total += arena->BytesAllocated();
+
+    return total;
+}
+
+struct PoolResource::FreeBlock
+{
+    FreeBlock* next;
+};
+
+struct PoolResource::Chunk
+{
+    Chunk* next;
+};
+
+PoolResource::PoolResource(size_t blockSize, size_t blocksPerChunk, std::pmr::memory_resource* upstream)
+    : m_upstream{upstream},
+      m_blockSize{RoundUp(std::max(blockSize, sizeof(FreeBlock)), alignof(FreeBlock))},
+      m_blockAlignment{std::min(g_maxAlign, m_blockSize & (~m_blockSize + 1))},
+      m_blocksPerChunk{blocksPerChunk}
+{
+    if (blockSize == 0 || blocksPerChunk == 0)
+        throw NcError("Invalid PoolResource parameters.", fmt::format("blockSize: {}, blocksPerChunk: {}", blockSize, blocksPerChunk));
+
+    if (blocksPerChunk > (std::numeric_limits<size_t>::max() - ChunkHeaderSize()) / m_blockSize)
+        throw NcError("PoolResource chunk size overflows.", fmt::format("blockSize: {}, blocksPerChunk: {}", blockSize, blocksPerChunk));
+}
+
+PoolResource::~PoolResource() noexcept
+{
+    Release();
+}
+
+void PoolResource::Release() noexcept
+{
+    const auto chunkAlignment = std::max(m_blockAlignment, alignof(Chunk));
+    for (auto chunk = m_chunks; chunk;)
+    {
+        const auto next = chunk->next;
+        m_upstream->deallocate(chunk, ChunkBytes(), chunkAlignment);
+        chunk = next;
+    }
+
+    m_chunks = nullptr;
+    m_free = nullptr;
+    m_carve = m_carveEnd = nullptr;
+}
+
+auto PoolResource::do_allocate(size_t bytes, size_t alignment) -> void*
+{
+    if (!Pooled(bytes, alignment))
+        return m_upstream->allocate(bytes, alignment);
+
+    if (m_free)
+        return std::exchange(m_free, m_free->next);
+
+    // Blocks of a new chunk are handed out in order rather than threaded onto the free list up front.
+    if (m_carve == m_carveEnd)
+    {
+        const auto raw = m_upstream->allocate(ChunkBytes(), std::max(m_blockAlignment, alignof(Chunk)));
+        m_chunks = ::new (raw) Chunk{m_chunks};
+        m_carve = static_cast<std::byte*>(raw) + ChunkHeaderSize();
+        m_carveEnd = m_carve + m_blockSize * m_blocksPerChunk;
+    }
+
+    return std::exchange(m_carve, m_carve + m_blockSize);
+}
+
+void PoolResource::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+{
+    if (!Pooled(bytes, alignment))
+    {
+        m_upstream->deallocate(ptr, bytes, alignment);
+        return;
+    }
+
+    m_free = ::new (ptr) FreeBlock{m_free};
+}
+
+auto PoolResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+auto PoolResource::Pooled(size_t bytes, size_t alignment) const noexcept -> bool
+{
+    return bytes <= m_blockSize && alignment <= m_blockAlignment;
+}
+
+auto PoolResource::ChunkHeaderSize() const noexcept -> size_t
+{
+    return RoundUp(sizeof(Chunk), m_blockAlignment);
+}
+
+auto PoolResource::ChunkBytes() const noexcept -> size_t
+{
+    return ChunkHeaderSize() + m_blockSize * m_blocksPerChunk;
+}
+} // namespace nc
@@ -0,0 +1,469 @@
+#include "ncutility/TaskScheduler.h"
+
+#include <cstdint>
+
+namespace
+{
+struct WorkerContext
+{
+    const nc::TaskScheduler* scheduler = nullptr;
+    size_t index = 0;
+};
+
+constexpr auto g_notWorker = std::numeric_limits<size_t>::max();
+constexpr auto g_initialDequeCapacity = size_t{256};
+
+thread_local auto t_worker = WorkerContext{};
+thread_local auto t_stealOffset = size_t{0};
+} // anonymous namespace
+
+namespace nc
+{
+namespace detail
+{
+class Task
+{
+    public:
+        std::function<void()> fn;
+        std::exception_ptr error;
+        std::vector<Task*> continuations;
+        std::mutex mutex;
+        std::atomic<uint32_t> refCount;
+        std::atomic<size_t> pendingCount;
+        std::atomic<bool> done;
+        bool finished;
+
+        explicit Task(std::function<void()> fn_)
+            : fn{std::move(fn_)},
+              error{},
+              continuations{},
+              mutex{},
+              refCount{1},
+              pendingCount{1},
+              done{false},
+              finished{false}
+        {
+        }
+
+        void AddRef() noexcept
+        {
+            refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Release() noexcept
+        {
+            if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete this;
+        }
+
+        void SetError(std::exception_ptr e)
+        {
+            auto lock = std::lock_guard{mutex};
+            if (!error)
+                error = std::move(e);
+        }
+};
+
+// Chase-Lev work-stealing deque. The owning worker pushes and pops at the bottom, while other threads
+// steal from the top. Orderings follow Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+// Models", with the standalone fences folded into seq_cst operations. Outgrown rings are kept until
+// destruction since a concurrent thief may still be reading one.
+class WorkStealingDeque
+{
+    public:
+        WorkStealingDeque()
+            : m_top{0}, m_bottom{0}, m_ring{nullptr}, m_rings{}
+        {
+            m_rings.push_back(std::make_unique<Ring>(g_initialDequeCapacity));
+            m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+        }
+
+        void Push(Task* task)
+        {
+            const auto bottom = m_bottom.load(std::memory_order_relaxed);
+            const auto top = m_top.load(std::memory_order_acquire);
+            auto ring = m_ring.load(std::memory_order_relaxed);
+            if (bottom - top >= static_cast<std::ptrdiff_t>(ring->capacity))
+                ring = Grow(ring, top, bottom);
+
+            ring->Store(bottom, task);
+            m_bottom.store(bottom + 1, std::memory_order_release);
+        }
+
+        auto Pop() -> Task*
+        {
+            const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            const auto ring = m_ring.load(std::memory_order_relaxed);
+            m_bottom.store(bottom, std::memory_order_seq_cst);
+            auto top = m_top.load(std::memory_order_seq_cst);
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            auto task = ring->Load(bottom);
+            if (top == bottom)
+            {
+                // Last task, race thieves for it.
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    task = nullptr;
+
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return task;
+        }
+
+        auto Steal() -> Task*
+        {
+            auto top = m_top.load(std::memory_order_seq_cst);
+            const auto bottom = m_bottom.load(std::memory_order_seq_cst);
+            if (top >= bottom)
+                return nullptr;
+
+            auto task = m_ring.load(std::memory_order_acquire)->Load(top);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+
+            return task;
+        }
+
+    private:
+        struct Ring
+        {
+            size_t capacity;
+            std::unique_ptr<std::atomic<Task*>[]> slots;
+
+            explicit Ring(size_t capacity_)
+                : capacity{capacity_}, slots{std::make_unique<std::atomic<Task*>[]>(capacity_)}
+            {
+            }
+
+            auto Load(std::ptrdiff_t index) const noexcept -> Task*
+            {
+                return slots[static_cast<size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+            }
+
+            void Store(std::ptrdiff_t index, Task* task) noexcept
+            {
+                slots[static_cast<size_t>(index) & (capacity - 1)].store(task, std::memory_order_relaxed);
+            }
+        };
+
+        std::atomic<std::ptrdiff_t> m_top;
+        std::atomic<std::ptrdiff_t> m_bottom;
+        std::atomic<Ring*> m_ring;
+        std::vector<std::unique_ptr<Ring>> m_rings;
+
+        auto Grow(Ring* ring, std::ptrdiff_t top, std::ptrdiff_t bottom) -> Ring*
+        {
+            auto grown = std::make_unique<Ring>(ring->capacity * 2);
+            for (auto i = top; i < bottom; ++i)
+                grown->Store(i, ring->Load(i));
+
+            m_rings.push_back(std::move(grown));
+            ring = m_rings.back().get();
+            m_ring.store(ring, std::memory_order_release);
+            return ring;
+        }
+};
+} // namespace detail
+
+TaskHandle::TaskHandle(detail::Task* task) noexcept
+    : m_task{task}
+{
+}
+
+TaskHandle::TaskHandle(const TaskHandle& other) noexcept
+    : m_task{other.m_task}
+{
+    if (m_task)
+        m_task->AddRef();
+}
+
+TaskHandle::TaskHandle(TaskHandle&& other) noexcept
+    : m_task{std::exchange(other.m_task, nullptr)}
+{
+}
+
+auto TaskHandle::operator=(const TaskHandle& other) noexcept -> TaskHandle&
+{
+    auto copy = TaskHandle{other};
+    std::swap(m_task, copy.m_task);
+    return *this;
+}
+
+auto TaskHandle::operator=(TaskHandle&& other) noexcept -> TaskHandle&
+{
+    auto moved = TaskHandle{std::move(other)};
+    std::swap(m_task, moved.m_task);
+    return *this;
+}
+
+TaskHandle::~TaskHandle() noexcept
+{
+    if (m_task)
+        m_task->Release();
+}
+
+auto TaskHandle::IsDone() const noexcept -> bool
+{
+    return !m_task || m_task->done.load(std::memory_order_acquire);
+}
+
+auto TaskScheduler::DefaultWorkerCount() noexcept -> size_t
+{
+    return std::max(size_t{std::thread::hardware_concurrency()}, size_t{2}) - 1;
+}
+
+auto TaskScheduler::Default() -> TaskScheduler&
+{
+    static TaskScheduler scheduler{};
+    return scheduler;
+}
+
+TaskScheduler::TaskScheduler(size_t workerCount)
+    : m_queues{},
+      m_injected{},
+      m_injectedMutex{},
+      m_queuedCount{0},
+      m_sleepingCount{0},
+      m_sleepMutex{},
+      m_wake{},
+      m_stopping{false},
+      m_threads{}
+{
+    m_queues.reserve(workerCount);
+    for (auto i = size_t{0}; i < workerCount; ++i)
+        m_queues.push_back(std::make_unique<detail::WorkStealingDeque>());
+
+    m_threads.reserve(workerCount);
+    for (auto i = size_t{0}; i < workerCount; ++i)
+        m_threads.emplace_back([this, i]() { Run(i); });
+}
+
+TaskScheduler::~TaskScheduler() noexcept
+{
+    {
+        auto lock = std::lock_guard{m_sleepMutex};
+        m_stopping = true;
+    }
+
+    m_wake.notify_all();
+    for (auto& thread : m_threads)
+        thread.join();
+
+    // Without workers, tasks only run when waited on, so finish anything left over.
+    while (auto task = FindTask(g_notWorker))
+        Execute(task);
+}
+
+auto TaskScheduler::Schedule(std::function<void()> fn) -> TaskHandle
+{
+    return Schedule(std::move(fn), std::span<const TaskHandle>{});
+}
+
+auto TaskScheduler::Schedule(std::function<void()> fn, std::span<const TaskHandle> dependencies) -> TaskHandle
+{
+    // One reference for the handle, and one released once the task has run.
+    auto task = new detail::Task{std::move(fn)};
+    task->AddRef();
+    auto handle = TaskHandle{task};
+
+    for (const auto& dependency : dependencies)
+    {
+        auto dependencyTask = dependency.m_task;
+        if (!dependencyTask)
+            continue;
+
+        auto error = std::exception_ptr{};
+        {
+            auto lock = std::lock_guard{dependencyTask->mutex};
+            if (!dependencyTask->finished)
+            {
+                task->pendingCount.fetch_add(1, std::memory_order_relaxed);
+                dependencyTask->continuations.push_back(task);
+                continue;
+            }
+
+            error = dependencyTask->error;
+        }
+
+        if (error)
+            task->SetError(std::move(error));
+    }
+
+    Resolve(task);
+    return handle;
+}
+
+void TaskScheduler::Wait(const TaskHandle& handle)
+{
+    auto task = handle.m_task;
+    if (!task)
+        return;
+
+    const auto index = CurrentWorkerIndex();
+    while (!task->done.load(std::memory_order_acquire))
+    {
+        if (auto next = FindTask(index))
+        {
+            Execute(next);
+            continue;
+        }
+
+        // A steal can lose a race or a push can still be in flight, so only block once nothing is queued.
+        if (m_queuedCount.load() != 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        task->done.wait(false, std::memory_order_acquire);
+    }
+
+    if (task->error)
+        std::rethrow_exception(task->error);
+}
+
+void TaskScheduler::Run(size_t workerIndex)
+{
+    t_worker = WorkerContext{this, workerIndex};
+    t_stealOffset = workerIndex + 1;
+    while (true)
+    {
+        if (auto task = FindTask(workerIndex))
+        {
+            Execute(task);
+            continue;
+        }
+
+        auto lock = std::unique_lock{m_sleepMutex};
+        if (m_stopping && m_queuedCount.load() == 0)
+            return;
+
+        m_sleepingCount.fetch_add(1);
+        m_wake.wait(lock, [this]() { return m_stopping || m_queuedCount.load() != 0; });
+        m_sleepingCount.fetch_sub(1);
+    }
+}
+
+void TaskScheduler::Enqueue(detail::Task* task)
+{
+    // Counted before the push so sleepers can't miss it. A woken worker may briefly spin until it lands.
+    m_queuedCount.fetch_add(1);
+    if (const auto index = CurrentWorkerIndex(); index != g_notWorker)
+    {
+        m_queues[index]->Push(task);
+    }
+    else
+    {
+        auto lock = std::lock_guard{m_injectedMutex};
+        m_injected.push_back(task);
+    }
+
+    if (m_sleepingCount.load() != 0)
+    {
+        {
+            auto lock = std::lock_guard{m_sleepMutex};
+        }
+
+        m_wake.notify_one();
+    }
+}
+
+void TaskScheduler::Execute(detail::Task* task)
+{
+    if (!task->error)
+    {
+        try
+        {
+            task->fn();
+        }
+        catch (...)
+        {
+            task->error = std::current_exception();
+        }
+    }
+
+    task->fn = nullptr;
+    Complete(task);
+    task->Release();
+}
+
+void TaskScheduler::Complete(detail::Task* task)
+{
+    auto continuations = std::vector<detail::Task*>{};
+    auto error = std::exception_ptr{};
+    {
+        auto lock = std::lock_guard{task->mutex};
+        task->finished = true;
+        continuations.swap(task->continuations);
+        error = task->error;
+    }
+
+    task->done.store(true, std::memory_order_release);
+    task->done.notify_all();
+
+    for (auto continuation : continuations)
+    {
+        if (error)
+            continuation->SetError(error);
+
+        Resolve(continuation);
+    }
+}
+
+void TaskScheduler::Resolve(detail::Task* task)
+{
+    if (task->pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        Enqueue(task);
+}
+
+auto TaskScheduler::FindTask(size_t workerIndex) -> detail::Task*
+{
+    if (workerIndex != g_notWorker)
+    {
+        if (auto task = m_queues[workerIndex]->Pop())
+        {
+            m_queuedCount.fetch_sub(1);
+            return task;
+        }
+    }
+
+    {
+        auto lock = std::lock_guard{m_injectedMutex};
+        if (!m_injected.empty())
+        {
+            auto task = m_injected.front();
+            m_injected.pop_front();
+            m_queuedCount.fetch_sub(1);
+            return task;
+        }
+    }
+
+    // Rotate the first victim so thieves spread out rather than contending on one deque.
+    const auto queueCount = m_queues.size();
+    const auto offset = t_stealOffset++;
+    for (auto i = size_t{0}; i < queueCount; ++i)
+    {
+        const auto victim = (offset + i) % queueCount;
+        if (victim == workerIndex)
+            continue;
+
+        if (auto task = m_queues[victim]->Steal())
+        {
+            m_queuedCount.fetch_sub(1);
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+auto TaskScheduler::CurrentWorkerIndex() const noexcept -> size_t
+{
+    return t_worker.scheduler == this ? t_worker.index : g_notWorker;
+}
+} // namespace nc
@@ -0,0 +1,190 @@
+#include "gtest/gtest.h"
+#include "ncmath/Packing.h"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace nc;
+
+namespace
+{
+auto RandomUnitVectors(size_t count) -> std::vector<Vector3>
+{
+    auto rng = std::mt19937{42u};
+    auto dist = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+    auto out = std::vector<Vector3>{};
+    while (out.size() < count)
+    {
+        const auto v = Vector3{dist(rng), dist(rng), dist(rng)};
+        if (SquareMagnitude(v) > 0.01f)
+            out.push_back(Normalize(v));
+    }
+
+    return out;
+}
+
+auto RandomRotations(size_t count) -> std::vector<Quaternion>
+{
+    auto out = std::vector<Quaternion>{};
+    for (const auto& axis : RandomUnitVectors(count))
+    {
+        const auto angle = axis.x * 3.0f + axis.y;
+        const auto s = std::sin(angle * 0.5f);
+        out.emplace_back(axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f));
+    }
+
+    return out;
+}
+
+// Largest component difference between rotations, treating q and -q as equal.
+auto RotationError(const Quaternion& lhs, const Quaternion& rhs) -> float
+{
+    const auto sign = lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w < 0.0f ? -1.0f : 1.0f;
+    return Max(Max(std::fabs(lhs.x - sign * rhs.x), std::fabs(lhs.y - sign * rhs.y)),
+               Max(std::fabs(lhs.z - sign * rhs.z), std::fabs(lhs.w - sign * rhs.w)));
+}
+} // anonymous namespace
+
+TEST(Packing_unit_tests, PackHalf_exactValues_roundTrip)
+{
+    for (auto value : {0.0f, -0.0f, 1.0f, -2.5f, 0.099975586f, 65504.0f, -65504.0f, 6.1035156e-05f, 5.9604645e-08f})
+    {
+        EXPECT_EQ(value, UnpackHalf(PackHalf(value)));
+    }
+
+    EXPECT_EQ(0x3C00u, PackHalf(1.0f));
+    EXPECT_EQ(0xC000u, PackHalf(-2.0f));
+    EXPECT_EQ(0x0001u, PackHalf(5.9604645e-08f));
+}
+
+TEST(Packing_unit_tests, PackHalf_rounding_nearestEven)
+{
+    EXPECT_EQ(0x3C00u, PackHalf(1.0f + 0.00048828125f));        // halfway, rounds down to even
+    EXPECT_EQ(0x3C02u, PackHalf(1.0f + 3.0f * 0.00048828125f)); // halfway, rounds up to even
+    EXPECT_EQ(0x3C01u, PackHalf(1.0f + 0.0009f));
+}
+
+TEST(Packing_unit_tests, PackHalf_specialValues_preserved)
+{
+    constexpr auto infinity = std::numeric_limits<float>::infinity();
+    EXPECT_EQ(0x7C00u, PackHalf(infinity));
+    EXPECT_EQ(0xFC00u, PackHalf(-infinity));
+    EXPECT_EQ(0x7C00u, PackHalf(1.0e6f));
+    EXPECT_EQ(infinity, UnpackHalf(0x7C00u));
+    EXPECT_TRUE(std::isnan(UnpackHalf(PackHalf(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(Packing_unit_tests, PackHalf_span_matchesScalar)
+{
+    auto values = std::vector<float>{};
+    for (auto i = 0; i < 1000; ++i) values.push_back(static_cast<float>(i - 500) * 0.37f);
+
+    auto packed = std::vector<uint16_t>(values.size());
+    auto unpacked = std::vector<float>(values.size());
+    PackHalf(values, packed);
+    UnpackHalf(packed, unpacked);
+    for (auto i = 0u; i < values.size(); ++i)
+    {
+        EXPECT_EQ(PackHalf(values[i]), packed[i]);
+        EXPECT_EQ(UnpackHalf(packed[i]), unpacked[i]);
+    }
+}
+
+TEST(Packing_unit_tests, HalfVector3_span_roundTrip)
+{
+    const auto vectors = std::vector<Vector3>{Vector3{1.0f, -2.0f, 3.5f}, Vector3{0.25f, 100.0f, -0.125f}, Vector3::Zero()};
+    auto packed = std::vector<HalfVector3>(vectors.size());
+    auto unpacked = std::vector<Vector3>(vectors.size());
+    PackHalf(vectors, packed);
+    Unpack(packed, unpacked);
+    EXPECT_EQ(vectors, unpacked);
+    EXPECT_EQ(6u, sizeof(HalfVector3));
+}
+
+TEST(Packing_unit_tests, PackNormal_unitVectors_withinTolerance)
+{
+    const auto normals = RandomUnitVectors(1000);
+    auto packed = std::vector<OctahedralNormal>(normals.size());
+    auto unpacked = std::vector<Vector3>(normals.size());
+    PackNormal(normals, packed);
+    Unpack(packed, unpacked);
+    for (auto i = 0u; i < normals.size(); ++i)
+    {
+        EXPECT_NEAR(1.0f, Magnitude(unpacked[i]), 1e-5f);
+        EXPECT_LT(Distance(normals[i], unpacked[i]), 1e-4f);
+    }
+}
+
+TEST(Packing_unit_tests, PackNormal_axes_exact)
+{
+    for (const auto& axis : {Vector3::Up(), Vector3::Down(), Vector3::Left(), Vector3::Right(), Vector3::Front(), Vector3::Back()})
+    {
+        EXPECT_EQ(axis, Unpack(PackNormal(axis)));
+    }
+}
+
+TEST(Packing_unit_tests, PackQuaternion32_rotations_withinTolerance)
+{
+    const auto rotations = RandomRotations(1000);
+    auto packed = std::vector<CompactQuaternion32>(rotations.size());
+    auto unpacked = std::vector<Quaternion>(rotations.size(), Quaternion::Identity());
+    PackQuaternion32(rotations, packed);
+    Unpack(packed, unpacked);
+    for (auto i = 0u; i < rotations.size(); ++i)
+    {
+        EXPECT_LT(RotationError(rotations[i], unpacked[i]), 0.002f);
+    }
+}
+
+TEST(Packing_unit_tests, PackQuaternion48_rotations_withinTolerance)
+{
+    const auto rotations = RandomRotations(1000);
+    for (const auto& rotation : rotations)
+    {
+        EXPECT_LT(RotationError(rotation, Unpack(PackQuaternion48(rotation))), 0.00005f);
+    }
+
+    EXPECT_EQ(6u, sizeof(CompactQuaternion48));
+    EXPECT_EQ(Quaternion::Identity(), Unpack(PackQuaternion48(Quaternion::Identity())));
+    EXPECT_EQ(Quaternion::Identity(), Unpack(PackQuaternion48(Quaternion{0.0f, 0.0f, 0.0f, -1.0f})));
+}
+
+TEST(Packing_unit_tests, PackFixedPoint_inRange_withinPrecision)
+{
+    using Position = FixedPointVector3<-1000.0f, 1000.0f>;
+    const auto values = std::vector<Vector3>{Vector3{-1000.0f, 0.0f, 1000.0f}, Vector3{123.456f, -789.012f, 0.5f}};
+    auto packed = std::vector<Position>(values.size());
+    auto unpacked = std::vector<Vector3>(values.size());
+    PackFixedPoint(std::span<const Vector3>{values}, std::span<Position>{packed});
+    Unpack(std::span<const Position>{packed}, std::span<Vector3>{unpacked});
+    for (auto i = 0u; i < values.size(); ++i)
+    {
+        EXPECT_NEAR(values[i].x, unpacked[i].x, Position::Precision * 1.01f);
+        EXPECT_NEAR(values[i].y, unpacked[i].y, Position::Precision * 1.01f);
+        EXPECT_NEAR(values[i].z, unpacked[i].z, Position::Precision * 1.01f);
+    }
+}
+
+TEST(Packing_unit_tests, PackFixedPoint_outOfRange_clamps)
+{
+    const auto actual = Unpack(PackFixedPoint<0.0f, 10.0f>(Vector3{-5.0f, 5.0f, 50.0f}));
+    EXPECT_FLOAT_EQ(0.0f, actual.x);
+    EXPECT_NEAR(5.0f, actual.y, 0.0001f);
+    EXPECT_FLOAT_EQ(10.0f, actual.z);
+}
+
+TEST(Packing_unit_tests, PackFixedPoint_nan_becomesMin)
+{
+    constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+    const auto actual = Unpack(PackFixedPoint<-10.0f, 10.0f>(Vector3{nan, 5.0f, nan}));
+    EXPECT_FLOAT_EQ(-10.0f, actual.x);
+    EXPECT_NEAR(5.0f, actual.y, 0.001f);
+    EXPECT_FLOAT_EQ(-10.0f, actual.z);
+}
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
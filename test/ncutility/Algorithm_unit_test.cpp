@@ -1,8 +1,12 @@
 #include "gtest/gtest.h"
 #include "ncutility/Algorithm.h"
+#include "ncutility/Hash.h"
 
 #include <array>
 #include <functional>
+#include <list>
+#include <numeric>
+#include <random>
 #include <span>
 #include <string>
 #include <unordered_map>
@@ -93,6 +97,261 @@ TEST(AlgorithmTests, Transform_typeChangingTransformation)
     EXPECT_TRUE(std::ranges::equal(expected, actual));
 }
 
+TEST(AlgorithmTests, Transform_nonVectorRange)
+{
+    const auto input = std::array<int, 3>{2, -3, 1};
+    const auto actual = nc::algo::Transform(input, &TransformIntFunction);
+    EXPECT_TRUE(std::ranges::equal(std::vector<int>{4, -6, 2}, actual));
+}
+
+TEST(AlgorithmTests, Transform_parallel_matchesSequential)
+{
+    auto input = std::vector<int>(100000);
+    std::iota(input.begin(), input.end(), -50000);
+    const auto expected = nc::algo::Transform(input, TransformIntFunctor{});
+    const auto actual = nc::algo::Transform(nc::algo::Parallel, input, TransformIntFunctor{});
+    EXPECT_EQ(expected, actual);
+
+    const auto fineGrained = nc::algo::Transform(nc::algo::ParallelPolicy{.minChunkSize = 1}, input, TransformIntFunctor{});
+    EXPECT_EQ(expected, fineGrained);
+}
+
+TEST(AlgorithmTests, Transform_sequentialPolicy_matchesDefault)
+{
+    const auto input = std::vector<std::string>{"abc", "def", "ghi"};
+    const auto actual = nc::algo::Transform(nc::algo::Sequential, input, [](const auto& str) { return str.at(0); });
+    EXPECT_TRUE(std::ranges::equal(std::vector<char>{'a', 'd', 'g'}, actual));
+}
+
+TEST(AlgorithmTests, Transform_intoSpan_writesOutput)
+{
+    const auto input = std::vector<TestStruct>{TestStruct{1}, TestStruct{2}, TestStruct{3}};
+    auto buffer = std::array<int, 4>{0, 0, 0, 9};
+    nc::algo::Transform(input, std::span{buffer}, &TransformTestStructFunction);
+    EXPECT_TRUE(std::ranges::equal(std::array<int, 4>{1, 2, 3, 9}, buffer));
+}
+
+TEST(AlgorithmTests, Transform_inPlace_overwritesInput)
+{
+    auto data = std::vector<int>{2, -3, 1};
+    nc::algo::Transform(data, data, TransformIntFunctor{});
+    EXPECT_TRUE(std::ranges::equal(std::vector<int>{4, -6, 2}, data));
+}
+
+TEST(AlgorithmTests, Transform_parallelInPlace_overwritesInput)
+{
+    auto data = std::vector<size_t>(50000);
+    std::iota(data.begin(), data.end(), size_t{0});
+    nc::algo::Transform(nc::algo::ParallelPolicy{.minChunkSize = 64}, data, data, [](size_t x) { return x * 3; });
+    for (auto i = size_t{0}; i < data.size(); ++i)
+        ASSERT_EQ(i * 3, data[i]);
+}
+
+TEST(AlgorithmTests, Transform_parallelNonRandomAccess_fallsBackToSequential)
+{
+    const auto input = std::list<int>{1, 2, 3};
+    auto output = std::vector<int>(3);
+    nc::algo::Transform(nc::algo::Parallel, input, output, TransformIntFunctor{});
+    EXPECT_TRUE(std::ranges::equal(std::vector<int>{2, 4, 6}, output));
+}
+
+TEST(AlgorithmTests, RadixSort_unsigned_matchesStdSort)
+{
+    auto rng = std::mt19937_64{42};
+    auto input = std::vector<uint64_t>(10000);
+    std::ranges::generate(input, rng);
+    auto expected = input;
+    std::ranges::sort(expected);
+    nc::algo::RadixSort(input);
+    EXPECT_EQ(expected, input);
+}
+
+TEST(AlgorithmTests, RadixSort_signedAndSmallTypes_matchesStdSort)
+{
+    auto ints = std::vector<int32_t>{5, -3, 0, INT32_MIN, INT32_MAX, -1, 7, -3};
+    auto bytes = std::vector<int8_t>{5, -3, 0, -128, 127, -1};
+    auto shorts = std::vector<uint16_t>{500, 3, 65535, 0, 256};
+    auto expectedInts = ints;
+    auto expectedBytes = bytes;
+    auto expectedShorts = shorts;
+    std::ranges::sort(expectedInts);
+    std::ranges::sort(expectedBytes);
+    std::ranges::sort(expectedShorts);
+    nc::algo::RadixSort(ints);
+    nc::algo::RadixSort(bytes);
+    nc::algo::RadixSort(shorts);
+    EXPECT_EQ(expectedInts, ints);
+    EXPECT_EQ(expectedBytes, bytes);
+    EXPECT_EQ(expectedShorts, shorts);
+}
+
+TEST(AlgorithmTests, RadixSort_floats_ordersNegativesAndZeros)
+{
+    auto depths = std::vector<float>{1.5f, -0.0f, -2.0f, 0.0f, 100.0f, -100.0f, 0.25f, -std::numeric_limits<float>::infinity()};
+    nc::algo::RadixSort(depths);
+    EXPECT_TRUE(std::ranges::is_sorted(depths));
+    EXPECT_TRUE(std::signbit(depths[3]));
+    EXPECT_FALSE(std::signbit(depths[4]));
+
+    auto doubles = std::vector<double>{3.0, -1e300, 1e-300, -0.5};
+    nc::algo::RadixSort(doubles);
+    EXPECT_EQ((std::vector<double>{-1e300, -0.5, 1e-300, 3.0}), doubles);
+}
+
+TEST(AlgorithmTests, RadixSort_keyValuePairs_isStable)
+{
+    auto items = std::vector<std::pair<uint32_t, int>>{{3, 0}, {1, 1}, {3, 2}, {0, 3}, {1, 4}, {3, 5}};
+    auto scratch = nc::algo::RadixSortScratch<std::pair<uint32_t, int>>{};
+    nc::algo::RadixSort(items, scratch, &std::pair<uint32_t, int>::first);
+    const auto expected = std::vector<std::pair<uint32_t, int>>{{0, 3}, {1, 1}, {1, 4}, {3, 0}, {3, 2}, {3, 5}};
+    EXPECT_EQ(expected, items);
+}
+
+TEST(AlgorithmTests, RadixSort_nonDefaultConstructible_sortsByProjection)
+{
+    auto hashes = std::vector<nc::utility::StringHash>{nc::utility::StringHash{"b"}, nc::utility::StringHash{"a"}, nc::utility::StringHash{"c"}};
+    nc::algo::RadixSort(hashes, &nc::utility::StringHash::Hash);
+    EXPECT_TRUE(std::ranges::is_sorted(hashes, {}, &nc::utility::StringHash::Hash));
+}
+
+TEST(AlgorithmTests, RadixSort_parallel_matchesSequential)
+{
+    auto rng = std::mt19937{7};
+    auto dist = std::uniform_real_distribution<float>{-1000.0f, 1000.0f};
+    auto items = std::vector<std::pair<float, size_t>>(50000);
+    for (auto [index, item] : nc::algo::Enumerate(items))
+        item = {dist(rng), index};
+
+    auto expected = items;
+    std::ranges::stable_sort(expected, {}, &std::pair<float, size_t>::first);
+    auto scratch = nc::algo::RadixSortScratch<std::pair<float, size_t>>{};
+    nc::algo::RadixSort(nc::algo::ParallelPolicy{.minChunkSize = 1024}, items, scratch, &std::pair<float, size_t>::first);
+    EXPECT_EQ(expected, items);
+
+    // Reused scratch with smaller input
+    items.resize(3000);
+    expected = items;
+    std::ranges::reverse(items);
+    std::ranges::stable_sort(expected, {}, &std::pair<float, size_t>::first);
+    nc::algo::RadixSort(nc::algo::ParallelPolicy{.minChunkSize = 512}, items, scratch, &std::pair<float, size_t>::first);
+    EXPECT_TRUE(std::ranges::is_sorted(items, {}, &std::pair<float, size_t>::first));
+}
+
+TEST(AlgorithmTests, RadixSort_emptyAndSingle_noop)
+{
+    auto empty = std::vector<uint32_t>{};
+    auto single = std::array<uint32_t, 1>{5};
+    nc::algo::RadixSort(empty);
+    nc::algo::RadixSort(nc::algo::Parallel, single);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(5u, single[0]);
+}
+
+TEST(AlgorithmTests, Reduce_sequentialAndParallel_matchAccumulate)
+{
+    auto input = std::vector<uint32_t>(100'003);
+    std::iota(input.begin(), input.end(), 1u);
+    const auto expected = std::accumulate(input.cbegin(), input.cend(), uint64_t{7});
+    EXPECT_EQ(expected, nc::algo::Reduce(input, uint64_t{7}));
+    EXPECT_EQ(expected, nc::algo::Reduce(nc::algo::Sequential, input, uint64_t{7}));
+    EXPECT_EQ(expected, nc::algo::Reduce(nc::algo::ParallelPolicy{.minChunkSize = 1000}, input, uint64_t{7}));
+    EXPECT_EQ(100'003u, nc::algo::Reduce(nc::algo::Parallel, input, 0u, [](uint32_t a, uint32_t b) { return std::max(a, b); }));
+}
+
+TEST(AlgorithmTests, Reduce_shortAndEmptyInputs_returnExpected)
+{
+    const auto empty = std::vector<float>{};
+    EXPECT_EQ(1.5f, nc::algo::Reduce(empty, 1.5f));
+    for (auto size = 1; size < 40; ++size)
+    {
+        auto input = std::vector<int>(static_cast<size_t>(size));
+        std::iota(input.begin(), input.end(), 0);
+        EXPECT_EQ(size * (size - 1) / 2, nc::algo::Reduce(input, 0));
+        EXPECT_EQ(size * (size - 1) / 2, nc::algo::Reduce(nc::algo::ParallelPolicy{.minChunkSize = 1}, input, 0));
+    }
+}
+
+TEST(AlgorithmTests, InclusiveScan_matchesStdInclusiveScan)
+{
+    auto input = std::vector<int>(50'001);
+    std::iota(input.begin(), input.end(), -100);
+    auto expected = std::vector<int>(input.size());
+    std::inclusive_scan(input.cbegin(), input.cend(), expected.begin());
+
+    auto sequential = std::vector<int>(input.size());
+    nc::algo::InclusiveScan(input, sequential);
+    EXPECT_EQ(expected, sequential);
+
+    auto parallel = std::vector<int>(input.size());
+    nc::algo::InclusiveScan(nc::algo::ParallelPolicy{.minChunkSize = 1000}, input, parallel);
+    EXPECT_EQ(expected, parallel);
+}
+
+TEST(AlgorithmTests, InclusiveScan_parallelInPlace_overwritesInput)
+{
+    auto values = std::vector<uint32_t>(9'999, 3u);
+    nc::algo::InclusiveScan(nc::algo::ParallelPolicy{.minChunkSize = 100}, values, values);
+    EXPECT_EQ(3u, values.front());
+    EXPECT_EQ(29'997u, values.back());
+    EXPECT_TRUE(std::ranges::is_sorted(values));
+}
+
+TEST(AlgorithmTests, ExclusiveScan_countsToOffsets_returnsTotal)
+{
+    const auto counts = std::array<uint32_t, 5>{3, 0, 2, 5, 1};
+    auto offsets = std::array<uint32_t, 5>{};
+    EXPECT_EQ(11u, nc::algo::ExclusiveScan(counts, offsets, 0u));
+    EXPECT_EQ((std::array<uint32_t, 5>{0, 3, 3, 5, 10}), offsets);
+
+    auto empty = std::vector<uint32_t>{};
+    EXPECT_EQ(4u, nc::algo::ExclusiveScan(empty, empty, 4u));
+}
+
+TEST(AlgorithmTests, ExclusiveScan_parallel_matchesSequential)
+{
+    auto rng = std::mt19937{5};
+    auto dist = std::uniform_int_distribution<uint32_t>{0, 16};
+    auto input = std::vector<uint32_t>(77'777);
+    std::ranges::generate(input, [&]() { return dist(rng); });
+    auto expected = std::vector<uint64_t>(input.size());
+    const auto expectedTotal = nc::algo::ExclusiveScan(input, expected, uint64_t{10});
+
+    auto parallel = std::vector<uint64_t>(input.size());
+    EXPECT_EQ(expectedTotal, nc::algo::ExclusiveScan(nc::algo::ParallelPolicy{.minChunkSize = 1000}, input, parallel, uint64_t{10}));
+    EXPECT_EQ(expected, parallel);
+
+    EXPECT_EQ(expectedTotal, nc::algo::ExclusiveScan(nc::algo::ParallelPolicy{.minChunkSize = 1000}, input, input, uint32_t{10}));
+    EXPECT_TRUE(std::ranges::equal(expected, input));
+}
+
+TEST(AlgorithmTests, CopyIf_compactsInOrder)
+{
+    auto input = std::vector<int>(40'000);
+    std::iota(input.begin(), input.end(), 0);
+    const auto isVisible = [](int i) { return i % 3 == 0 || i % 7 == 0; };
+    auto expected = std::vector<int>{};
+    std::ranges::copy_if(input, std::back_inserter(expected), isVisible);
+
+    auto sequential = std::vector<int>(input.size());
+    sequential.resize(nc::algo::CopyIf(input, sequential, isVisible));
+    EXPECT_EQ(expected, sequential);
+
+    auto parallel = std::vector<int>(input.size());
+    parallel.resize(nc::algo::CopyIf(nc::algo::ParallelPolicy{.minChunkSize = 500}, input, parallel, isVisible));
+    EXPECT_EQ(expected, parallel);
+
+    input.resize(nc::algo::CopyIf(input, input, isVisible));
+    EXPECT_EQ(expected, input);
+}
+
+TEST(AlgorithmTests, CopyIf_noneSelected_writesNothing)
+{
+    const auto input = std::vector<int>(5'000, 1);
+    auto output = std::vector<int>(input.size(), -1);
+    EXPECT_EQ(0u, nc::algo::CopyIf(nc::algo::ParallelPolicy{.minChunkSize = 100}, input, output, [](int i) { return i > 1; }));
+    EXPECT_EQ(-1, output.front());
+}
+
 TEST(AlgorithmTests, Enumerate_standardContainers_returnsCorrectIndices)
 {
     for (auto [index, value] : nc::algo::Enumerate(std::vector<int>{0, 1, 2}))
@@ -131,6 +390,36 @@ TEST(AlgorithmTests, Enumerate_nonConstRange_canModifyValues)
     EXPECT_TRUE(std::ranges::equal(input, std::array<int, 3>{3, 3, 3}));
 }
 
+TEST(AlgorithmTests, Enumerate_contiguousRange_usesIndexedView)
+{
+    auto input = std::vector<float>{1.0f, 2.0f, 3.0f};
+    auto view = nc::algo::Enumerate(input);
+    static_assert(std::ranges::random_access_range<decltype(view)>);
+    static_assert(std::ranges::common_range<decltype(view)>);
+    static_assert(std::is_trivially_copyable_v<std::ranges::iterator_t<decltype(view)>>);
+    static_assert(sizeof(std::ranges::iterator_t<decltype(view)>) == sizeof(float*) + sizeof(size_t));
+    EXPECT_EQ(3u, view.size());
+
+    for (auto [index, value] : view)
+        value *= static_cast<float>(index);
+
+    EXPECT_TRUE(std::ranges::equal(std::vector<float>{0.0f, 2.0f, 6.0f}, input));
+
+    const auto [lastIndex, lastValue] = view[2];
+    EXPECT_EQ(2u, lastIndex);
+    EXPECT_EQ(6.0f, lastValue);
+    EXPECT_EQ(2u, (*std::ranges::prev(view.end())).index);
+}
+
+TEST(AlgorithmTests, Enumerate_contiguousTemporary_ownsRange)
+{
+    auto expected = size_t{0};
+    for (auto [index, value] : nc::algo::Enumerate(std::vector<size_t>{0, 1, 2}))
+        EXPECT_EQ(expected++, value);
+
+    EXPECT_EQ(3u, expected);
+}
+
 // TODO: This test seems to have issues due to experimental ranges support in clang
 // TEST(AlgorithmTests, Enumerate_composes)
 // {
@@ -142,3 +431,111 @@ TEST(AlgorithmTests, Enumerate_nonConstRange_canModifyValues)
 //         EXPECT_EQ(value, 2);
 //     }
 // }
+
+TEST(AlgorithmTests, Chunk_vector_yieldsFullChunksAndRemainder)
+{
+    const auto input = std::vector<int>{0, 1, 2, 3, 4, 5, 6};
+    auto chunks = nc::algo::Chunk(input, 3);
+    static_assert(std::ranges::random_access_range<decltype(chunks)>);
+    static_assert(std::ranges::contiguous_range<std::ranges::range_reference_t<decltype(chunks)>>);
+    ASSERT_EQ(3u, chunks.size());
+    EXPECT_TRUE(std::ranges::equal(std::array{0, 1, 2}, chunks[0]));
+    EXPECT_TRUE(std::ranges::equal(std::array{3, 4, 5}, chunks[1]));
+    EXPECT_TRUE(std::ranges::equal(std::array{6}, chunks[2]));
+    EXPECT_TRUE(std::ranges::equal(std::array{6}, *std::ranges::prev(chunks.end())));
+    EXPECT_EQ(3, std::ranges::end(chunks) - std::ranges::begin(chunks));
+}
+
+TEST(AlgorithmTests, Chunk_pipe_canModifyValues)
+{
+    auto input = std::vector<int>(10, 1);
+    for (auto chunk : input | nc::algo::Chunk(4))
+    {
+        for (auto& value : chunk) value = static_cast<int>(chunk.size());
+    }
+
+    EXPECT_TRUE(std::ranges::equal(std::vector<int>{4, 4, 4, 4, 4, 4, 4, 4, 2, 2}, input));
+}
+
+TEST(AlgorithmTests, Chunk_forwardRange_preservesCategory)
+{
+    const auto input = std::list<int>{1, 2, 3, 4, 5};
+    auto chunks = nc::algo::Chunk(input, 2);
+    static_assert(std::ranges::bidirectional_range<decltype(chunks)>);
+    static_assert(!std::ranges::random_access_range<decltype(chunks)>);
+    auto sums = std::vector<int>{};
+    for (auto chunk : chunks) sums.push_back(std::accumulate(chunk.begin(), chunk.end(), 0));
+    EXPECT_EQ((std::vector<int>{3, 7, 5}), sums);
+}
+
+TEST(AlgorithmTests, Stride_vector_visitsEveryNth)
+{
+    const auto input = std::vector<int>{0, 1, 2, 3, 4, 5, 6};
+    auto strided = nc::algo::Stride(input, 3);
+    static_assert(std::ranges::random_access_range<decltype(strided)>);
+    EXPECT_EQ(3u, strided.size());
+    EXPECT_TRUE(std::ranges::equal(std::array{0, 3, 6}, strided));
+    EXPECT_TRUE(std::ranges::equal(std::array{6, 3, 0}, strided | std::views::reverse));
+    EXPECT_EQ(3, strided[1]);
+}
+
+TEST(AlgorithmTests, Stride_pipe_interleavedComponents)
+{
+    const auto xyz = std::array{1, 2, 3, 4, 5, 6};
+    EXPECT_TRUE(std::ranges::equal(std::array{2, 5}, xyz | std::views::drop(1) | nc::algo::Stride(3)));
+}
+
+TEST(AlgorithmTests, Zip_columns_iteratesInLockstep)
+{
+    auto positions = std::vector<float>{1.0f, 2.0f, 3.0f};
+    const auto velocities = std::array<float, 4>{0.5f, 0.5f, 1.0f, 9.0f};
+    auto zipped = nc::algo::Zip(positions, velocities);
+    static_assert(std::ranges::random_access_range<decltype(zipped)>);
+    static_assert(std::ranges::common_range<decltype(zipped)>);
+    EXPECT_EQ(3u, zipped.size());
+
+    for (auto [position, velocity] : zipped)
+        position += velocity;
+
+    EXPECT_EQ((std::vector<float>{1.5f, 2.5f, 4.0f}), positions);
+}
+
+TEST(AlgorithmTests, Zip_mixedCategories_endsWithShortest)
+{
+    const auto names = std::list<std::string>{"a", "b", "c"};
+    const auto ids = std::vector<int>{0, 1};
+    auto zipped = nc::algo::Zip(ids, names);
+    static_assert(std::ranges::bidirectional_range<decltype(zipped)>);
+    auto count = 0;
+    for (auto [id, name] : zipped)
+    {
+        EXPECT_EQ(count++, id);
+        EXPECT_EQ(names.front().size(), name.size());
+    }
+
+    EXPECT_EQ(2, count);
+}
+
+TEST(AlgorithmTests, Adjacent_pairs_yieldsWindows)
+{
+    const auto input = std::vector<int>{1, 2, 4, 7};
+    auto pairs = input | nc::algo::Adjacent<2>;
+    static_assert(std::ranges::random_access_range<decltype(pairs)>);
+    EXPECT_EQ(3u, pairs.size());
+    auto deltas = std::vector<int>{};
+    for (auto [a, b] : pairs) deltas.push_back(b - a);
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), deltas);
+
+    const auto [x, y, z] = *std::ranges::prev(nc::algo::Adjacent<3>(input).end());
+    EXPECT_EQ(2, x);
+    EXPECT_EQ(4, y);
+    EXPECT_EQ(7, z);
+}
+
+TEST(AlgorithmTests, Adjacent_shortRange_isEmpty)
+{
+    const auto input = std::vector<int>{1, 2};
+    EXPECT_TRUE(nc::algo::Adjacent<3>(input).empty());
+    EXPECT_EQ(0u, nc::algo::Adjacent<3>(input).size());
+    EXPECT_EQ(0, std::ranges::distance(nc::algo::Adjacent<3>(std::list<int>{1, 2})));
+}
@@ -0,0 +1,134 @@
+#include "gtest/gtest.h"
+#include "ncutility/AsyncSave.h"
+#include "ncutility/NcError.h"
+
+#include <fstream>
+#include <ostream>
+#include <string>
+
+namespace
+{
+class AsyncSaveTest : public ::testing::Test
+{
+    protected:
+        std::filesystem::path directory;
+
+        void SetUp() override
+        {
+            directory = std::filesystem::temp_directory_path() / "nc_async_save_test";
+            std::filesystem::remove_all(directory);
+            std::filesystem::create_directories(directory);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all(directory);
+        }
+};
+
+auto ToString(const std::vector<char>& bytes) -> std::string
+{
+    return std::string{bytes.begin(), bytes.end()};
+}
+
+auto MakeData(size_t size, char seed) -> std::string
+{
+    auto data = std::string(size, '\0');
+    for (auto i = 0u; i < size; ++i) data[i] = static_cast<char>(seed + static_cast<char>(i % 13));
+    return data;
+}
+} // anonymous namespace
+
+TEST_F(AsyncSaveTest, Save_roundTrip_preservesData)
+{
+    const auto path = directory / "save.bin";
+    const auto expected = MakeData(100000, 'a');
+    auto saver = nc::AsyncSaver{};
+    auto future = saver.Save(path, [&expected](std::ostream& stream) { stream << expected; });
+    future.get();
+
+    EXPECT_EQ(expected, ToString(nc::LoadSaveFile(path)));
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+}
+
+TEST_F(AsyncSaveTest, Save_emptySnapshot_roundTrips)
+{
+    const auto path = directory / "empty.bin";
+    auto saver = nc::AsyncSaver{nc::CompressionLevel::Max};
+    saver.Save(path, [](std::ostream&) {}).get();
+    EXPECT_TRUE(nc::LoadSaveFile(path).empty());
+}
+
+TEST_F(AsyncSaveTest, Save_manySaves_writtenInOrder)
+{
+    const auto path = directory / "save.bin";
+    auto futures = std::vector<std::future<void>>{};
+    auto saver = nc::AsyncSaver{};
+    for (auto i = 0; i < 8; ++i)
+    {
+        const auto data = MakeData(50000, static_cast<char>('a' + i));
+        futures.push_back(saver.Save(path, [&data](std::ostream& stream) { stream << data; }));
+    }
+
+    for (auto& future : futures) future.get();
+    EXPECT_EQ(MakeData(50000, 'h'), ToString(nc::LoadSaveFile(path)));
+}
+
+TEST_F(AsyncSaveTest, Save_separateFiles_allWritten)
+{
+    auto saver = nc::AsyncSaver{};
+    for (auto i = 0; i < 4; ++i)
+    {
+        const auto data = std::to_string(i);
+        saver.Save(directory / data, [&data](std::ostream& stream) { stream << data; });
+    }
+
+    saver.Wait();
+    for (auto i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(std::to_string(i), ToString(nc::LoadSaveFile(directory / std::to_string(i))));
+    }
+}
+
+TEST_F(AsyncSaveTest, Save_destructor_flushesPendingSaves)
+{
+    const auto path = directory / "save.bin";
+    const auto expected = MakeData(10000, 'x');
+    {
+        auto saver = nc::AsyncSaver{};
+        saver.Save(path, [&expected](std::ostream& stream) { stream << expected; });
+    }
+
+    EXPECT_EQ(expected, ToString(nc::LoadSaveFile(path)));
+}
+
+TEST_F(AsyncSaveTest, Save_writeThrows_propagatesAndReleasesBuffer)
+{
+    auto saver = nc::AsyncSaver{};
+    for (auto i = 0u; i < nc::AsyncSaver::BufferCount + 1; ++i)
+    {
+        EXPECT_THROW(saver.Save(directory / "save.bin", [](std::ostream&) { throw nc::NcError("snapshot failed"); }), nc::NcError);
+    }
+
+    saver.Save(directory / "save.bin", [](std::ostream& stream) { stream << "ok"; }).get();
+    EXPECT_EQ("ok", ToString(nc::LoadSaveFile(directory / "save.bin")));
+}
+
+TEST_F(AsyncSaveTest, Save_invalidPath_futureThrows)
+{
+    auto saver = nc::AsyncSaver{};
+    auto future = saver.Save(directory / "missing" / "save.bin", [](std::ostream& stream) { stream << "data"; });
+    EXPECT_THROW(future.get(), nc::NcError);
+}
+
+TEST_F(AsyncSaveTest, LoadSaveFile_invalidFile_throws)
+{
+    const auto path = directory / "invalid.bin";
+    {
+        auto file = std::ofstream{path, std::ios::binary};
+        file << "NCSV not a valid header";
+    }
+
+    EXPECT_THROW(nc::LoadSaveFile(path), nc::NcError);
+    EXPECT_THROW(nc::LoadSaveFile(directory / "missing.bin"), nc::NcError);
+}
@@ -1,8 +1,16 @@
 #include "gtest/gtest.h"
+#include "ncmath/Vector.h"
 #include "ncutility/BinarySerialization.h"
 
 #include <algorithm>
+#include <deque>
+#include <map>
+#include <memory_resource>
+#include <set>
 #include <sstream>
+#include <tuple>
+#include <unordered_set>
+#include <variant>
 
 namespace test
 {
@@ -51,23 +59,48 @@ struct BigAggregate
 
     std::string m17;
 
+    int m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32,
+        m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47,
+        m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62,
+        m63, m64, m65;
+
+    auto Members() const
+    {
+        return std::tie(
+            m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18,
+            m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35,
+            m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52,
+            m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, m65
+        );
+    }
+
+    auto Members()
+    {
+        return std::tie(
+            m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18,
+            m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35,
+            m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52,
+            m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, m65
+        );
+    }
+
     auto operator<=>(const BigAggregate&) const = default;
 };
 
 void Serialize(std::ostream& stream, const test::BigAggregate& in)
 {
-    nc::serialize::binary::SerializeMultiple(
-        stream, in.m1, in.m2, in.m3, in.m4, in.m5, in.m6, in.m7, in.m8,
-        in.m9, in.m10, in.m11, in.m12, in.m13, in.m14, in.m15, in.m16, in.m17
-    );
+    std::apply([&stream](const auto&... members)
+    {
+        nc::serialize::binary::SerializeMultiple(stream, members...);
+    }, in.Members());
 }
 
 void Deserialize(std::istream& stream, test::BigAggregate& in)
 {
-    nc::serialize::binary::DeserializeMultiple(
-        stream, in.m1, in.m2, in.m3, in.m4, in.m5, in.m6, in.m7, in.m8,
-        in.m9, in.m10, in.m11, in.m12, in.m13, in.m14, in.m15, in.m16, in.m17
-    );
+    std::apply([&stream](auto&... members)
+    {
+        nc::serialize::binary::DeserializeMultiple(stream, members...);
+    }, in.Members());
 }
 
 static_assert(std::is_aggregate_v<BigAggregate>);
@@ -76,6 +109,23 @@ static_assert(nc::serialize::binary::MemberCount<BigAggregate>() > nc::serialize
 static_assert(nc::serialize::cpo::HasSerializeAdl<BigAggregate>);
 static_assert(nc::serialize::cpo::HasDeserializeAdl<BigAggregate>);
 
+// Type with the maximum number of members supported by aggregate unpacking.
+struct WideAggregate
+{
+    std::string m1;
+    int m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18,
+        m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33,
+        m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48,
+        m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63,
+        m64;
+
+    auto operator<=>(const WideAggregate&) const = default;
+};
+
+static_assert(nc::serialize::binary::MemberCount<WideAggregate>() == nc::serialize::g_aggregateMaxMemberCount);
+static_assert(nc::serialize::cpo::HasSerializeDefault<WideAggregate>);
+static_assert(nc::serialize::cpo::HasDeserializeDefault<WideAggregate>);
+
 // Type which can't be memcpy'd or unpacked - requies user-provided overload for serialization.
 class NonAggregate
 {
@@ -288,3 +338,873 @@ TEST(BinarySerializationTest, Serialize_memberFunc_preservedRoundTrip)
     EXPECT_TRUE(expected.invokedSerialize); // expect went through member func, not default serialization
     EXPECT_TRUE(actual.invokedDeserialize);
 }
+
+TEST(BinarySerializationTest, Deserialize_nonEmptyVector_replacesContents)
+{
+    auto stream = std::stringstream{};
+    const auto expectedTrivial = std::vector<int>{1, 2, 3};
+    const auto expectedNonTrivial = std::vector<std::string>{"one", "two"};
+    auto actualTrivial = std::vector<int>{7, 8, 9, 10};
+    auto actualNonTrivial = std::vector<std::string>{"a", "b", "c"};
+    nc::serialize::Serialize(stream, expectedTrivial);
+    nc::serialize::Serialize(stream, expectedNonTrivial);
+    nc::serialize::Deserialize(stream, actualTrivial);
+    nc::serialize::Deserialize(stream, actualNonTrivial);
+    EXPECT_EQ(expectedTrivial, actualTrivial);
+    EXPECT_EQ(expectedNonTrivial, actualNonTrivial);
+}
+
+TEST(BinarySerializationTest, Deserialize_repeatedIntoSameObject_reusesStorage)
+{
+    auto stream = std::stringstream{};
+    const auto expected = std::vector<std::string>{std::string(64, 'a'), std::string(64, 'b')};
+    auto actual = std::vector<std::string>{std::string(64, 'x'), std::string(64, 'y')};
+    const auto* elementStorage = actual.data();
+    const auto* stringStorage = actual.back().data();
+    nc::serialize::Serialize(stream, expected);
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(elementStorage, actual.data());
+    EXPECT_EQ(stringStorage, actual.back().data());
+}
+
+TEST(BinarySerializationTest, Deserialize_nonEmptyMap_replacesContents)
+{
+    auto stream = std::stringstream{};
+    const auto smaller = std::unordered_map<std::string, std::string>{{"a", "1"}, {"b", "2"}};
+    const auto larger = std::unordered_map<std::string, std::string>{{"c", "3"}, {"d", "4"}, {"e", "5"}};
+    auto actual = std::unordered_map<std::string, std::string>{{"x", "0"}, {"y", "0"}, {"z", "0"}};
+    nc::serialize::Serialize(stream, smaller);
+    nc::serialize::Serialize(stream, larger);
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(smaller, actual);
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(larger, actual);
+}
+
+TEST(BinarySerializationTest, Deserialize_engagedOptional_reusesValue)
+{
+    auto stream = std::stringstream{};
+    const auto expected = std::optional<std::vector<int>>{std::vector<int>{1, 2}};
+    auto actual = std::optional<std::vector<int>>{std::vector<int>{5, 6, 7, 8}};
+    const auto* storage = actual->data();
+    nc::serialize::Serialize(stream, expected);
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(storage, actual->data());
+}
+
+namespace test
+{
+struct FixedAggregate
+{
+    std::pair<char, int> m1;
+    std::array<short, 3> m2;
+    Aggregate::SingleMember m3;
+};
+
+struct HasSizeMemberFunc
+{
+    int value = 0;
+
+    void Serialize(std::ostream& stream) const { nc::serialize::binary::Serialize(stream, value); }
+    void Deserialize(std::istream& stream) { nc::serialize::binary::Deserialize(stream, value); }
+    auto SerializedSize() const -> size_t { return sizeof(value); }
+};
+
+auto SerializedSize(const test::BigAggregate& in) -> size_t
+{
+    return std::apply([](const auto&... members)
+    {
+        return nc::serialize::binary::SerializedSizeMultiple(members...);
+    }, in.Members());
+}
+
+template<class T>
+auto SerializedBytes(const T& obj) -> size_t
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, obj);
+    return stream.str().size();
+}
+
+static_assert(nc::serialize::FixedSerializedSize<int>() == sizeof(int));
+static_assert(nc::serialize::FixedSerializedSize<std::pair<char, int>>() == sizeof(char) + sizeof(int));
+static_assert(nc::serialize::FixedSerializedSize<std::array<short, 3>>() == sizeof(size_t) + 3 * sizeof(short));
+static_assert(nc::serialize::FixedSerializedSize<FixedAggregate>() == 5 + sizeof(size_t) + 6 + sizeof(int));
+static_assert(!nc::serialize::binary::FixedSize<std::string>);
+static_assert(!nc::serialize::binary::FixedSize<std::optional<int>>);
+static_assert(!nc::serialize::binary::FixedSize<Aggregate>);
+static_assert(nc::serialize::SerializedSize(std::array<int, 4>{}) == sizeof(size_t) + 4 * sizeof(int));
+static_assert(std::invocable<nc::serialize::cpo::SerializedSizeFn, HasSizeMemberFunc>);
+static_assert(!std::invocable<nc::serialize::cpo::SerializedSizeFn, HasMemberFunc>);
+static_assert(!std::invocable<nc::serialize::cpo::SerializedSizeFn, NonAggregate>);
+} // namespace test
+
+TEST(BinarySerializationTest, SerializedSize_matchesSerializedBytes)
+{
+    const auto aggregate = test::Aggregate{42, {59, "sample"}, { {{1}, {2}, {3}} }, 4, 5, 6, 7, 8, 9, 10};
+    const auto fixedAggregates = std::vector<test::FixedAggregate>(5);
+    const auto optionalArrays = std::vector<std::optional<std::array<int, 2>>>{std::array<int, 2>{1, 2}, std::nullopt};
+    const auto map = std::unordered_map<std::string, std::vector<int>>{{"a", {1, 2}}, {"bcd", {}}};
+    const auto big = test::BigAggregate{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, "test"};
+    const auto hasSizeMember = test::HasSizeMemberFunc{7};
+
+    EXPECT_EQ(test::SerializedBytes(aggregate), nc::serialize::SerializedSize(aggregate));
+    EXPECT_EQ(test::SerializedBytes(fixedAggregates), nc::serialize::SerializedSize(fixedAggregates));
+    EXPECT_EQ(test::SerializedBytes(optionalArrays), nc::serialize::SerializedSize(optionalArrays));
+    EXPECT_EQ(test::SerializedBytes(map), nc::serialize::SerializedSize(map));
+    EXPECT_EQ(test::SerializedBytes(std::string{"a test string"}), nc::serialize::SerializedSize(std::string{"a test string"}));
+    EXPECT_EQ(test::SerializedBytes(big), nc::serialize::SerializedSize(big));
+    EXPECT_EQ(test::SerializedBytes(hasSizeMember), nc::serialize::SerializedSize(hasSizeMember));
+}
+
+namespace test
+{
+struct Particle
+{
+    float position;
+    int id;
+    char flags;
+    auto operator<=>(const Particle&) const = default;
+};
+
+static_assert(std::is_trivially_copyable_v<Particle>);
+static_assert(nc::serialize::binary::ColumnarAggregate<Particle>);
+static_assert(nc::serialize::binary::ColumnarAggregate<Aggregate>);
+} // namespace test
+
+TEST(BinarySerializationTest, SerializeColumnar_trivialAggregate_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    auto expected = std::vector<test::Particle>{};
+    for (auto i = 0; i < 2000; ++i) expected.push_back({static_cast<float>(i) * 0.5f, i, static_cast<char>(i % 3)});
+    auto actual = std::vector<test::Particle>(3);
+    nc::serialize::SerializeColumnar(stream, expected);
+    nc::serialize::DeserializeColumnar(stream, actual);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BinarySerializationTest, SerializeColumnar_nonTrivialAggregate_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expected = std::vector<test::Aggregate>{
+        {42, {59, "sample"}, { {{1}, {2}, {3}} }, 4, 5, 6, 7, 8, 9, 10},
+        {43, {60, "another sample"}, { {} }, 11, 12, 13}
+    };
+
+    auto actual = std::vector<test::Aggregate>{};
+    nc::serialize::SerializeColumnar(stream, expected);
+    nc::serialize::DeserializeColumnar(stream, actual);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BinarySerializationTest, SerializeColumnar_columnsReadableAsVectors)
+{
+    auto stream = std::stringstream{};
+    const auto expected = std::vector<test::Particle>{{1.0f, 1, 'a'}, {2.0f, 2, 'b'}};
+    auto positions = std::vector<float>{};
+    auto ids = std::vector<int>{};
+    auto flags = std::vector<char>{};
+    nc::serialize::SerializeColumnar(stream, expected);
+    nc::serialize::binary::DeserializeMultiple(stream, positions, ids, flags);
+    EXPECT_EQ(positions, (std::vector<float>{1.0f, 2.0f}));
+    EXPECT_EQ(ids, (std::vector<int>{1, 2}));
+    EXPECT_EQ(flags, (std::vector<char>{'a', 'b'}));
+}
+
+TEST(BinarySerializationTest, SerializeColumnar_emptyRange_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expected = std::vector<test::Particle>{};
+    auto actual = std::vector<test::Particle>{{1.0f, 1, 'a'}};
+    nc::serialize::SerializeColumnar(stream, expected);
+    nc::serialize::DeserializeColumnar(stream, actual);
+    EXPECT_TRUE(actual.empty());
+}
+
+TEST(BinarySerializationTest, DeserializationContext_validInput_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expected = test::Aggregate{42, {59, "sample"}, { {{1}, {2}, {3}} }, 4, 5, 6, 7, 8, 9, 10};
+    auto actual = test::Aggregate{};
+    nc::serialize::Serialize(stream, expected);
+    const auto size = stream.str().size();
+    auto context = nc::serialize::DeserializationContext{stream, {.maxBytes = size, .maxAllocationBytes = 1024}};
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(0ull, context.BytesRemaining());
+}
+
+TEST(BinarySerializationTest, DeserializationContext_oversizedLength_throwsBeforeAllocating)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, size_t{1} << 40);
+    nc::serialize::Serialize(stream, 1);
+    auto trivial = std::vector<int>{};
+    auto nonTrivial = std::vector<std::string>{};
+    auto map = std::unordered_map<int, std::string>{};
+    auto context = nc::serialize::DeserializationContext{stream, {.maxBytes = stream.str().size()}};
+    EXPECT_THROW(nc::serialize::Deserialize(stream, trivial), nc::NcError);
+    stream.seekg(0);
+    EXPECT_THROW(nc::serialize::Deserialize(stream, nonTrivial), nc::NcError);
+    stream.seekg(0);
+    EXPECT_THROW(nc::serialize::Deserialize(stream, map), nc::NcError);
+    EXPECT_EQ(0ull, trivial.capacity());
+    EXPECT_EQ(0ull, nonTrivial.capacity());
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(BinarySerializationTest, DeserializationContext_exceedsAllocationBudget_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, std::vector<std::string>{"a", "b"});
+    nc::serialize::Serialize(stream, std::vector<std::string>{"c", "d"});
+    auto actual = std::vector<std::string>{};
+    auto context = nc::serialize::DeserializationContext{stream, {.maxAllocationBytes = 3 * sizeof(std::string) + 2}};
+    EXPECT_NO_THROW(nc::serialize::Deserialize(stream, actual));
+    EXPECT_THROW(nc::serialize::Deserialize(stream, actual), nc::NcError);
+}
+
+TEST(BinarySerializationTest, DeserializationContext_detachesOnDestruction)
+{
+    auto stream = std::stringstream{};
+    {
+        auto context = nc::serialize::DeserializationContext{stream};
+        EXPECT_EQ(&context, nc::serialize::DeserializationContext::Get(stream));
+    }
+
+    EXPECT_EQ(nullptr, nc::serialize::DeserializationContext::Get(stream));
+}
+
+TEST(BinarySerializationTest, DeserializationContext_arena_allocatesFromArena)
+{
+    auto stream = std::stringstream{};
+    const auto expected = std::pmr::vector<std::pmr::string>{"a string long enough to defeat small string optimization", "b"};
+    nc::serialize::Serialize(stream, expected);
+    auto context = nc::serialize::DeserializationContext{stream, {.arenaSize = 1024}};
+    auto actual = std::pmr::vector<std::pmr::string>{context.Resource()};
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+    EXPECT_NE(std::pmr::get_default_resource(), context.Resource());
+    EXPECT_EQ(context.Resource(), actual.get_allocator().resource());
+    EXPECT_EQ(context.Resource(), actual.front().get_allocator().resource());
+}
+
+TEST(BinarySerializationTest, Serialize_customAllocatorContainers_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expectedString = std::pmr::string{"test"};
+    const auto expectedVector = std::pmr::vector<std::pmr::string>{"one", "two"};
+    auto actualString = std::pmr::string{};
+    auto actualVector = std::pmr::vector<std::pmr::string>{};
+    nc::serialize::Serialize(stream, expectedString);
+    nc::serialize::Serialize(stream, expectedVector);
+    nc::serialize::Deserialize(stream, actualString);
+    nc::serialize::Deserialize(stream, actualVector);
+    EXPECT_EQ(expectedString, actualString);
+    EXPECT_EQ(expectedVector, actualVector);
+    EXPECT_EQ(nc::serialize::SerializedSize(expectedVector), nc::serialize::SerializedSize(std::vector<std::string>{"one", "two"}));
+}
+
+TEST(BinarySerializationTest, Serialize_stlContainers_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expectedDeque = std::deque<int>{1, 2, 3};
+    const auto expectedStringDeque = std::deque<std::string>{"one", "two"};
+    const auto expectedMap = std::map<std::string, int>{{"one", 1}, {"two", 2}};
+    const auto expectedSet = std::set<int>{3, 1, 2};
+    const auto expectedUnorderedSet = std::unordered_set<std::string>{"one", "two", "three"};
+    const auto expectedTuple = std::tuple<int, std::string, float>{1, "two", 3.0f};
+    auto actualDeque = std::deque<int>{};
+    auto actualStringDeque = std::deque<std::string>{};
+    auto actualMap = std::map<std::string, int>{};
+    auto actualSet = std::set<int>{};
+    auto actualUnorderedSet = std::unordered_set<std::string>{};
+    auto actualTuple = std::tuple<int, std::string, float>{};
+    nc::serialize::binary::SerializeMultiple(stream, expectedDeque, expectedStringDeque, expectedMap, expectedSet, expectedUnorderedSet, expectedTuple);
+    nc::serialize::binary::DeserializeMultiple(stream, actualDeque, actualStringDeque, actualMap, actualSet, actualUnorderedSet, actualTuple);
+    EXPECT_EQ(expectedDeque, actualDeque);
+    EXPECT_EQ(expectedStringDeque, actualStringDeque);
+    EXPECT_EQ(expectedMap, actualMap);
+    EXPECT_EQ(expectedSet, actualSet);
+    EXPECT_EQ(expectedUnorderedSet, actualUnorderedSet);
+    EXPECT_EQ(expectedTuple, actualTuple);
+}
+
+TEST(BinarySerializationTest, Serialize_largeDeque_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    auto expected = std::deque<uint64_t>(10000);
+    std::ranges::generate(expected, [i = uint64_t{0}]() mutable { return i++; });
+    auto actual = std::deque<uint64_t>{};
+    nc::serialize::Serialize(stream, expected);
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BinarySerializationTest, Serialize_variant_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expectedInt = std::variant<int, std::string>{42};
+    const auto expectedString = std::variant<int, std::string>{"test"};
+    auto actualInt = std::variant<int, std::string>{"existing"};
+    auto actualString = std::variant<int, std::string>{};
+    nc::serialize::Serialize(stream, expectedInt);
+    nc::serialize::Serialize(stream, expectedString);
+    nc::serialize::Deserialize(stream, actualInt);
+    nc::serialize::Deserialize(stream, actualString);
+    EXPECT_EQ(expectedInt, actualInt);
+    EXPECT_EQ(expectedString, actualString);
+}
+
+TEST(BinarySerializationTest, Deserialize_invalidVariantIndex_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, size_t{5});
+    auto actual = std::variant<int, float>{};
+    EXPECT_THROW(nc::serialize::Deserialize(stream, actual), nc::NcError);
+}
+
+TEST(BinarySerializationTest, Deserialize_nonEmptyOrderedContainers_replacesContents)
+{
+    auto stream = std::stringstream{};
+    const auto expectedMap = std::map<int, std::string>{{1, "one"}};
+    const auto expectedSet = std::unordered_set<int>{4, 5, 6, 7};
+    auto actualMap = std::map<int, std::string>{{2, "two"}, {3, "three"}};
+    auto actualSet = std::unordered_set<int>{1, 2};
+    nc::serialize::Serialize(stream, expectedMap);
+    nc::serialize::Serialize(stream, expectedSet);
+    nc::serialize::Deserialize(stream, actualMap);
+    nc::serialize::Deserialize(stream, actualSet);
+    EXPECT_EQ(expectedMap, actualMap);
+    EXPECT_EQ(expectedSet, actualSet);
+}
+
+TEST(BinarySerializationTest, Serialize_pmrAssociativeContainers_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expectedMap = std::pmr::map<std::pmr::string, int>{{"one", 1}, {"two", 2}};
+    const auto expectedUnorderedMap = std::pmr::unordered_map<int, std::pmr::vector<int>>{{1, {1, 2}}, {2, {3}}};
+    const auto expectedDeque = std::pmr::deque<std::pmr::string>{"one", "two"};
+    auto actualMap = std::pmr::map<std::pmr::string, int>{};
+    auto actualUnorderedMap = std::pmr::unordered_map<int, std::pmr::vector<int>>{};
+    auto actualDeque = std::pmr::deque<std::pmr::string>{};
+    nc::serialize::binary::SerializeMultiple(stream, expectedMap, expectedUnorderedMap, expectedDeque);
+    nc::serialize::binary::DeserializeMultiple(stream, actualMap, actualUnorderedMap, actualDeque);
+    EXPECT_EQ(expectedMap, actualMap);
+    EXPECT_EQ(expectedUnorderedMap, actualUnorderedMap);
+    EXPECT_EQ(expectedDeque, actualDeque);
+}
+
+TEST(BinarySerializationTest, SerializedSize_stlContainers_matchesSerializedBytes)
+{
+    EXPECT_EQ(test::SerializedBytes(std::deque<int>{1, 2, 3}), nc::serialize::SerializedSize(std::deque<int>{1, 2, 3}));
+    EXPECT_EQ(test::SerializedBytes(std::set<int>{1, 2}), nc::serialize::SerializedSize(std::set<int>{1, 2}));
+    const auto map = std::map<std::string, std::vector<int>>{{"one", {1}}, {"two", {2, 3}}};
+    EXPECT_EQ(test::SerializedBytes(map), nc::serialize::SerializedSize(map));
+    const auto tuple = std::tuple<int, std::string>{1, "two"};
+    EXPECT_EQ(test::SerializedBytes(tuple), nc::serialize::SerializedSize(tuple));
+    const auto variant = std::variant<int, std::string>{"test"};
+    EXPECT_EQ(test::SerializedBytes(variant), nc::serialize::SerializedSize(variant));
+    static_assert(nc::serialize::FixedSerializedSize<std::tuple<int, double>>() == sizeof(int) + sizeof(double));
+}
+
+TEST(BinarySerializationTest, MemberCount_variousSizes_countsMembers)
+{
+    struct Empty {};
+    struct One { int a; };
+    struct Mixed { int a; std::string b; std::vector<int> c; float d; };
+    static_assert(nc::serialize::binary::MemberCount<Empty>() == 0);
+    static_assert(nc::serialize::binary::MemberCount<One>() == 1);
+    static_assert(nc::serialize::binary::MemberCount<Mixed>() == 4);
+    static_assert(nc::serialize::binary::MemberCount<test::Aggregate>() == 16);
+}
+
+TEST(BinarySerializationTest, Serialize_maxMemberAggregate_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    auto expected = test::WideAggregate{"test"};
+    expected.m2 = 2;
+    expected.m33 = 33;
+    expected.m64 = 64;
+    auto actual = test::WideAggregate{};
+    nc::serialize::Serialize(stream, expected);
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(test::SerializedBytes(expected), nc::serialize::SerializedSize(expected));
+}
+
+namespace test
+{
+struct Entity
+{
+    int id;
+    std::string name;
+    std::vector<float> values;
+    auto operator<=>(const Entity&) const = default;
+};
+
+auto MakeEntities(size_t count) -> std::vector<Entity>
+{
+    auto entities = std::vector<Entity>(count);
+    for (auto i = size_t{0}; i < count; ++i)
+    {
+        entities[i] = Entity{static_cast<int>(i), std::to_string(i), std::vector<float>(i % 4, 1.0f)};
+    }
+
+    return entities;
+}
+} // namespace test
+
+TEST(BinarySerializationTest, SerializeChunked_preservedRoundTrip)
+{
+    const auto expected = test::MakeEntities(10000);
+    for (auto threadCount : {size_t{1}, size_t{4}, size_t{0}})
+    {
+        auto stream = std::stringstream{};
+        auto actual = std::vector<test::Entity>{};
+        nc::serialize::SerializeChunked(stream, expected, threadCount);
+        nc::serialize::DeserializeChunked(stream, actual, threadCount);
+        EXPECT_EQ(expected, actual);
+    }
+}
+
+TEST(BinarySerializationTest, SerializeChunked_scratchResource_preservedRoundTrip)
+{
+    const auto expected = test::MakeEntities(10000);
+    auto scratch = std::pmr::monotonic_buffer_resource{};
+    auto reference = std::stringstream{};
+    nc::serialize::SerializeChunked(reference, expected, 1);
+    for (auto threadCount : {size_t{1}, size_t{4}})
+    {
+        auto stream = std::stringstream{};
+        auto actual = std::vector<test::Entity>{};
+        nc::serialize::SerializeChunked(stream, expected, threadCount, &scratch);
+        EXPECT_EQ(reference.str(), stream.str());
+        nc::serialize::DeserializeChunked(stream, actual, threadCount, &scratch);
+        EXPECT_EQ(expected, actual);
+    }
+}
+
+TEST(BinarySerializationTest, SerializeChunked_outputIndependentOfThreadCount)
+{
+    const auto expected = test::MakeEntities(10000);
+    auto singleThreaded = std::stringstream{};
+    auto multiThreaded = std::stringstream{};
+    nc::serialize::SerializeChunked(singleThreaded, expected, 1);
+    nc::serialize::SerializeChunked(multiThreaded, expected, 8);
+    EXPECT_EQ(singleThreaded.str(), multiThreaded.str());
+}
+
+TEST(BinarySerializationTest, SerializeChunked_emptyVector_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    auto actual = test::MakeEntities(3);
+    nc::serialize::SerializeChunked(stream, std::vector<test::Entity>{});
+    nc::serialize::DeserializeChunked(stream, actual);
+    EXPECT_TRUE(actual.empty());
+}
+
+TEST(BinarySerializationTest, DeserializeChunked_corruptOffsets_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::SerializeChunked(stream, test::MakeEntities(5000), 1);
+    auto bytes = stream.str();
+    const auto firstChunkEnd = 3 * sizeof(size_t);
+    bytes[firstChunkEnd] = static_cast<char>(bytes[firstChunkEnd] + 1);
+    auto corrupt = std::stringstream{bytes};
+    auto actual = std::vector<test::Entity>{};
+    EXPECT_THROW(nc::serialize::DeserializeChunked(corrupt, actual, 2), nc::NcError);
+}
+
+TEST(BinarySerializationTest, DeserializeChunked_oversizedLength_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::binary::SerializeMultiple(stream, size_t{1} << 40, nc::serialize::binary::g_elementsPerChunk);
+    auto actual = std::vector<test::Entity>{};
+    auto context = nc::serialize::DeserializationContext{stream, {.maxBytes = stream.str().size()}};
+    EXPECT_THROW(nc::serialize::DeserializeChunked(stream, actual), nc::NcError);
+}
+
+TEST(BinarySerializationTest, DeserializeChunked_forgedLength_throws)
+{
+    // A single chunk claiming 2^40 elements in a 4 byte payload.
+    const auto forged = size_t{1} << 40;
+    auto stream = std::stringstream{};
+    nc::serialize::binary::SerializeMultiple(stream, forged, forged, size_t{0}, size_t{4}, 7);
+    auto actual = std::vector<int>{};
+    {
+        auto context = nc::serialize::DeserializationContext{stream, {.maxBytes = 64}};
+        EXPECT_THROW(nc::serialize::DeserializeChunked(stream, actual), nc::NcError);
+    }
+
+    stream.seekg(0);
+    EXPECT_THROW(nc::serialize::DeserializeChunked(stream, actual), nc::NcError);
+    EXPECT_TRUE(actual.empty());
+}
+
+TEST(BinarySerializationTest, DeserializeChunked_forgedChunkCount_throws)
+{
+    // A chunk per element for SIZE_MAX elements would wrap the offset table size to zero.
+    auto stream = std::stringstream{};
+    nc::serialize::binary::SerializeMultiple(stream, SIZE_MAX, size_t{1}, size_t{0});
+    auto actual = std::vector<int>{};
+    auto context = nc::serialize::DeserializationContext{stream, {.maxBytes = stream.str().size()}};
+    EXPECT_THROW(nc::serialize::DeserializeChunked(stream, actual), nc::NcError);
+}
+
+TEST(BinarySerializationTest, DeserializeChunked_chunksExceedingBudgetTogether_throws)
+{
+    // Each chunk's strings fit within the budget on their own, but not all of them.
+    auto expected = std::vector<std::string>(nc::serialize::binary::g_elementsPerChunk * 4, std::string(8, 'x'));
+    auto stream = std::stringstream{};
+    nc::serialize::SerializeChunked(stream, expected, 1);
+    const auto elementBytes = expected.size() * sizeof(std::string);
+    const auto payloadBytes = stream.str().size();
+    const auto budget = elementBytes + payloadBytes + nc::serialize::binary::g_elementsPerChunk * 8 * 2;
+
+    for (auto threadCount : {size_t{1}, size_t{4}})
+    {
+        auto in = std::stringstream{stream.str()};
+        auto actual = std::vector<std::string>{};
+        auto context = nc::serialize::DeserializationContext{in, {.maxAllocationBytes = budget}};
+        EXPECT_THROW(nc::serialize::DeserializeChunked(in, actual, threadCount), nc::NcError);
+    }
+
+    auto in = std::stringstream{stream.str()};
+    auto actual = std::vector<std::string>{};
+    auto context = nc::serialize::DeserializationContext{in, {.maxAllocationBytes = budget * 4}};
+    nc::serialize::DeserializeChunked(in, actual, 4);
+    EXPECT_EQ(expected, actual);
+}
+
+namespace test
+{
+struct Transform
+{
+    float x, y, z;
+    std::string name;
+    std::vector<int> tags;
+    bool active;
+};
+} // namespace test
+
+TEST(BinarySerializationTest, SerializeDelta_unchanged_writesOnlyMask)
+{
+    auto stream = std::stringstream{};
+    const auto baseline = test::Transform{1.0f, 2.0f, 3.0f, "entity", {1, 2}, true};
+    EXPECT_FALSE(nc::serialize::SerializeDelta(stream, baseline, baseline));
+    EXPECT_EQ(1u, stream.str().size());
+
+    auto actual = baseline;
+    nc::serialize::DeserializeDelta(stream, actual);
+    EXPECT_EQ(baseline.name, actual.name);
+}
+
+TEST(BinarySerializationTest, SerializeDelta_changedMembers_appliedToBaseline)
+{
+    auto stream = std::stringstream{};
+    const auto baseline = test::Transform{1.0f, 2.0f, 3.0f, "entity", {1, 2}, true};
+    auto current = baseline;
+    current.y = 5.0f;
+    current.tags.push_back(3);
+    EXPECT_TRUE(nc::serialize::SerializeDelta(stream, baseline, current));
+    EXPECT_EQ(1u + sizeof(float) + nc::serialize::SerializedSize(current.tags), stream.str().size());
+
+    auto actual = baseline;
+    nc::serialize::DeserializeDelta(stream, actual);
+    EXPECT_EQ(current.x, actual.x);
+    EXPECT_EQ(current.y, actual.y);
+    EXPECT_EQ(current.z, actual.z);
+    EXPECT_EQ(current.name, actual.name);
+    EXPECT_EQ(current.tags, actual.tags);
+    EXPECT_EQ(current.active, actual.active);
+}
+
+TEST(BinarySerializationTest, SerializeDelta_nestedAggregateWithoutEquality_detectsChanges)
+{
+    struct Inner { std::string value; };
+    struct Outer { Inner inner; int count; };
+
+    auto stream = std::stringstream{};
+    const auto baseline = Outer{{"a"}, 1};
+    const auto current = Outer{{"b"}, 1};
+    EXPECT_TRUE(nc::serialize::SerializeDelta(stream, baseline, current));
+
+    auto actual = baseline;
+    nc::serialize::DeserializeDelta(stream, actual);
+    EXPECT_EQ("b", actual.inner.value);
+    EXPECT_EQ(1, actual.count);
+}
+
+TEST(BinarySerializationTest, DeserializeDelta_invalidMask_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, uint8_t{0xFF});
+    auto actual = test::Transform{};
+    EXPECT_THROW(nc::serialize::DeserializeDelta(stream, actual), nc::NcError);
+}
+
+namespace test
+{
+constexpr auto g_foreignByteOrder = nc::serialize::g_nativeByteOrder == nc::serialize::ByteOrder::Little
+                                  ? nc::serialize::ByteOrder::Big
+                                  : nc::serialize::ByteOrder::Little;
+
+struct Packet
+{
+    uint16_t id;
+    double value;
+    std::array<int32_t, 2> pair;
+    char tag;
+};
+
+struct WithArray
+{
+    float m[3];
+};
+
+struct Base
+{
+    int32_t a;
+};
+
+struct Derived : Base
+{
+    int32_t b;
+};
+
+struct MixedDerived : Base
+{
+    uint16_t b;
+};
+
+struct Outer
+{
+    WithArray inner;
+    uint16_t tag;
+};
+
+class Opaque
+{
+    public:
+        Opaque() = default;
+        explicit Opaque(int v) : m_value{v} {}
+        auto Value() const -> int { return m_value; }
+
+    private:
+        int m_value = 0;
+};
+
+// Mixes scalar sizes behind private members, so its layout can't be inferred.
+class MixedOpaque
+{
+    public:
+        MixedOpaque() = default;
+        MixedOpaque(double d, int i) : m_d{d}, m_i{i} {}
+
+    private:
+        double m_d = 0.0;
+        int m_i = 0;
+        int m_padding = 0;
+};
+
+// Serialize obj with the foreign byte order, check each scalar of ScalarType was swapped, then read it back.
+template<class ScalarType, class T>
+auto RoundTripForeign(const T& obj) -> T
+{
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, g_foreignByteOrder);
+    nc::serialize::Serialize(stream, obj);
+
+    auto native = std::stringstream{};
+    nc::serialize::Serialize(native, obj);
+    auto expected = native.str();
+    for (auto pos = expected.begin(); pos != expected.end(); pos += sizeof(ScalarType))
+        std::reverse(pos, pos + sizeof(ScalarType));
+
+    EXPECT_EQ(expected, stream.str());
+    auto actual = T{};
+    nc::serialize::Deserialize(stream, actual);
+    return actual;
+}
+} // namespace test
+
+static_assert(nc::serialize::binary::IsDecomposable<test::Packet>());
+static_assert(nc::serialize::binary::IsDecomposable<test::Outer>());
+static_assert(!nc::serialize::binary::IsDecomposable<test::WithArray>());
+static_assert(!nc::serialize::binary::IsDecomposable<test::Derived>());
+static_assert(!nc::serialize::binary::IsDecomposable<nc::Vector3>());
+
+TEST(BinarySerializationTest, ByteOrder_foreign_swapsScalars)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, test::g_foreignByteOrder);
+    nc::serialize::Serialize(stream, uint32_t{0x01020304});
+
+    auto native = std::stringstream{};
+    nc::serialize::Serialize(native, uint32_t{0x04030201});
+    EXPECT_EQ(native.str(), stream.str());
+
+    auto actual = uint32_t{};
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(0x01020304u, actual);
+}
+
+TEST(BinarySerializationTest, ByteOrder_foreign_roundTripsNestedData)
+{
+    const auto expected = std::tuple{
+        std::vector<int64_t>{1, -2, 3},
+        std::deque<float>{1.5f, -2.25f},
+        std::string{"text"},
+        std::vector<test::Packet>{{7, 3.25, {{-1, 2}}, 'x'}},
+        std::map<int, std::vector<uint16_t>>{{1, {10, 20}}, {2, {}}},
+        std::array<double, 2>{0.5, -8.0}
+    };
+
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, test::g_foreignByteOrder);
+    nc::serialize::Serialize(stream, expected);
+
+    auto native = std::stringstream{};
+    nc::serialize::Serialize(native, expected);
+    EXPECT_NE(native.str(), stream.str());
+    EXPECT_EQ(native.str().size(), stream.str().size());
+
+    auto actual = decltype(expected){};
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(std::get<0>(expected), std::get<0>(actual));
+    EXPECT_EQ(std::get<1>(expected), std::get<1>(actual));
+    EXPECT_EQ(std::get<2>(expected), std::get<2>(actual));
+    EXPECT_EQ(std::get<4>(expected), std::get<4>(actual));
+    EXPECT_EQ(std::get<5>(expected), std::get<5>(actual));
+    const auto& packet = std::get<3>(actual).at(0);
+    EXPECT_EQ(7, packet.id);
+    EXPECT_EQ(3.25, packet.value);
+    EXPECT_EQ(-1, packet.pair[0]);
+    EXPECT_EQ(2, packet.pair[1]);
+    EXPECT_EQ('x', packet.tag);
+}
+
+TEST(BinarySerializationTest, ByteOrder_foreignChunked_roundTrips)
+{
+    const auto expected = test::MakeEntities(nc::serialize::binary::g_elementsPerChunk + 10);
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, test::g_foreignByteOrder);
+    nc::serialize::SerializeChunked(stream, expected, 2);
+
+    auto actual = std::vector<test::Entity>{};
+    nc::serialize::DeserializeChunked(stream, actual, 2);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BinarySerializationTest, ByteOrder_foreignArrayMember_swapsElements)
+{
+    const auto actual = test::RoundTripForeign<float>(test::WithArray{{1.5f, -2.0f, 8.25f}});
+    EXPECT_EQ(1.5f, actual.m[0]);
+    EXPECT_EQ(-2.0f, actual.m[1]);
+    EXPECT_EQ(8.25f, actual.m[2]);
+
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, test::g_foreignByteOrder);
+    nc::serialize::Serialize(stream, test::Outer{{{1.0f, 2.0f, 3.0f}}, 0x0102});
+    auto outer = test::Outer{};
+    nc::serialize::Deserialize(stream, outer);
+    EXPECT_EQ(3.0f, outer.inner.m[2]);
+    EXPECT_EQ(0x0102, outer.tag);
+}
+
+TEST(BinarySerializationTest, ByteOrder_foreignDerived_swapsBaseAndMembers)
+{
+    const auto actual = test::RoundTripForeign<int32_t>(test::Derived{{0x01020304}, -5});
+    EXPECT_EQ(0x01020304, actual.a);
+    EXPECT_EQ(-5, actual.b);
+}
+
+TEST(BinarySerializationTest, ByteOrder_bigVector3_swapsComponents)
+{
+    const auto expected = nc::Vector3{1.0f, -2.5f, 100.0f};
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, nc::serialize::ByteOrder::Big);
+    nc::serialize::Serialize(stream, expected);
+
+    const auto bytes = stream.str();
+    ASSERT_EQ(12u, bytes.size());
+    EXPECT_EQ((std::string{'\x3F', '\x80', '\x00', '\x00'}), bytes.substr(0, 4)); // 1.0f
+
+    auto actual = nc::Vector3{};
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BinarySerializationTest, ByteOrder_foreignOpaqueType_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, test::g_foreignByteOrder);
+    EXPECT_THROW(nc::serialize::Serialize(stream, test::Opaque{1}), nc::NcError);
+    EXPECT_THROW(nc::serialize::Serialize(stream, test::MixedOpaque{1.0, 7}), nc::NcError);
+    EXPECT_TRUE(stream.str().empty());
+
+    auto native = std::stringstream{};
+    EXPECT_NO_THROW(nc::serialize::Serialize(native, test::Opaque{1}));
+    EXPECT_NO_THROW(nc::serialize::Serialize(native, test::MixedOpaque{1.0, 7}));
+}
+
+TEST(BinarySerializationTest, ByteOrder_foreignDeclaredLayout_swapsScalars)
+{
+    using Id = nc::serialize::Ranged<uint16_t, 0, 1000>;
+    using Angle = nc::serialize::Quantized<-1.0f, 1.0f, 12>;
+    EXPECT_EQ(Id{0x0102}, test::RoundTripForeign<uint16_t>(Id{0x0102}));
+    EXPECT_EQ(Angle{0.25f}, test::RoundTripForeign<float>(Angle{0.25f}));
+}
+
+TEST(BinarySerializationTest, ByteOrder_foreignMixedScalarSizes_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::SetByteOrder(stream, test::g_foreignByteOrder);
+    EXPECT_THROW(nc::serialize::Serialize(stream, test::MixedDerived{{1}, 2}), nc::NcError);
+
+    auto native = std::stringstream{};
+    EXPECT_NO_THROW(nc::serialize::Serialize(native, test::MixedDerived{{1}, 2}));
+}
+
+TEST(BinarySerializationTest, FormatHeader_nativeOrder_writesUnconvertedData)
+{
+    const auto expected = std::vector<int>{1, 2, 3};
+    auto stream = std::stringstream{};
+    nc::serialize::WriteFormatHeader(stream, nc::serialize::g_nativeByteOrder);
+    nc::serialize::Serialize(stream, expected);
+
+    auto raw = std::stringstream{};
+    nc::serialize::Serialize(raw, expected);
+    EXPECT_EQ(raw.str(), stream.str().substr(6));
+
+    auto actual = std::vector<int>{};
+    EXPECT_EQ(nc::serialize::g_nativeByteOrder, nc::serialize::ReadFormatHeader(stream));
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BinarySerializationTest, FormatHeader_foreignOrder_readerConverts)
+{
+    const auto expected = std::vector<int>{1, 2, 3};
+    auto out = std::stringstream{};
+    nc::serialize::WriteFormatHeader(out, test::g_foreignByteOrder);
+    nc::serialize::Serialize(out, expected);
+
+    auto in = std::stringstream{out.str()};
+    EXPECT_EQ(test::g_foreignByteOrder, nc::serialize::ReadFormatHeader(in));
+    auto actual = std::vector<int>{};
+    nc::serialize::Deserialize(in, actual);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BinarySerializationTest, FormatHeader_invalid_throws)
+{
+    auto missing = std::stringstream{"data"};
+    EXPECT_THROW(nc::serialize::ReadFormatHeader(missing), nc::NcError);
+
+    auto badOrder = std::stringstream{std::string{"NCSB\x01\x07", 6}};
+    EXPECT_THROW(nc::serialize::ReadFormatHeader(badOrder), nc::NcError);
+}
@@ -0,0 +1,240 @@
+#include "gtest/gtest.h"
+#include "ncutility/BinarySerialization.h"
+
+#include <array>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace test
+{
+enum class Team : uint8_t { Red, Green, Blue };
+
+// Snapshot with explicit per-member bit budgets.
+struct Snapshot
+{
+    nc::serialize::Ranged<uint32_t, 0, 1023> id;
+    nc::serialize::Ranged<Team, Team::Red, Team::Blue> team;
+    std::array<nc::serialize::Quantized<-512.0f, 512.0f, 20>, 3> position;
+    nc::serialize::Ranged<int, -100, 100> health;
+    bool alive;
+};
+
+// Snapshot with variable size members.
+struct PlayerInfo
+{
+    std::string name;
+    std::optional<nc::serialize::Ranged<int, 0, 15>> slot;
+    std::vector<nc::serialize::Ranged<uint8_t, 0, 7>> items;
+    auto operator<=>(const PlayerInfo&) const = default;
+};
+
+// Type with a custom bit encoding.
+struct Flags
+{
+    uint32_t value;
+};
+
+void Serialize(nc::serialize::BitWriter& writer, const Flags& in)
+{
+    writer.WriteBits(in.value, 3);
+}
+
+void Deserialize(nc::serialize::BitReader& reader, Flags& out)
+{
+    out.value = static_cast<uint32_t>(reader.ReadBits(3));
+}
+} // namespace test
+
+static_assert(nc::serialize::FixedBitCount<test::Snapshot>() == 10 + 2 + 60 + 8 + 1);
+static_assert(nc::serialize::RangeBitCount(0, 0) == 0);
+static_assert(nc::serialize::RangeBitCount(-1, 0) == 1);
+static_assert(nc::serialize::RangeBitCount(int64_t{INT64_MIN}, int64_t{INT64_MAX}) == 64);
+
+TEST(BitStreamTest, WriteBits_variousWidths_preservedRoundTrip)
+{
+    auto writer = nc::serialize::BitWriter{};
+    for (auto bits = 0u; bits <= 64u; ++bits)
+    {
+        writer.WriteBits(0xDEADBEEFCAFEF00Dull, bits);
+    }
+
+    EXPECT_EQ(64u * 65u / 2u, writer.BitCount());
+    const auto bytes = writer.Finish();
+    EXPECT_EQ((64u * 65u / 2u + 7u) / 8u, bytes.size());
+
+    auto reader = nc::serialize::BitReader{bytes};
+    for (auto bits = 0u; bits <= 64u; ++bits)
+    {
+        const auto mask = bits == 64u ? ~0ull : (1ull << bits) - 1u;
+        EXPECT_EQ(0xDEADBEEFCAFEF00Dull & mask, reader.ReadBits(bits));
+    }
+}
+
+TEST(BitStreamTest, WriteRanged_preservedRoundTrip)
+{
+    auto writer = nc::serialize::BitWriter{};
+    writer.WriteRanged(-5, -10, 10);
+    writer.WriteRanged(int64_t{INT64_MIN}, int64_t{INT64_MIN}, int64_t{INT64_MAX});
+    writer.WriteRanged(test::Team::Blue, test::Team::Red, test::Team::Blue);
+    writer.WriteBool(true);
+    EXPECT_EQ(5u + 64u + 2u + 1u, writer.BitCount());
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    EXPECT_EQ(-5, reader.ReadRanged(-10, 10));
+    EXPECT_EQ(int64_t{INT64_MIN}, reader.ReadRanged(int64_t{INT64_MIN}, int64_t{INT64_MAX}));
+    EXPECT_EQ(test::Team::Blue, reader.ReadRanged(test::Team::Red, test::Team::Blue));
+    EXPECT_TRUE(reader.ReadBool());
+}
+
+TEST(BitStreamTest, WriteQuantized_withinPrecision)
+{
+    auto writer = nc::serialize::BitWriter{};
+    const auto values = std::array{-1.0f, -0.33f, 0.0f, 0.5f, 1.0f, 2.0f};
+    for (auto value : values) writer.WriteQuantized(value, -1.0f, 1.0f, 10);
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    const auto precision = 2.0f / 1023.0f * 0.5f + 1e-6f;
+    for (auto value : values)
+    {
+        EXPECT_NEAR(std::clamp(value, -1.0f, 1.0f), reader.ReadQuantized(-1.0f, 1.0f, 10), precision);
+    }
+}
+
+TEST(BitStreamTest, WriteQuantized_fullWidthAndNaN_stayInRange)
+{
+    auto writer = nc::serialize::BitWriter{};
+    writer.WriteQuantized(1.0f, -1.0f, 1.0f, 32);
+    writer.WriteQuantized(std::numeric_limits<float>::quiet_NaN(), -1.0f, 1.0f, 32);
+    writer.WriteQuantized(std::numeric_limits<float>::quiet_NaN(), 2.0f, 3.0f, 8);
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    EXPECT_EQ(1.0f, reader.ReadQuantized(-1.0f, 1.0f, 32));
+    EXPECT_EQ(-1.0f, reader.ReadQuantized(-1.0f, 1.0f, 32));
+    EXPECT_EQ(2.0f, reader.ReadQuantized(2.0f, 3.0f, 8));
+}
+
+TEST(BitStreamTest, WriteVarUint_preservedRoundTrip)
+{
+    auto writer = nc::serialize::BitWriter{};
+    const auto values = std::array{0ull, 127ull, 128ull, 300ull, ~0ull};
+    for (auto value : values) writer.WriteVarUint(value);
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    for (auto value : values) EXPECT_EQ(value, reader.ReadVarUint());
+}
+
+TEST(BitStreamTest, ReadBits_pastEnd_throws)
+{
+    auto writer = nc::serialize::BitWriter{};
+    writer.WriteBits(0x7, 3);
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    EXPECT_EQ(0x7u, reader.ReadBits(8));
+    EXPECT_THROW(reader.ReadBits(1), nc::NcError);
+}
+
+TEST(BitStreamTest, ReadRanged_outOfRange_throws)
+{
+    auto writer = nc::serialize::BitWriter{};
+    writer.WriteBits(7, 3);
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    EXPECT_THROW(reader.ReadRanged(0, 5), nc::NcError);
+}
+
+TEST(BitStreamTest, Serialize_aggregateWithBitBudgets_preservedRoundTrip)
+{
+    const auto expected = test::Snapshot{512, test::Team::Green, {{1.5f, -200.25f, 511.0f}}, -42, true};
+    auto writer = nc::serialize::BitWriter{};
+    nc::serialize::Serialize(writer, expected);
+    EXPECT_EQ(nc::serialize::FixedBitCount<test::Snapshot>(), writer.BitCount());
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    auto actual = test::Snapshot{};
+    nc::serialize::Deserialize(reader, actual);
+    EXPECT_EQ(expected.id, actual.id);
+    EXPECT_EQ(expected.team, actual.team);
+    EXPECT_EQ(expected.health, actual.health);
+    EXPECT_EQ(expected.alive, actual.alive);
+    for (auto i = 0u; i < 3u; ++i)
+    {
+        EXPECT_NEAR(expected.position[i], actual.position[i], decltype(expected.position)::value_type::Precision * 1.01f);
+    }
+}
+
+TEST(BitStreamTest, Serialize_variableSizeMembers_preservedRoundTrip)
+{
+    const auto expected = test::PlayerInfo{"player", 3, {1, 2, 7}};
+    auto writer = nc::serialize::BitWriter{};
+    nc::serialize::Serialize(writer, expected);
+    nc::serialize::Serialize(writer, test::PlayerInfo{});
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    auto actual = test::PlayerInfo{};
+    auto actualEmpty = test::PlayerInfo{"existing", 1, {1}};
+    nc::serialize::Deserialize(reader, actual);
+    nc::serialize::Deserialize(reader, actualEmpty);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(test::PlayerInfo{}, actualEmpty);
+}
+
+TEST(BitStreamTest, Serialize_customOverload_usesAdl)
+{
+    auto writer = nc::serialize::BitWriter{};
+    nc::serialize::Serialize(writer, test::Flags{5});
+    EXPECT_EQ(3u, writer.BitCount());
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    auto actual = test::Flags{};
+    nc::serialize::Deserialize(reader, actual);
+    EXPECT_EQ(5u, actual.value);
+}
+
+TEST(BitStreamTest, Deserialize_oversizedLength_throws)
+{
+    auto writer = nc::serialize::BitWriter{};
+    writer.WriteVarUint(1ull << 40);
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    auto actual = std::vector<int>{};
+    EXPECT_THROW(nc::serialize::Deserialize(reader, actual), nc::NcError);
+}
+
+TEST(BitStreamTest, ByteSerialization_bitBudgetTypes_preservedRoundTrip)
+{
+    auto stream = std::stringstream{};
+    const auto expected = nc::serialize::Ranged<int, 0, 10>{7};
+    auto actual = nc::serialize::Ranged<int, 0, 10>{};
+    nc::serialize::Serialize(stream, expected);
+    nc::serialize::Deserialize(stream, actual);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(BitStreamTest, SerializeDelta_onlyChangedMembersWritten)
+{
+    auto baseline = test::Snapshot{512, test::Team::Green, {{1.5f, -200.25f, 511.0f}}, -42, true};
+    auto current = baseline;
+    current.health = 10;
+
+    auto writer = nc::serialize::BitWriter{};
+    EXPECT_TRUE(nc::serialize::SerializeDelta(writer, baseline, current));
+    EXPECT_EQ(5u + 8u, writer.BitCount());
+    EXPECT_FALSE(nc::serialize::SerializeDelta(writer, current, current));
+    EXPECT_EQ(5u + 8u + 5u, writer.BitCount());
+
+    const auto bytes = writer.Finish();
+    auto reader = nc::serialize::BitReader{bytes};
+    nc::serialize::DeserializeDelta(reader, baseline);
+    EXPECT_EQ(10, baseline.health.value);
+    nc::serialize::DeserializeDelta(reader, baseline);
+    EXPECT_EQ(10, baseline.health.value);
+}
@@ -0,0 +1,175 @@
+#include "gtest/gtest.h"
+#include "ncutility/BinarySerialization.h"
+#include "ncutility/Blob.h"
+#include "ncutility/Compression.h"
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <thread>
+
+namespace
+{
+auto MakeBytes(size_t size) -> std::vector<char>
+{
+    auto bytes = std::vector<char>(size);
+    for (auto i = 0u; i < size; ++i) bytes[i] = static_cast<char>(i % 251);
+    return bytes;
+}
+} // anonymous namespace
+
+TEST(BlobTest, Construct_fromVector_adoptsWithoutCopying)
+{
+    auto bytes = MakeBytes(100);
+    const auto expected = bytes;
+    const auto* storage = bytes.data();
+    const auto blob = nc::Blob{std::move(bytes)};
+    EXPECT_EQ(storage, blob.data());
+    EXPECT_EQ(100u, blob.size());
+    EXPECT_TRUE(std::ranges::equal(expected, blob));
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(blob.data()) % nc::Blob::Alignment);
+}
+
+TEST(BlobTest, Construct_empty_hasNoStorage)
+{
+    const auto blob = nc::Blob{std::vector<char>{}};
+    EXPECT_TRUE(blob.empty());
+    EXPECT_EQ(nullptr, blob.data());
+    EXPECT_EQ(0, blob.UseCount());
+}
+
+TEST(BlobTest, Copy_sharesStorage)
+{
+    const auto blob = nc::Blob::Copy(MakeBytes(10));
+    const auto copy = blob;
+    EXPECT_EQ(blob.data(), copy.data());
+    EXPECT_EQ(2, blob.UseCount());
+}
+
+TEST(BlobTest, Slice_keepsParentAlive)
+{
+    auto slice = nc::Blob{};
+    {
+        const auto blob = nc::Blob{MakeBytes(100)};
+        slice = blob.Slice(10, 20);
+        EXPECT_EQ(blob.data() + 10, slice.data());
+        EXPECT_EQ(2, blob.UseCount());
+    }
+
+    ASSERT_EQ(20u, slice.size());
+    EXPECT_EQ(1, slice.UseCount());
+    EXPECT_EQ(static_cast<char>(10), slice[0]);
+    EXPECT_EQ(static_cast<char>(29), slice[19]);
+    EXPECT_EQ(static_cast<char>(15), slice.Slice(5)[0]);
+    EXPECT_EQ(15u, slice.Slice(5).size());
+}
+
+TEST(BlobTest, Slice_outOfRange_throws)
+{
+    const auto blob = nc::Blob{MakeBytes(10)};
+    EXPECT_NO_THROW(blob.Slice(10));
+    EXPECT_NO_THROW(blob.Slice(4, 6));
+    EXPECT_THROW(blob.Slice(11), nc::NcError);
+    EXPECT_THROW(blob.Slice(4, 7), nc::NcError);
+    EXPECT_THROW(blob.Slice(1, std::numeric_limits<size_t>::max() - 1), nc::NcError);
+}
+
+TEST(BlobTest, Release_uniqueOwner_movesStorage)
+{
+    auto bytes = MakeBytes(50);
+    const auto* storage = bytes.data();
+    auto blob = nc::Blob{std::move(bytes)};
+    const auto released = blob.Release();
+    EXPECT_EQ(storage, released.data());
+    EXPECT_TRUE(blob.empty());
+}
+
+TEST(BlobTest, Release_shared_copies)
+{
+    auto blob = nc::Blob{MakeBytes(50)};
+    const auto other = blob;
+    auto slice = blob.Slice(5, 5);
+    const auto released = blob.Release();
+    EXPECT_NE(other.data(), released.data());
+    EXPECT_TRUE(std::ranges::equal(other, released));
+    EXPECT_EQ(std::vector<char>(other.begin() + 5, other.begin() + 10), slice.Release());
+}
+
+TEST(BlobTest, Compression_acceptsAndReturnsBlobs)
+{
+    const auto raw = nc::Blob{MakeBytes(4096)};
+    const auto compressed = nc::Blob{nc::Compress(raw)};
+    const auto decompressed = nc::Blob{nc::Decompress(compressed, raw.size())};
+    EXPECT_TRUE(std::ranges::equal(raw, decompressed));
+}
+
+TEST(BlobTest, BlobWriterAndReader_roundTripSerialization)
+{
+    const auto expected = std::vector<std::string>{"a", "bc", "def"};
+    auto writer = nc::BlobWriter{nc::serialize::SerializedSize(expected)};
+    nc::serialize::Serialize(writer, expected);
+    const auto blob = writer.Take();
+    EXPECT_EQ(nc::serialize::SerializedSize(expected), blob.size());
+
+    auto reader = nc::BlobReader{blob};
+    auto actual = std::vector<std::string>{};
+    nc::serialize::Deserialize(reader, actual);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(static_cast<std::streamoff>(blob.size()), static_cast<std::streamoff>(reader.tellg()));
+}
+
+TEST(BlobTest, BufferWriterAndReader_roundTripSerializationInResource)
+{
+    const auto expected = std::vector<std::string>{"a", "bc", "def"};
+    auto storage = std::array<std::byte, 256>{};
+    auto resource = std::pmr::monotonic_buffer_resource{storage.data(), storage.size(), std::pmr::null_memory_resource()};
+    auto writer = nc::BufferWriter{&resource, nc::serialize::SerializedSize(expected)};
+    nc::serialize::Serialize(writer, expected);
+    EXPECT_EQ(nc::serialize::SerializedSize(expected), writer.Bytes().size());
+
+    const auto bytes = writer.Take();
+    EXPECT_TRUE(writer.Bytes().empty());
+    EXPECT_EQ(&resource, bytes.get_allocator().resource());
+    EXPECT_GE(static_cast<const void*>(bytes.data()), static_cast<const void*>(storage.data()));
+    EXPECT_LT(static_cast<const void*>(bytes.data()), static_cast<const void*>(storage.data() + storage.size()));
+
+    auto reader = nc::BufferReader{bytes};
+    auto actual = std::vector<std::string>{};
+    nc::serialize::Deserialize(reader, actual);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(static_cast<std::streamoff>(bytes.size()), static_cast<std::streamoff>(reader.tellg()));
+}
+
+TEST(BlobTest, Serialize_blob_encodedAsCharVector)
+{
+    const auto bytes = MakeBytes(33);
+    auto writer = nc::BlobWriter{};
+    nc::serialize::Serialize(writer, nc::Blob::Copy(bytes));
+    nc::serialize::Serialize(writer, bytes);
+    const auto encoded = writer.Take();
+    const auto half = encoded.size() / 2;
+    EXPECT_EQ(nc::serialize::SerializedSize(nc::Blob::Copy(bytes)), half);
+    EXPECT_TRUE(std::ranges::equal(encoded.Slice(0, half), encoded.Slice(half)));
+
+    auto reader = nc::BlobReader{encoded};
+    auto first = nc::Blob{};
+    auto second = nc::Blob{};
+    nc::serialize::Deserialize(reader, first);
+    nc::serialize::Deserialize(reader, second);
+    EXPECT_TRUE(std::ranges::equal(bytes, first));
+    EXPECT_TRUE(std::ranges::equal(bytes, second));
+}
+
+TEST(BlobTest, HandOff_acrossThreads_sharesStorage)
+{
+    const auto blob = nc::Blob{MakeBytes(1000)};
+    auto sum = 0;
+    auto worker = std::thread{[slice = blob.Slice(100, 10), &sum]()
+    {
+        for (auto c : slice) sum += c;
+    }};
+
+    worker.join();
+    EXPECT_EQ(100 + 101 + 102 + 103 + 104 + 105 + 106 + 107 + 108 + 109, sum);
+}
@@ -3,6 +3,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
 
 constexpr auto g_data = std::array<char, 32>{
     0x1, 0x2, 0x3, 0x4, 0x1, 0x2, 0x3, 0x4,
@@ -40,6 +43,14 @@ TEST(CompressionTest, RoundTrip_emptyData_preservesData)
     EXPECT_TRUE(std::ranges::equal(expected, actual));
 }
 
+TEST(CompressionTest, RoundTrip_emptyDataMaxCompression_preservesData)
+{
+    const auto expected = std::vector<char>{};
+    const auto compressed = nc::Compress(expected, nc::CompressionLevel::Max);
+    const auto actual = nc::Decompress(compressed, 0);
+    EXPECT_TRUE(std::ranges::equal(expected, actual));
+}
+
 TEST(CompressionTest, RoundTrip_uncompressableData_preservesData)
 {
     constexpr auto expected = std::array<char, 1>{'a'};
@@ -48,6 +59,23 @@ TEST(CompressionTest, RoundTrip_uncompressableData_preservesData)
     EXPECT_TRUE(std::ranges::equal(expected, actual));
 }
 
+TEST(CompressionTest, RoundTrip_memoryResource_allocatesOnlyFromResource)
+{
+    // A null upstream makes any allocation beyond the buffer throw, so this covers the LZ4HC state too.
+    auto buffer = std::vector<std::byte>(1 << 20);
+    for (auto level : {nc::CompressionLevel::Default, nc::CompressionLevel::Fast, nc::CompressionLevel::Max})
+    {
+        auto resource = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+        const auto compressed = nc::Compress(g_data, &resource, level);
+        EXPECT_EQ(&resource, compressed.get_allocator().resource());
+        EXPECT_TRUE(std::ranges::equal(nc::Compress(g_data, level), compressed));
+
+        const auto actual = nc::Decompress(compressed, g_data.size(), &resource);
+        EXPECT_EQ(&resource, actual.get_allocator().resource());
+        EXPECT_TRUE(std::ranges::equal(g_data, actual));
+    }
+}
+
 TEST(CompressionTest, Compress_invalidCompressionLevel_throws)
 {
     constexpr auto badLevel = static_cast<nc::CompressionLevel>(100);
@@ -0,0 +1,247 @@
+#include "gtest/gtest.h"
+#include "ncutility/ConcurrentQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Tracks live instances to detect leaked or double destroyed elements.
+struct Counted
+{
+    static inline auto liveCount = std::atomic<int>{0};
+
+    int value = 0;
+
+    Counted() noexcept { ++liveCount; }
+    explicit Counted(int v) noexcept : value{v} { ++liveCount; }
+    Counted(const Counted& other) noexcept : value{other.value} { ++liveCount; }
+    Counted(Counted&& other) noexcept : value{other.value} { ++liveCount; }
+    auto operator=(const Counted&) noexcept -> Counted& = default;
+    auto operator=(Counted&&) noexcept -> Counted& = default;
+    ~Counted() noexcept { --liveCount; }
+};
+
+constexpr auto g_stressCount = 200'000u;
+constexpr auto g_threadCount = 4u;
+
+// Values encode their producer so consumers can check per-producer ordering.
+constexpr auto Encode(uint32_t producer, uint32_t sequence) -> uint64_t
+{
+    return (uint64_t{producer} << 32) | sequence;
+}
+} // anonymous namespace
+
+TEST(ConcurrentQueueTest, SpscQueue_pushPop_isFifoAndBounded)
+{
+    auto queue = nc::SpscQueue<std::string>{3};
+    EXPECT_EQ(4u, queue.Capacity());
+    EXPECT_TRUE(queue.TryPush("a"));
+    EXPECT_TRUE(queue.TryEmplace(2u, 'b'));
+    EXPECT_TRUE(queue.TryPush(std::string{"c"}));
+    EXPECT_TRUE(queue.TryPush("d"));
+    EXPECT_FALSE(queue.TryPush("e"));
+    EXPECT_EQ(4u, queue.SizeApprox());
+
+    auto out = std::string{};
+    EXPECT_TRUE(queue.TryPop(out));
+    EXPECT_EQ("a", out);
+    EXPECT_TRUE(queue.TryPop(out));
+    EXPECT_EQ("bb", out);
+    EXPECT_TRUE(queue.TryPush("e"));
+
+    auto rest = std::vector<std::string>{};
+    EXPECT_EQ(3u, queue.TryPopBatch(std::back_inserter(rest), 10));
+    EXPECT_EQ((std::vector<std::string>{"c", "d", "e"}), rest);
+    EXPECT_FALSE(queue.TryPop(out));
+}
+
+TEST(ConcurrentQueueTest, SpscQueue_pushBatch_stopsWhenFull)
+{
+    auto queue = nc::SpscQueue<int>{8};
+    const auto values = std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(8u, queue.TryPushBatch(values.begin(), values.size()));
+    EXPECT_EQ(0u, queue.TryPushBatch(values.begin(), values.size()));
+
+    auto out = std::vector<int>(4);
+    EXPECT_EQ(4u, queue.TryPopBatch(out.begin(), out.size()));
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), out);
+    EXPECT_EQ(2u, queue.TryPushBatch(values.begin() + 8, 2));
+}
+
+TEST(ConcurrentQueueTest, MpmcQueue_pushPop_isFifoAndBounded)
+{
+    auto queue = nc::MpmcQueue<std::unique_ptr<int>>{2};
+    EXPECT_TRUE(queue.TryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.TryEmplace(new int{2}));
+    auto rejected = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.TryPush(std::move(rejected)));
+    EXPECT_NE(nullptr, rejected);
+
+    auto out = std::unique_ptr<int>{};
+    EXPECT_TRUE(queue.TryPop(out));
+    EXPECT_EQ(1, *out);
+    EXPECT_TRUE(queue.TryPop(out));
+    EXPECT_EQ(2, *out);
+    EXPECT_FALSE(queue.TryPop(out));
+}
+
+TEST(ConcurrentQueueTest, MpmcQueue_batches_wrapAroundRing)
+{
+    auto queue = nc::MpmcQueue<int>{4};
+    auto values = std::vector<int>(6);
+    std::iota(values.begin(), values.end(), 0);
+    EXPECT_EQ(4u, queue.TryPushBatch(values.begin(), values.size()));
+
+    auto out = std::vector<int>{};
+    EXPECT_EQ(3u, queue.TryPopBatch(std::back_inserter(out), 3));
+    EXPECT_EQ(2u, queue.TryPushBatch(values.begin() + 4, 2));
+    EXPECT_EQ(3u, queue.TryPopBatch(std::back_inserter(out), 8));
+    EXPECT_EQ(values, out);
+}
+
+TEST(ConcurrentQueueTest, Queues_invalidCapacity_throws)
+{
+    EXPECT_THROW(nc::SpscQueue<int>{0}, nc::NcError);
+    EXPECT_THROW(nc::MpmcQueue<int>{0}, nc::NcError);
+    EXPECT_EQ(2u, nc::MpmcQueue<int>{1}.Capacity());
+}
+
+TEST(ConcurrentQueueTest, Queues_destroyed_releaseRemainingElements)
+{
+    {
+        auto spsc = nc::SpscQueue<Counted>{8};
+        auto mpmc = nc::MpmcQueue<Counted>{8};
+        for (auto i = 0; i < 5; ++i)
+        {
+            spsc.TryEmplace(i);
+            mpmc.TryEmplace(i);
+        }
+
+        auto out = Counted{};
+        spsc.TryPop(out);
+        mpmc.TryPop(out);
+        EXPECT_EQ(9, Counted::liveCount);
+    }
+
+    EXPECT_EQ(0, Counted::liveCount);
+}
+
+TEST(ConcurrentQueueTest, SpscQueue_stress_deliversEverythingInOrder)
+{
+    auto queue = nc::SpscQueue<uint32_t>{256};
+    auto producer = std::thread{[&queue]()
+    {
+        auto batch = std::vector<uint32_t>(32);
+        for (auto next = 0u; next < g_stressCount;)
+        {
+            // Alternate single and batch pushes to exercise both paths.
+            if (next % 3 == 0)
+            {
+                if (queue.TryPush(next))
+                    ++next;
+                else
+                    std::this_thread::yield();
+
+                continue;
+            }
+
+            const auto count = std::min<size_t>(batch.size(), g_stressCount - next);
+            std::iota(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(count), next);
+            const auto pushed = queue.TryPushBatch(batch.begin(), count);
+            next += static_cast<uint32_t>(pushed);
+            if (pushed == 0)
+                std::this_thread::yield();
+        }
+    }};
+
+    auto expected = 0u;
+    auto ordered = true;
+    auto batch = std::vector<uint32_t>(64);
+    while (expected < g_stressCount)
+    {
+        const auto popped = queue.TryPopBatch(batch.begin(), expected % 2 == 0 ? batch.size() : 1);
+        for (auto i = size_t{0}; i < popped; ++i)
+            ordered &= batch[i] == expected++;
+
+        if (popped == 0)
+            std::this_thread::yield();
+    }
+
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(0u, queue.SizeApprox());
+}
+
+TEST(ConcurrentQueueTest, MpmcQueue_stress_deliversEverythingOnceInProducerOrder)
+{
+    constexpr auto perProducer = g_stressCount / g_threadCount;
+    auto queue = nc::MpmcQueue<uint64_t>{128};
+    auto threads = std::vector<std::thread>{};
+    for (auto producer = 0u; producer < g_threadCount; ++producer)
+    {
+        threads.emplace_back([&queue, producer]()
+        {
+            auto batch = std::vector<uint64_t>(16);
+            for (auto next = 0u; next < perProducer;)
+            {
+                const auto count = std::min<size_t>(producer % 2 == 0 ? batch.size() : 1, perProducer - next);
+                for (auto i = size_t{0}; i < count; ++i)
+                    batch[i] = Encode(producer, next + static_cast<uint32_t>(i));
+
+                const auto pushed = queue.TryPushBatch(batch.begin(), count);
+                next += static_cast<uint32_t>(pushed);
+                if (pushed == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    auto consumed = std::atomic<uint32_t>{0};
+    auto seen = std::vector<std::atomic<uint32_t>>(g_stressCount);
+    auto ordered = std::atomic<bool>{true};
+    for (auto consumer = 0u; consumer < g_threadCount; ++consumer)
+    {
+        threads.emplace_back([&, consumer]()
+        {
+            // Each consumer must see any one producer's values in increasing order.
+            auto last = std::vector<int64_t>(g_threadCount, -1);
+            auto batch = std::vector<uint64_t>(16);
+            while (consumed.load(std::memory_order_relaxed) < g_stressCount)
+            {
+                auto popped = size_t{0};
+                if (consumer % 2 == 0)
+                    popped = queue.TryPopBatch(batch.begin(), batch.size());
+                else
+                    popped = queue.TryPop(batch[0]) ? 1 : 0;
+
+                for (auto i = size_t{0}; i < popped; ++i)
+                {
+                    const auto producer = static_cast<uint32_t>(batch[i] >> 32);
+                    const auto sequence = static_cast<uint32_t>(batch[i]);
+                    if (static_cast<int64_t>(sequence) <= last[producer])
+                        ordered = false;
+
+                    last[producer] = sequence;
+                    seen[producer * perProducer + sequence].fetch_add(1, std::memory_order_relaxed);
+                }
+
+                consumed.fetch_add(static_cast<uint32_t>(popped), std::memory_order_relaxed);
+                if (popped == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(std::ranges::all_of(seen, [](const auto& count) { return count.load() == 1u; }));
+    EXPECT_EQ(0u, queue.SizeApprox());
+}
@@ -0,0 +1,192 @@
+#include "gtest/gtest.h"
+#include "ncutility/CookCache.h"
+#include "ncutility/JsonSerialization.h"
+
+#include <fstream>
+#include <future>
+#include <thread>
+
+namespace
+{
+struct Config
+{
+    static constexpr auto JsonMemberNames = std::array{"name", "values", "scale"};
+
+    std::string name;
+    std::vector<int> values;
+    float scale = 1.0f;
+
+    auto operator==(const Config&) const -> bool = default;
+};
+
+// Throws from Deserialize after partially assigning, when value is negative.
+struct Checked
+{
+    std::string name;
+    int value = 0;
+};
+
+void Serialize(std::ostream& stream, const Checked& in)
+{
+    nc::serialize::Serialize(stream, in.name);
+    nc::serialize::Serialize(stream, in.value);
+}
+
+void Deserialize(std::istream& stream, Checked& out)
+{
+    nc::serialize::Deserialize(stream, out.name);
+    nc::serialize::Deserialize(stream, out.value);
+    if (out.value < 0)
+        throw nc::NcError("Negative value.");
+}
+
+constexpr auto g_source = std::string_view{R"({"name": "level", "values": [1, 2, 3], "scale": 0.5})"};
+const auto g_expected = Config{"level", {1, 2, 3}, 0.5f};
+
+class CookCacheTest : public ::testing::Test
+{
+    protected:
+        std::filesystem::path directory;
+        int parseCount = 0;
+
+        void SetUp() override
+        {
+            directory = std::filesystem::temp_directory_path() / "nc_cook_cache_test";
+            std::filesystem::remove_all(directory);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all(directory);
+        }
+
+        auto Load(const nc::CookCache& cache, std::string_view source, Config& out) -> bool
+        {
+            return cache.Load(source, out, [this](std::string_view text, Config& config)
+            {
+                ++parseCount;
+                auto stream = std::istringstream{std::string{text}};
+                nc::serialize::json::Deserialize(stream, config);
+            });
+        }
+};
+} // anonymous namespace
+
+TEST_F(CookCacheTest, Load_firstLoad_parsesAndCaches)
+{
+    const auto cache = nc::CookCache{directory, 1u};
+    auto actual = Config{};
+    EXPECT_FALSE(Load(cache, g_source, actual));
+    EXPECT_EQ(g_expected, actual);
+    EXPECT_EQ(1, parseCount);
+    EXPECT_TRUE(std::filesystem::exists(cache.EntryPath(g_source)));
+}
+
+TEST_F(CookCacheTest, Load_unchangedSource_skipsParsing)
+{
+    auto actual = Config{};
+    Load(nc::CookCache{directory, 1u}, g_source, actual);
+    actual = Config{};
+    EXPECT_TRUE(Load(nc::CookCache{directory, 1u}, g_source, actual));
+    EXPECT_EQ(g_expected, actual);
+    EXPECT_EQ(1, parseCount);
+}
+
+TEST_F(CookCacheTest, Load_changedSource_reparses)
+{
+    const auto cache = nc::CookCache{directory, 1u};
+    auto actual = Config{};
+    Load(cache, g_source, actual);
+    EXPECT_FALSE(Load(cache, R"({"name": "other"})", actual));
+    EXPECT_EQ("other", actual.name);
+    EXPECT_EQ(2, parseCount);
+}
+
+TEST_F(CookCacheTest, Load_versionMismatch_reparsesAndReplaces)
+{
+    auto actual = Config{};
+    Load(nc::CookCache{directory, 1u}, g_source, actual);
+    EXPECT_FALSE(Load(nc::CookCache{directory, 2u}, g_source, actual));
+    EXPECT_TRUE(Load(nc::CookCache{directory, 2u}, g_source, actual));
+    EXPECT_FALSE(Load(nc::CookCache{directory, 1u}, g_source, actual));
+    EXPECT_EQ(g_expected, actual);
+    EXPECT_EQ(3, parseCount);
+}
+
+TEST_F(CookCacheTest, Load_corruptEntry_reparses)
+{
+    const auto cache = nc::CookCache{directory, 1u};
+    auto actual = Config{};
+    Load(cache, g_source, actual);
+    {
+        auto file = std::fstream{cache.EntryPath(g_source), std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(-4, std::ios::end);
+        file.write("\xff\xff\xff\xff", 4);
+    }
+
+    actual = Config{};
+    EXPECT_FALSE(Load(cache, g_source, actual));
+    EXPECT_EQ(g_expected, actual);
+    EXPECT_TRUE(Load(cache, g_source, actual));
+}
+
+TEST_F(CookCacheTest, Load_truncatedEntry_reparses)
+{
+    const auto cache = nc::CookCache{directory, 1u};
+    auto actual = Config{};
+    Load(cache, g_source, actual);
+    std::filesystem::resize_file(cache.EntryPath(g_source), 10);
+    EXPECT_FALSE(Load(cache, g_source, actual));
+    EXPECT_EQ(g_expected, actual);
+}
+
+TEST_F(CookCacheTest, Read_unreadableEntry_returnsFalse)
+{
+    const auto cache = nc::CookCache{directory, 1u};
+    std::filesystem::create_directories(cache.EntryPath(g_source));
+    EXPECT_FALSE(cache.Read(g_source, [](std::istream&) {}));
+
+    auto actual = Config{};
+    EXPECT_FALSE(Load(cache, g_source, actual));
+    EXPECT_EQ(g_expected, actual);
+}
+
+TEST_F(CookCacheTest, Load_entryFailingPartway_parsesIntoOriginalObject)
+{
+    const auto cache = nc::CookCache{directory, 1u};
+    cache.Write(g_source, [](std::ostream& stream) { nc::serialize::Serialize(stream, Checked{"cached", -1}); });
+
+    auto actual = Checked{"original", 0};
+    EXPECT_FALSE(cache.Load(g_source, actual, [](std::string_view, Checked& checked) { checked.value = 7; }));
+    EXPECT_EQ("original", actual.name);
+    EXPECT_EQ(7, actual.value);
+}
+
+TEST_F(CookCacheTest, Write_concurrentWriters_leaveValidEntry)
+{
+    const auto cache = nc::CookCache{directory, 1u};
+    auto writers = std::vector<std::future<void>>{};
+    for (auto i = 0; i < 8; ++i)
+    {
+        writers.push_back(std::async(std::launch::async, [&cache]()
+        {
+            for (auto j = 0; j < 20; ++j)
+                cache.Write(g_source, [](std::ostream& stream) { nc::serialize::Serialize(stream, g_expected); });
+        }));
+    }
+
+    auto reads = 0;
+    auto actual = Config{};
+    while (reads < 100)
+    {
+        if (cache.Read(g_source, [&actual](std::istream& stream) { nc::serialize::Deserialize(stream, actual); }))
+        {
+            EXPECT_EQ(g_expected, actual);
+            ++reads;
+        }
+    }
+
+    for (auto& writer : writers) writer.get();
+    for (const auto& entry : std::filesystem::directory_iterator{directory})
+        EXPECT_EQ(".cooked", entry.path().extension());
+}
@@ -0,0 +1,209 @@
+#include "gtest/gtest.h"
+#include "ncutility/JsonSerialization.h"
+
+#include <cmath>
+#include <deque>
+#include <list>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+
+namespace test
+{
+enum class Team : uint8_t { Red = 1, Blue = 2 };
+
+// Written positionally as an array.
+struct Vec3
+{
+    float x, y, z;
+    auto operator<=>(const Vec3&) const = default;
+};
+
+// Written as an object using its declared member names.
+struct Unit
+{
+    static constexpr auto JsonMemberNames = std::array{"name", "team", "position", "tags", "health", "target"};
+
+    std::string name;
+    Team team;
+    Vec3 position;
+    std::vector<std::string> tags;
+    int health = 100;
+    std::optional<uint32_t> target;
+
+    auto operator==(const Unit&) const -> bool = default;
+};
+
+struct Level
+{
+    static constexpr auto JsonMemberNames = std::array{"units", "spawns", "metadata"};
+
+    std::vector<Unit> units;
+    std::map<int, Vec3> spawns;
+    nlohmann::json metadata;
+
+    auto operator==(const Level&) const -> bool = default;
+};
+
+// Not an aggregate - requires the nlohmann customization point.
+class Color
+{
+    public:
+        Color() = default;
+        explicit Color(std::string hex) : m_hex{std::move(hex)} {}
+        auto Hex() const -> const std::string& { return m_hex; }
+        auto operator==(const Color&) const -> bool = default;
+
+    private:
+        std::string m_hex;
+};
+
+void to_json(nlohmann::json& j, const Color& color)
+{
+    j = nlohmann::json{{"hex", color.Hex()}};
+}
+
+void from_json(const nlohmann::json& j, Color& color)
+{
+    color = Color{j.at("hex").get<std::string>()};
+}
+
+template<class T>
+auto RoundTrip(const T& in) -> T
+{
+    auto stream = std::stringstream{};
+    nc::serialize::json::Serialize(stream, in);
+    auto out = T{};
+    nc::serialize::json::Deserialize(stream, out);
+    return out;
+}
+
+template<class T>
+auto Parse(const std::string& text) -> T
+{
+    auto stream = std::istringstream{text};
+    auto out = T{};
+    nc::serialize::json::Deserialize(stream, out);
+    return out;
+}
+
+template<class T>
+auto Write(const T& in) -> std::string
+{
+    auto stream = std::ostringstream{};
+    nc::serialize::json::Serialize(stream, in);
+    return stream.str();
+}
+} // namespace test
+
+TEST(JsonSerializationTest, Serialize_scalars_writesJson)
+{
+    EXPECT_EQ("true", test::Write(true));
+    EXPECT_EQ("-42", test::Write(-42));
+    EXPECT_EQ("65", test::Write('A'));
+    EXPECT_EQ("2", test::Write(test::Team::Blue));
+    EXPECT_EQ("0.5", test::Write(0.5));
+    EXPECT_EQ("null", test::Write(std::nan("")));
+    EXPECT_EQ("null", test::Write(std::optional<int>{}));
+    EXPECT_EQ("\"a\\\"b\\\\c\\n\\u0001\"", test::Write(std::string{"a\"b\\c\n\x01"}));
+}
+
+TEST(JsonSerializationTest, Serialize_aggregates_writesArraysOrObjects)
+{
+    EXPECT_EQ("[1,2,3]", test::Write(test::Vec3{1.0f, 2.0f, 3.0f}));
+    const auto unit = test::Unit{"a", test::Team::Red, {0.0f, 1.0f, 0.0f}, {"x"}, 5, 7u};
+    EXPECT_EQ(R"({"name":"a","team":1,"position":[0,1,0],"tags":["x"],"health":5,"target":7})", test::Write(unit));
+}
+
+TEST(JsonSerializationTest, RoundTrip_scalars_preservesValues)
+{
+    EXPECT_EQ(true, test::RoundTrip(true));
+    EXPECT_EQ(-123456789012345ll, test::RoundTrip(-123456789012345ll));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), test::RoundTrip(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(0.1f, test::RoundTrip(0.1f));
+    EXPECT_EQ(1e300, test::RoundTrip(1e300));
+    EXPECT_EQ(test::Team::Blue, test::RoundTrip(test::Team::Blue));
+    EXPECT_EQ(std::string{"tab\tquote\"\x1f"}, test::RoundTrip(std::string{"tab\tquote\"\x1f"}));
+    EXPECT_TRUE(std::isnan(test::RoundTrip(std::numeric_limits<float>::infinity())));
+}
+
+TEST(JsonSerializationTest, RoundTrip_containers_preservesValues)
+{
+    const auto vec = std::vector<std::vector<int>>{{1, 2}, {}, {3}};
+    const auto arr = std::array<double, 3>{1.5, -2.0, 0.0};
+    const auto lst = std::list<std::string>{"a", "b"};
+    const auto deq = std::deque<bool>{true, false};
+    const auto set = std::set<int>{5, 1, 3};
+    const auto map = std::map<std::string, std::vector<int>>{{"a", {1}}, {"b", {}}};
+    const auto unorderedMap = std::unordered_map<int64_t, std::string>{{-1, "neg"}, {2, "pos"}};
+    const auto tuple = std::tuple<int, std::string, std::optional<double>>{1, "x", std::nullopt};
+    const auto pair = std::pair<std::string, test::Vec3>{"v", {1.0f, 2.0f, 3.0f}};
+    EXPECT_EQ(vec, test::RoundTrip(vec));
+    EXPECT_EQ(arr, test::RoundTrip(arr));
+    EXPECT_EQ(lst, test::RoundTrip(lst));
+    EXPECT_EQ(deq, test::RoundTrip(deq));
+    EXPECT_EQ(set, test::RoundTrip(set));
+    EXPECT_EQ(map, test::RoundTrip(map));
+    EXPECT_EQ(unorderedMap, test::RoundTrip(unorderedMap));
+    EXPECT_EQ(tuple, test::RoundTrip(tuple));
+    EXPECT_EQ(pair, test::RoundTrip(pair));
+}
+
+TEST(JsonSerializationTest, RoundTrip_nestedAggregates_preservesValues)
+{
+    auto level = test::Level{};
+    level.units.push_back(test::Unit{"scout", test::Team::Red, {1.0f, 2.0f, 3.0f}, {"fast", "light"}, 50, std::nullopt});
+    level.units.push_back(test::Unit{"tank", test::Team::Blue, {-1.0f, 0.0f, 0.5f}, {}, 400, 0u});
+    level.spawns = {{0, {0.0f, 0.0f, 0.0f}}, {7, {10.0f, 0.0f, -10.0f}}};
+    level.metadata = nlohmann::json{{"author", "test"}, {"version", 3}, {"tags", {1, "two", nullptr}}};
+    EXPECT_EQ(level, test::RoundTrip(level));
+}
+
+TEST(JsonSerializationTest, RoundTrip_customFromJson_usesAdlOverloads)
+{
+    const auto colors = std::vector<test::Color>{test::Color{"#ff0000"}, test::Color{"#00ff00"}};
+    EXPECT_EQ(colors, test::RoundTrip(colors));
+}
+
+TEST(JsonSerializationTest, Deserialize_namedAggregate_ignoresUnknownAndMissingKeys)
+{
+    const auto actual = test::Parse<test::Unit>(R"({
+        "unknown": {"nested": [1, [2, {"x": 3}]]},
+        "name": "a",
+        "extra": null,
+        "position": [1, 2, 3]
+    })");
+
+    EXPECT_EQ("a", actual.name);
+    EXPECT_EQ((test::Vec3{1.0f, 2.0f, 3.0f}), actual.position);
+    EXPECT_EQ(100, actual.health);
+    EXPECT_FALSE(actual.target.has_value());
+}
+
+TEST(JsonSerializationTest, Deserialize_existingContainers_assignsRatherThanAppends)
+{
+    auto stream = std::istringstream{R"([["a", "b"], ["c"]] {"x": 1})"};
+    auto nested = std::vector<std::vector<std::string>>{{"old", "old", "old"}, {}, {"old"}};
+    auto map = std::map<std::string, int>{{"old", 0}};
+    nc::serialize::json::Deserialize(stream, nested);
+    nc::serialize::json::Deserialize(stream, map);
+    EXPECT_EQ((std::vector<std::vector<std::string>>{{"a", "b"}, {"c"}}), nested);
+    EXPECT_EQ((std::map<std::string, int>{{"x", 1}}), map);
+}
+
+TEST(JsonSerializationTest, Deserialize_mismatchedInput_throws)
+{
+    EXPECT_THROW(test::Parse<int>("\"text\""), nc::NcError);
+    EXPECT_THROW(test::Parse<int>("1.5"), nc::NcError);
+    EXPECT_THROW(test::Parse<uint8_t>("256"), nc::NcError);
+    EXPECT_THROW(test::Parse<unsigned>("-1"), nc::NcError);
+    EXPECT_THROW(test::Parse<test::Vec3>("[1, 2]"), nc::NcError);
+    EXPECT_THROW(test::Parse<test::Vec3>("[1, 2, 3, 4]"), nc::NcError);
+    EXPECT_THROW((test::Parse<std::array<int, 2>>("[1]")), nc::NcError);
+    EXPECT_THROW(test::Parse<test::Vec3>(R"({"x": 1})"), nc::NcError);
+    EXPECT_THROW((test::Parse<std::map<int, int>>(R"({"a": 1})")), nc::NcError);
+    EXPECT_THROW(test::Parse<std::vector<int>>("[1, 2"), nc::NcError);
+    EXPECT_THROW(test::Parse<std::string>(""), nc::NcError);
+}
@@ -0,0 +1,250 @@
+#include "gtest/gtest.h"
+#include "ncutility/MemoryResource.h"
+#include "ncutility/NcError.h"
+
+#include <list>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Forwards to the global heap, counting calls and outstanding bytes.
+class CountingResource : public std::pmr::memory_resource
+{
+    public:
+        size_t allocations = 0;
+        size_t outstanding = 0;
+
+    protected:
+        auto do_allocate(size_t bytes, size_t alignment) -> void* override
+        {
+            ++allocations;
+            outstanding += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            outstanding -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+};
+
+auto IsAligned(const void* ptr, size_t alignment) -> bool
+{
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+} // anonymous namespace
+
+TEST(MemoryResourceTest, Arena_allocate_bumpsWithinBlock)
+{
+    auto upstream = CountingResource{};
+    auto arena = nc::ArenaResource{1024, &upstream};
+    EXPECT_EQ(0u, upstream.allocations);
+
+    const auto a = static_cast<std::byte*>(arena.allocate(10, 1));
+    const auto b = static_cast<std::byte*>(arena.allocate(8, 8));
+    const auto c = arena.allocate(64, 64);
+    EXPECT_EQ(1u, upstream.allocations);
+    EXPECT_EQ(a + 16, b);
+    EXPECT_TRUE(IsAligned(c, 64));
+    EXPECT_GE(arena.BytesAllocated(), 82u);
+    EXPECT_EQ(1024u, arena.Capacity());
+}
+
+TEST(MemoryResourceTest, Arena_deallocateMostRecent_rollsBack)
+{
+    auto arena = nc::ArenaResource{1024};
+    const auto a = arena.allocate(32, 8);
+    const auto b = arena.allocate(32, 8);
+    arena.deallocate(a, 32, 8); // not the most recent, ignored
+    EXPECT_EQ(64u, arena.BytesAllocated());
+    arena.deallocate(b, 32, 8);
+    EXPECT_EQ(32u, arena.BytesAllocated());
+    EXPECT_EQ(b, arena.allocate(32, 8));
+}
+
+TEST(MemoryResourceTest, Arena_overflow_growsAndLargeRequestsFit)
+{
+    auto upstream = CountingResource{};
+    auto arena = nc::ArenaResource{256, &upstream};
+    static_cast<void>(arena.allocate(200, 8));
+    static_cast<void>(arena.allocate(200, 8));
+    const auto large = arena.allocate(10'000, 256);
+    EXPECT_TRUE(IsAligned(large, 256));
+    EXPECT_EQ(3u, upstream.allocations);
+    EXPECT_GE(arena.Capacity(), 10'456u);
+}
+
+TEST(MemoryResourceTest, Arena_reset_coalescesAndStopsUpstreamAllocation)
+{
+    auto upstream = CountingResource{};
+    auto arena = nc::ArenaResource{128, &upstream};
+    const auto frame = [&arena]()
+    {
+        auto values = std::pmr::vector<int>{&arena};
+        for (auto i = 0; i < 1000; ++i)
+            values.push_back(i);
+
+        auto text = std::pmr::string{"a string long enough to avoid the small string buffer", &arena};
+        EXPECT_EQ(999, values.back());
+    };
+
+    frame();
+    arena.Reset();
+    EXPECT_EQ(0u, arena.BytesAllocated());
+    const auto allocationsAfterFirstFrame = upstream.allocations;
+    for (auto i = 0; i < 3; ++i)
+    {
+        frame();
+        arena.Reset();
+    }
+
+    EXPECT_EQ(allocationsAfterFirstFrame, upstream.allocations);
+
+    arena.Release();
+    EXPECT_EQ(0u, arena.Capacity());
+    EXPECT_EQ(0u, upstream.outstanding);
+}
+
+TEST(MemoryResourceTest, Arena_destroyed_returnsBlocks)
+{
+    auto upstream = CountingResource{};
+    {
+        auto arena = nc::ArenaResource{64, &upstream};
+        static_cast<void>(arena.allocate(1000, 8));
+        static_cast<void>(arena.allocate(1000, 8));
+        EXPECT_NE(0u, upstream.outstanding);
+    }
+
+    EXPECT_EQ(0u, upstream.outstanding);
+}
+
+TEST(MemoryResourceTest, FrameAllocator_local_isPerThread)
+{
+    auto frames = nc::FrameAllocator{1024};
+    auto& mainArena = frames.Local();
+    EXPECT_EQ(&mainArena, &frames.Local());
+
+    auto* workerArena = static_cast<nc::ArenaResource*>(nullptr);
+    auto thread = std::thread{[&]()
+    {
+        workerArena = &frames.Local();
+        static_cast<void>(workerArena->allocate(100, 8));
+    }};
+
+    thread.join();
+    EXPECT_NE(&mainArena, workerArena);
+    static_cast<void>(mainArena.allocate(50, 8));
+    EXPECT_GE(frames.BytesAllocated(), 150u);
+
+    frames.Reset();
+    EXPECT_EQ(0u, frames.BytesAllocated());
+}
+
+TEST(MemoryResourceTest, FrameAllocator_multipleInstances_keepSeparateArenas)
+{
+    auto first = nc::FrameAllocator{};
+    auto second = nc::FrameAllocator{};
+    auto& firstArena = first.Local();
+    auto& secondArena = second.Local();
+    EXPECT_NE(&firstArena, &secondArena);
+    EXPECT_EQ(&firstArena, &first.Local());
+    EXPECT_EQ(&secondArena, &second.Local());
+}
+
+TEST(MemoryResourceTest, FrameAllocator_concurrentFrames_allocateIndependently)
+{
+    auto frames = nc::FrameAllocator{256};
+    for (auto frame = 0; frame < 3; ++frame)
+    {
+        auto threads = std::vector<std::thread>{};
+        for (auto t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&frames, t]()
+            {
+                auto values = std::pmr::vector<int>{&frames.Local()};
+                for (auto i = 0; i < 500; ++i)
+                    values.push_back(i * t);
+
+                EXPECT_EQ(499 * t, values.back());
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        frames.Reset();
+    }
+
+    frames.Release();
+    EXPECT_EQ(0u, frames.BytesAllocated());
+}
+
+TEST(MemoryResourceTest, Pool_freedBlocks_areReused)
+{
+    auto upstream = CountingResource{};
+    auto pool = nc::PoolResource{24, 4, &upstream};
+    EXPECT_EQ(24u, pool.BlockSize());
+    EXPECT_EQ(8u, pool.BlockAlignment());
+
+    auto blocks = std::vector<void*>{};
+    for (auto i = 0; i < 5; ++i)
+        blocks.push_back(pool.allocate(24, 8));
+
+    EXPECT_EQ(2u, upstream.allocations);
+    EXPECT_EQ(5u, std::set<void*>(blocks.begin(), blocks.end()).size());
+
+    pool.deallocate(blocks[1], 24, 8);
+    EXPECT_EQ(blocks[1], pool.allocate(16, 4));
+    EXPECT_EQ(2u, upstream.allocations);
+
+    pool.Release();
+    EXPECT_EQ(0u, upstream.outstanding);
+}
+
+TEST(MemoryResourceTest, Pool_unsuitableRequests_forwardToUpstream)
+{
+    auto upstream = CountingResource{};
+    auto pool = nc::PoolResource{16, 8, &upstream};
+    const auto large = pool.allocate(64, 8);
+    const auto overAligned = pool.allocate(16, 64);
+    EXPECT_EQ(2u, upstream.allocations);
+    EXPECT_EQ(80u, upstream.outstanding);
+    EXPECT_TRUE(IsAligned(overAligned, 64));
+
+    pool.deallocate(large, 64, 8);
+    pool.deallocate(overAligned, 16, 64);
+    EXPECT_EQ(0u, upstream.outstanding);
+}
+
+TEST(MemoryResourceTest, Pool_nodeContainer_reusesNodes)
+{
+    auto upstream = CountingResource{};
+    auto pool = nc::PoolResource{sizeof(int) + 2 * sizeof(void*), 32, &upstream};
+    auto values = std::pmr::list<int>{&pool};
+    for (auto round = 0; round < 4; ++round)
+    {
+        for (auto i = 0; i < 32; ++i)
+            values.push_back(i);
+
+        values.clear();
+    }
+
+    EXPECT_EQ(1u, upstream.allocations);
+}
+
+TEST(MemoryResourceTest, Pool_invalidParameters_throws)
+{
+    EXPECT_THROW(nc::PoolResource(0), nc::NcError);
+    EXPECT_THROW(nc::PoolResource(16, 0), nc::NcError);
+    EXPECT_THROW(nc::PoolResource(1024, SIZE_MAX / 512), nc::NcError);
+}
@@ -0,0 +1,173 @@
+#include "gtest/gtest.h"
+#include "ncutility/Algorithm.h"
+#include "ncutility/BinarySerialization.h"
+#include "ncutility/SlotMap.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct Level
+{
+    std::string name;
+    nc::SlotMap<int> entities;
+};
+} // anonymous namespace
+
+TEST(SlotMapTest, Insert_returnsResolvableHandles)
+{
+    auto map = nc::SlotMap<std::string>{};
+    const auto a = map.Insert("a");
+    const auto b = map.Emplace(3u, 'b');
+    EXPECT_EQ(2u, map.size());
+    EXPECT_NE(a, b);
+    EXPECT_TRUE(map.Contains(a));
+    EXPECT_EQ("a", map.Get(a));
+    EXPECT_EQ("bbb", *map.TryGet(b));
+    EXPECT_FALSE(map.Contains(nc::SlotHandle{}));
+    EXPECT_EQ(nullptr, map.TryGet(nc::SlotHandle{}));
+}
+
+TEST(SlotMapTest, Erase_invalidatesHandleAndKeepsOthers)
+{
+    auto map = nc::SlotMap<int>{};
+    const auto a = map.Insert(1);
+    const auto b = map.Insert(2);
+    const auto c = map.Insert(3);
+
+    EXPECT_TRUE(map.Erase(a));
+    EXPECT_FALSE(map.Erase(a));
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_THROW(map.Get(a), nc::NcError);
+    EXPECT_EQ(2, map.Get(b));
+    EXPECT_EQ(3, map.Get(c));
+
+    // The last value fills the gap, so storage stays dense.
+    EXPECT_EQ((std::vector<int>{3, 2}), std::vector<int>(map.begin(), map.end()));
+}
+
+TEST(SlotMapTest, Insert_reusesSlotWithNewGeneration)
+{
+    auto map = nc::SlotMap<int>{};
+    const auto stale = map.Insert(1);
+    map.Erase(stale);
+    const auto fresh = map.Insert(2);
+    EXPECT_EQ(stale.index, fresh.index);
+    EXPECT_NE(stale.generation, fresh.generation);
+    EXPECT_FALSE(map.Contains(stale));
+    EXPECT_EQ(2, map.Get(fresh));
+}
+
+TEST(SlotMapTest, Clear_invalidatesAllHandles)
+{
+    auto map = nc::SlotMap<int>{};
+    const auto handles = std::vector{map.Insert(1), map.Insert(2), map.Insert(3)};
+    map.Clear();
+    EXPECT_TRUE(map.empty());
+    for (auto handle : handles)
+        EXPECT_FALSE(map.Contains(handle));
+
+    map.Insert(4);
+    EXPECT_EQ(1u, map.size());
+}
+
+TEST(SlotMapTest, Emplace_throwingConstructor_leavesMapUnchanged)
+{
+    struct Throws
+    {
+        explicit Throws(bool fail) { if (fail) throw std::runtime_error{"fail"}; }
+    };
+
+    auto map = nc::SlotMap<Throws>{};
+    const auto a = map.Emplace(false);
+    EXPECT_THROW(map.Emplace(true), std::runtime_error);
+    EXPECT_EQ(1u, map.size());
+    EXPECT_TRUE(map.Contains(a));
+    const auto b = map.Emplace(false);
+    EXPECT_TRUE(map.Contains(b));
+    EXPECT_EQ(b, map.HandleAt(1));
+}
+
+TEST(SlotMapTest, Enumerate_mapsDenseIndicesToHandles)
+{
+    auto map = nc::SlotMap<int>{};
+    const auto a = map.Insert(10);
+    map.Erase(map.Insert(20));
+    const auto c = map.Insert(30);
+
+    auto handles = std::vector<nc::SlotHandle>{};
+    for (auto [index, value] : nc::algo::Enumerate(map))
+    {
+        value += 1;
+        handles.push_back(map.HandleAt(index));
+    }
+
+    EXPECT_EQ((std::vector{a, c}), handles);
+    EXPECT_EQ(11, map.Get(a));
+    EXPECT_EQ(31, map.Get(c));
+}
+
+TEST(SlotMapTest, Serialize_roundTrip_preservesHandles)
+{
+    auto map = nc::SlotMap<std::string>{};
+    const auto a = map.Insert("first");
+    const auto b = map.Insert("second");
+    const auto c = map.Insert("third");
+    map.Erase(b);
+
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, map);
+    EXPECT_EQ(static_cast<size_t>(stream.tellp()), nc::serialize::SerializedSize(map));
+
+    auto out = nc::SlotMap<std::string>{};
+    nc::serialize::Deserialize(stream, out);
+    EXPECT_EQ(2u, out.size());
+    EXPECT_EQ("first", out.Get(a));
+    EXPECT_EQ("third", out.Get(c));
+    EXPECT_FALSE(out.Contains(b));
+
+    // Freed slots are still reused after a round trip.
+    const auto d = out.Insert("fourth");
+    EXPECT_EQ(b.index, d.index);
+    EXPECT_FALSE(out.Contains(b));
+}
+
+TEST(SlotMapTest, Serialize_nested_roundTrips)
+{
+    auto level = Level{"level", {}};
+    const auto a = level.entities.Insert(1);
+    const auto b = level.entities.Insert(2);
+    level.entities.Erase(a);
+    auto maps = std::vector<nc::SlotMap<int>>(2);
+    const auto c = maps[1].Insert(3);
+
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, level);
+    nc::serialize::Serialize(stream, maps);
+    EXPECT_EQ(static_cast<size_t>(stream.tellp()), nc::serialize::SerializedSize(level) + nc::serialize::SerializedSize(maps));
+
+    auto outLevel = Level{};
+    auto outMaps = std::vector<nc::SlotMap<int>>{};
+    nc::serialize::Deserialize(stream, outLevel);
+    nc::serialize::Deserialize(stream, outMaps);
+    EXPECT_EQ("level", outLevel.name);
+    EXPECT_FALSE(outLevel.entities.Contains(a));
+    EXPECT_EQ(2, outLevel.entities.Get(b));
+    ASSERT_EQ(2u, outMaps.size());
+    EXPECT_TRUE(outMaps[0].empty());
+    EXPECT_EQ(3, outMaps[1].Get(c));
+}
+
+TEST(SlotMapTest, Deserialize_inconsistentStream_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, std::vector<std::pair<uint32_t, uint32_t>>{{0u, 1u}});
+    nc::serialize::Serialize(stream, std::vector<uint32_t>{});
+    nc::serialize::Serialize(stream, std::vector<int>{});
+
+    auto map = nc::SlotMap<int>{};
+    EXPECT_THROW(nc::serialize::Deserialize(stream, map), nc::NcError);
+}
@@ -0,0 +1,163 @@
+#include "gtest/gtest.h"
+#include "ncutility/Algorithm.h"
+#include "ncutility/BinarySerialization.h"
+#include "ncutility/SmallVector.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST(SmallVectorTest, PushBack_withinInlineCapacity_doesNotAllocate)
+{
+    auto values = nc::SmallVector<int, 4>{};
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(4u, values.capacity());
+    for (auto i = 0; i < 4; ++i)
+        values.push_back(i);
+
+    EXPECT_TRUE(values.IsInline());
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), std::vector<int>(values.begin(), values.end()));
+}
+
+TEST(SmallVectorTest, PushBack_beyondInlineCapacity_spillsToHeap)
+{
+    auto values = nc::SmallVector<std::string, 2>{"a", "b"};
+    values.push_back("c");
+    EXPECT_FALSE(values.IsInline());
+    EXPECT_GE(values.capacity(), 3u);
+    EXPECT_EQ("c", values.back());
+
+    values.resize(1);
+    values.shrink_to_fit();
+    EXPECT_TRUE(values.IsInline());
+    EXPECT_EQ("a", values.front());
+}
+
+TEST(SmallVectorTest, EmplaceBack_referenceToOwnElementWhileGrowing_copiesValue)
+{
+    auto values = nc::SmallVector<std::string, 2>{"first", "second"};
+    values.push_back(values[0]);
+    values.emplace_back(values[1]);
+    EXPECT_EQ((std::vector<std::string>{"first", "second", "first", "second"}), std::vector<std::string>(values.begin(), values.end()));
+}
+
+TEST(SmallVectorTest, InsertAndErase_matchStdVector)
+{
+    auto values = nc::SmallVector<int, 3>{1, 5};
+    auto expected = std::vector<int>{1, 5};
+
+    values.insert(values.begin() + 1, 3);
+    expected.insert(expected.begin() + 1, 3);
+    values.insert(values.end(), 2, 9);
+    expected.insert(expected.end(), 2, 9);
+    const auto extra = std::vector<int>{7, 8};
+    values.insert(values.begin(), extra.begin(), extra.end());
+    expected.insert(expected.begin(), extra.begin(), extra.end());
+    const auto it = values.emplace(values.begin() + 2, 4);
+    EXPECT_EQ(4, *it);
+    expected.emplace(expected.begin() + 2, 4);
+    EXPECT_EQ(expected, std::vector<int>(values.begin(), values.end()));
+
+    values.erase(values.begin());
+    expected.erase(expected.begin());
+    values.erase(values.begin() + 1, values.begin() + 3);
+    expected.erase(expected.begin() + 1, expected.begin() + 3);
+    EXPECT_EQ(2u, nc::erase(values, 9));
+    std::erase(expected, 9);
+    EXPECT_EQ(expected, std::vector<int>(values.begin(), values.end()));
+}
+
+TEST(SmallVectorTest, CopyAndMove_preserveContents)
+{
+    for (auto count : {2u, 6u})
+    {
+        auto source = nc::SmallVector<std::unique_ptr<int>, 4>{};
+        for (auto i = 0u; i < count; ++i)
+            source.push_back(std::make_unique<int>(static_cast<int>(i)));
+
+        const auto heapData = source.data();
+        auto moved = std::move(source);
+        EXPECT_TRUE(source.empty());
+        EXPECT_EQ(count, moved.size());
+        EXPECT_EQ(count > 4u, moved.data() == heapData);
+        EXPECT_EQ(static_cast<int>(count - 1), *moved.back());
+
+        auto assigned = nc::SmallVector<std::unique_ptr<int>, 4>{};
+        assigned.push_back(nullptr);
+        assigned = std::move(moved);
+        EXPECT_EQ(count, assigned.size());
+    }
+
+    const auto original = nc::SmallVector<std::string, 2>{"x", "y", "z"};
+    auto copy = original;
+    EXPECT_EQ(original, copy);
+    copy[0] = "w";
+    EXPECT_LT(copy, original);
+    swap(copy, copy);
+    auto other = nc::SmallVector<std::string, 2>{"q"};
+    other.swap(copy);
+    EXPECT_EQ("w", other[0]);
+    EXPECT_EQ("q", copy.at(0));
+    EXPECT_THROW(copy.at(1), std::out_of_range);
+}
+
+TEST(SmallVectorTest, Resize_valueInitializesNewElements)
+{
+    auto values = nc::SmallVector<int, 2>(3);
+    EXPECT_EQ((std::vector<int>{0, 0, 0}), std::vector<int>(values.begin(), values.end()));
+    values.resize(5, 7);
+    EXPECT_EQ(7, values[4]);
+    values.assign({1, 2});
+    EXPECT_EQ(2u, values.size());
+    values.clear();
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(SmallVectorTest, Serialize_matchesStdVectorEncoding)
+{
+    const auto trivial = nc::SmallVector<uint32_t, 4>{1u, 2u, 3u, 4u, 5u};
+    const auto nonTrivial = nc::SmallVector<std::string, 2>{"a", "bc"};
+
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, trivial);
+    nc::serialize::Serialize(stream, nonTrivial);
+    EXPECT_EQ(nc::serialize::SerializedSize(trivial) + nc::serialize::SerializedSize(nonTrivial), stream.str().size());
+
+    auto expected = std::stringstream{};
+    nc::serialize::Serialize(expected, std::vector<uint32_t>(trivial.begin(), trivial.end()));
+    nc::serialize::Serialize(expected, std::vector<std::string>(nonTrivial.begin(), nonTrivial.end()));
+    EXPECT_EQ(expected.str(), stream.str());
+
+    auto trivialOut = nc::SmallVector<uint32_t, 4>{};
+    auto nonTrivialOut = nc::SmallVector<std::string, 2>{};
+    nc::serialize::Deserialize(stream, trivialOut);
+    nc::serialize::Deserialize(stream, nonTrivialOut);
+    EXPECT_EQ(trivial, trivialOut);
+    EXPECT_EQ(nonTrivial, nonTrivialOut);
+}
+
+TEST(SmallVectorTest, Serialize_bitStream_roundTrips)
+{
+    const auto in = nc::SmallVector<int16_t, 4>{-1, 2, -3};
+    auto writer = nc::serialize::BitWriter{};
+    nc::serialize::Serialize(writer, in);
+    const auto bytes = writer.Finish();
+
+    auto reader = nc::serialize::BitReader{bytes};
+    auto out = nc::SmallVector<int16_t, 4>{};
+    nc::serialize::Deserialize(reader, out);
+    EXPECT_EQ(in, out);
+}
+
+TEST(SmallVectorTest, Transform_intoSmallVector_writesOutput)
+{
+    const auto input = std::vector<int>{1, 2, 3};
+    auto output = nc::SmallVector<float, 4>(input.size());
+    nc::algo::Transform(input, output, [](int i) { return static_cast<float>(i) * 0.5f; });
+    EXPECT_EQ((nc::SmallVector<float, 4>{0.5f, 1.0f, 1.5f}), output);
+
+    auto large = nc::SmallVector<int, 8>(10'000, 2);
+    nc::algo::Transform(nc::algo::ParallelPolicy{.minChunkSize = 100}, large, large, [](int i) { return i * 3; });
+    EXPECT_TRUE(std::ranges::all_of(large, [](int i) { return i == 6; }));
+}
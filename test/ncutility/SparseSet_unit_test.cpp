@@ -0,0 +1,179 @@
+#include "gtest/gtest.h"
+#include "ncutility/Algorithm.h"
+#include "ncutility/BinarySerialization.h"
+#include "ncutility/SparseSet.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct Scene
+{
+    std::string name;
+    nc::SparseSet<float> weights;
+};
+} // anonymous namespace
+
+TEST(SparseSetTest, Emplace_storesValuesDensely)
+{
+    auto set = nc::SparseSet<std::string>{};
+    set.Emplace(100'000u, "far");
+    set.Insert(3u, "near");
+    EXPECT_EQ(2u, set.size());
+    EXPECT_TRUE(set.Contains(3u));
+    EXPECT_FALSE(set.Contains(4u));
+    EXPECT_FALSE(set.Contains(1'000'000u));
+    EXPECT_EQ("far", set.Get(100'000u));
+    EXPECT_EQ("near", *set.TryGet(3u));
+    EXPECT_EQ(nullptr, set.TryGet(4u));
+    EXPECT_EQ(1u, set.IndexOf(3u));
+    EXPECT_EQ((std::vector<uint32_t>{100'000u, 3u}), std::vector<uint32_t>(set.Keys().begin(), set.Keys().end()));
+    EXPECT_EQ(set.data() + 1, &set.Get(3u));
+}
+
+TEST(SparseSetTest, Emplace_duplicateOrReservedKey_throws)
+{
+    auto set = nc::SparseSet<int>{};
+    set.Insert(1u, 1);
+    EXPECT_THROW(set.Insert(1u, 2), nc::NcError);
+    EXPECT_THROW(set.Insert(UINT32_MAX, 2), nc::NcError);
+    EXPECT_EQ(1, set.Get(1u));
+    EXPECT_THROW(set.Get(2u), nc::NcError);
+}
+
+TEST(SparseSetTest, Erase_swapsLastIntoGap)
+{
+    auto set = nc::SparseSet<int, uint16_t, 16>{};
+    for (auto key = uint16_t{0}; key < 5; ++key)
+        set.Insert(static_cast<uint16_t>(key * 10), key);
+
+    EXPECT_TRUE(set.Erase(10));
+    EXPECT_FALSE(set.Erase(10));
+    EXPECT_FALSE(set.Erase(11));
+    EXPECT_EQ((std::vector<int>{0, 4, 2, 3}), std::vector<int>(set.begin(), set.end()));
+    EXPECT_EQ(4, set.Get(40));
+    EXPECT_EQ(1u, set.IndexOf(40));
+
+    set.Erase(30);
+    EXPECT_EQ((std::vector<int>{0, 4, 2}), std::vector<int>(set.begin(), set.end()));
+}
+
+TEST(SparseSetTest, Clear_removesAllKeys)
+{
+    auto set = nc::SparseSet<int>{};
+    set.Insert(5u, 5);
+    set.Insert(9000u, 9);
+    set.Clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.Contains(5u));
+    EXPECT_FALSE(set.Contains(9000u));
+    set.Insert(5u, 6);
+    EXPECT_EQ(6, set.Get(5u));
+}
+
+TEST(SparseSetTest, Enumerate_walksKeysAndValuesInStep)
+{
+    auto set = nc::SparseSet<float>{};
+    set.Insert(7u, 1.0f);
+    set.Insert(2u, 2.0f);
+    for (auto [index, value] : nc::algo::Enumerate(set))
+        value *= static_cast<float>(set.Keys()[index]);
+
+    EXPECT_EQ(7.0f, set.Get(7u));
+    EXPECT_EQ(4.0f, set.Get(2u));
+}
+
+TEST(SparseSetTest, Serialize_roundTrip_preservesOrder)
+{
+    auto set = nc::SparseSet<std::string>{};
+    set.Insert(40u, "a");
+    set.Insert(5000u, "b");
+    set.Insert(2u, "c");
+    set.Erase(40u);
+
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, set);
+    EXPECT_EQ(static_cast<size_t>(stream.tellp()), nc::serialize::SerializedSize(set));
+
+    auto out = nc::SparseSet<std::string>{};
+    out.Insert(40u, "stale");
+    nc::serialize::Deserialize(stream, out);
+    EXPECT_EQ((std::vector<std::string>{"c", "b"}), std::vector<std::string>(out.begin(), out.end()));
+    EXPECT_FALSE(out.Contains(40u));
+    EXPECT_EQ("b", out.Get(5000u));
+    EXPECT_EQ("c", out.Get(2u));
+}
+
+TEST(SparseSetTest, Serialize_nested_roundTrips)
+{
+    auto scene = Scene{"scene", {}};
+    scene.weights.Insert(7u, 0.5f);
+    scene.weights.Insert(9000u, 2.0f);
+    auto sets = std::vector<nc::SparseSet<float>>(2);
+    sets[0].Insert(1u, 1.0f);
+
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, scene);
+    nc::serialize::Serialize(stream, sets);
+    EXPECT_EQ(static_cast<size_t>(stream.tellp()), nc::serialize::SerializedSize(scene) + nc::serialize::SerializedSize(sets));
+
+    auto outScene = Scene{};
+    auto outSets = std::vector<nc::SparseSet<float>>{};
+    nc::serialize::Deserialize(stream, outScene);
+    nc::serialize::Deserialize(stream, outSets);
+    EXPECT_EQ("scene", outScene.name);
+    EXPECT_EQ(0.5f, outScene.weights.Get(7u));
+    EXPECT_EQ(2.0f, outScene.weights.Get(9000u));
+    ASSERT_EQ(2u, outSets.size());
+    EXPECT_EQ(1.0f, outSets[0].Get(1u));
+    EXPECT_TRUE(outSets[1].empty());
+}
+
+TEST(SparseSetTest, Deserialize_pagesExceedingBudget_throws)
+{
+    const auto read = [](const std::vector<uint32_t>& keys, size_t budget)
+    {
+        auto stream = std::stringstream{};
+        nc::serialize::Serialize(stream, keys);
+        nc::serialize::Serialize(stream, std::vector<int>(keys.size()));
+        auto context = nc::serialize::DeserializationContext{stream, {.maxAllocationBytes = budget}};
+        auto set = nc::SparseSet<int>{};
+        nc::serialize::Deserialize(stream, set);
+        return set.size();
+    };
+
+    // A single large key requires a page table entry for every page below it.
+    EXPECT_THROW(read({0u, 4'000'000'000u}, 64 * 1024), nc::NcError);
+
+    // Scattered keys each require their own page.
+    auto scattered = std::vector<uint32_t>{};
+    for (auto i = 0u; i < 16u; ++i)
+        scattered.push_back(i * 4096u);
+
+    EXPECT_THROW(read(scattered, 64 * 1024), nc::NcError);
+    EXPECT_EQ(16u, read(scattered, 1024 * 1024));
+}
+
+TEST(SparseSetTest, Deserialize_reservedKey_throws)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, std::vector<uint32_t>{1u, UINT32_MAX});
+    nc::serialize::Serialize(stream, std::vector<int>{1, 2});
+    auto set = nc::SparseSet<int>{};
+    EXPECT_THROW(nc::serialize::Deserialize(stream, set), nc::NcError);
+}
+
+TEST(SparseSetTest, Deserialize_duplicateKeys_throwsAndKeepsContents)
+{
+    auto stream = std::stringstream{};
+    nc::serialize::Serialize(stream, std::vector<uint32_t>{1u, 1u});
+    nc::serialize::Serialize(stream, std::vector<int>{1, 2});
+
+    auto set = nc::SparseSet<int>{};
+    set.Insert(3u, 3);
+    EXPECT_THROW(nc::serialize::Deserialize(stream, set), nc::NcError);
+    EXPECT_EQ(1u, set.size());
+    EXPECT_EQ(3, set.Get(3u));
+}
@@ -0,0 +1,203 @@
+#include "gtest/gtest.h"
+#include "ncutility/TaskScheduler.h"
+
+#include <numeric>
+#include <stdexcept>
+
+namespace
+{
+// Recursive fork-join, exercising nested waits and stealing from worker deques.
+auto Fibonacci(nc::TaskScheduler& scheduler, int n) -> int
+{
+    if (n < 12)
+        return n < 2 ? n : Fibonacci(scheduler, n - 1) + Fibonacci(scheduler, n - 2);
+
+    auto left = 0;
+    auto task = scheduler.Schedule([&]() { left = Fibonacci(scheduler, n - 1); });
+    const auto right = Fibonacci(scheduler, n - 2);
+    scheduler.Wait(task);
+    return left + right;
+}
+} // anonymous namespace
+
+TEST(TaskSchedulerTest, Schedule_singleTask_runsOnce)
+{
+    auto scheduler = nc::TaskScheduler{2};
+    auto count = std::atomic<int>{0};
+    auto task = scheduler.Schedule([&count]() { ++count; });
+    scheduler.Wait(task);
+    EXPECT_TRUE(task.IsDone());
+    EXPECT_EQ(1, count);
+}
+
+TEST(TaskSchedulerTest, Schedule_manyTasks_allRun)
+{
+    auto scheduler = nc::TaskScheduler{4};
+    auto count = std::atomic<int>{0};
+    auto tasks = std::vector<nc::TaskHandle>{};
+    for (auto i = 0; i < 1000; ++i)
+        tasks.push_back(scheduler.Schedule([&count]() { ++count; }));
+
+    for (const auto& task : tasks) scheduler.Wait(task);
+    EXPECT_EQ(1000, count);
+}
+
+TEST(TaskSchedulerTest, Schedule_noWorkers_runsOnWait)
+{
+    auto scheduler = nc::TaskScheduler{0};
+    auto ran = false;
+    auto task = scheduler.Schedule([&ran]() { ran = true; });
+    EXPECT_FALSE(task.IsDone());
+    scheduler.Wait(task);
+    EXPECT_TRUE(ran);
+}
+
+TEST(TaskSchedulerTest, Schedule_withDependencies_runsAfterDependencies)
+{
+    auto scheduler = nc::TaskScheduler{4};
+    auto order = std::vector<int>{};
+    auto mutex = std::mutex{};
+    auto record = [&](int value)
+    {
+        return [&, value]()
+        {
+            auto lock = std::lock_guard{mutex};
+            order.push_back(value);
+        };
+    };
+
+    auto a = scheduler.Schedule(record(1));
+    auto b = scheduler.Schedule(record(2), {a});
+    auto c = scheduler.Schedule(record(3), {a});
+    auto d = scheduler.Schedule(record(4), {b, c});
+    scheduler.Wait(d);
+
+    ASSERT_EQ(4u, order.size());
+    EXPECT_EQ(1, order.front());
+    EXPECT_EQ(4, order.back());
+}
+
+TEST(TaskSchedulerTest, Schedule_completedDependency_runsImmediately)
+{
+    auto scheduler = nc::TaskScheduler{1};
+    auto first = scheduler.Schedule([]() {});
+    scheduler.Wait(first);
+    auto ran = false;
+    scheduler.Wait(scheduler.Schedule([&ran]() { ran = true; }, {first, nc::TaskHandle{}}));
+    EXPECT_TRUE(ran);
+}
+
+TEST(TaskSchedulerTest, Wait_taskThrows_rethrows)
+{
+    auto scheduler = nc::TaskScheduler{2};
+    auto task = scheduler.Schedule([]() { throw std::runtime_error{"fail"}; });
+    EXPECT_THROW(scheduler.Wait(task), std::runtime_error);
+    EXPECT_TRUE(task.IsDone());
+}
+
+TEST(TaskSchedulerTest, Wait_dependencyThrows_skipsContinuationAndRethrows)
+{
+    auto scheduler = nc::TaskScheduler{2};
+    auto ran = false;
+    auto failed = scheduler.Schedule([]() { throw std::runtime_error{"fail"}; });
+    auto continuation = scheduler.Schedule([&ran]() { ran = true; }, {failed});
+    auto transitive = scheduler.Schedule([&ran]() { ran = true; }, {continuation});
+    EXPECT_THROW(scheduler.Wait(transitive), std::runtime_error);
+    EXPECT_FALSE(ran);
+}
+
+TEST(TaskSchedulerTest, Wait_nestedForkJoin_completes)
+{
+    auto scheduler = nc::TaskScheduler{3};
+    EXPECT_EQ(6765, Fibonacci(scheduler, 20));
+}
+
+TEST(TaskSchedulerTest, Destructor_pendingTasks_runsThem)
+{
+    auto count = std::atomic<int>{0};
+    {
+        auto scheduler = nc::TaskScheduler{0};
+        for (auto i = 0; i < 10; ++i)
+            scheduler.Schedule([&count]() { ++count; });
+    }
+
+    EXPECT_EQ(10, count);
+}
+
+TEST(TaskSchedulerTest, ParallelFor_perIndex_visitsEachIndexOnce)
+{
+    auto scheduler = nc::TaskScheduler{4};
+    auto visits = std::vector<std::atomic<int>>(10000);
+    scheduler.ParallelFor(visits.size(), [&visits](size_t i) { ++visits[i]; });
+    EXPECT_TRUE(std::ranges::all_of(visits, [](const auto& v) { return v.load() == 1; }));
+}
+
+TEST(TaskSchedulerTest, ParallelFor_chunked_respectsMinChunkSize)
+{
+    auto scheduler = nc::TaskScheduler{4};
+    auto total = std::atomic<size_t>{0};
+    auto undersized = std::atomic<int>{0};
+    scheduler.ParallelFor(1003, [&](size_t begin, size_t end)
+    {
+        if (end - begin < 10 && end != 1003) ++undersized;
+        total += end - begin;
+    }, 10);
+
+    EXPECT_EQ(1003u, total);
+    EXPECT_EQ(0, undersized);
+}
+
+TEST(TaskSchedulerTest, ParallelFor_maxConcurrencyOne_runsOnCaller)
+{
+    auto scheduler = nc::TaskScheduler{4};
+    const auto caller = std::this_thread::get_id();
+    auto otherThread = false;
+    scheduler.ParallelFor(100, [&](size_t) { otherThread |= std::this_thread::get_id() != caller; }, 1, 1);
+    EXPECT_FALSE(otherThread);
+}
+
+TEST(TaskSchedulerTest, ParallelFor_emptyRange_doesNothing)
+{
+    auto scheduler = nc::TaskScheduler{2};
+    auto called = false;
+    scheduler.ParallelFor(0, [&called](size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(TaskSchedulerTest, ParallelFor_throws_rethrowsAfterCompletion)
+{
+    auto scheduler = nc::TaskScheduler{4};
+    auto running = std::atomic<int>{0};
+    EXPECT_THROW(scheduler.ParallelFor(10000, [&running](size_t i)
+    {
+        ++running;
+        if (i == 5000) throw std::runtime_error{"fail"};
+        --running;
+    }), std::runtime_error);
+
+    EXPECT_EQ(1, running);
+}
+
+TEST(TaskSchedulerTest, ParallelFor_nestedInTasks_completes)
+{
+    auto scheduler = nc::TaskScheduler{3};
+    auto sums = std::vector<size_t>(8);
+    scheduler.ParallelFor(sums.size(), [&](size_t outer)
+    {
+        auto sum = std::atomic<size_t>{0};
+        scheduler.ParallelFor(1000, [&sum](size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i) sum += i;
+        });
+
+        sums[outer] = sum;
+    });
+
+    EXPECT_TRUE(std::ranges::all_of(sums, [](size_t sum) { return sum == 499500u; }));
+}
+
+TEST(TaskSchedulerTest, Default_returnsSameInstance)
+{
+    EXPECT_EQ(&nc::TaskScheduler::Default(), &nc::TaskScheduler::Default());
+    EXPECT_EQ(nc::TaskScheduler::DefaultWorkerCount(), nc::TaskScheduler::Default().WorkerCount());
+}